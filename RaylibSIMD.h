@@ -5,11 +5,232 @@
 extern "C" {
 #endif
 
+// NOTE: Standalone mode declares the subset of raylib.h that RaylibSIMD uses
+// and the implementation provides raylib's scalar pixel helpers, so the header
+// builds without raylib. Don't define RAYLIB_SIMD_STANDALONE alongside raylib.h.
+#if defined(RAYLIB_SIMD_STANDALONE)
+#include <stdbool.h>
+
+#if !defined(RLAPI)
+    #define RLAPI
+#endif
+
+// Color, 4 components, R8G8B8A8 (32bit)
+typedef struct Color
+{
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+    unsigned char a;
+} Color;
+
+// Vector2 type
+typedef struct Vector2
+{
+    float x;
+    float y;
+} Vector2;
+
+// Rectangle type
+typedef struct Rectangle
+{
+    float x;
+    float y;
+    float width;
+    float height;
+} Rectangle;
+
+// Image type, bpp always RGBA (32bit)
+typedef struct Image
+{
+    void *data;             // Image raw data
+    int width;              // Image base width
+    int height;             // Image base height
+    int mipmaps;            // Mipmap levels, 1 by default
+    int format;             // Data format (PixelFormat type)
+} Image;
+
+// Texture2D type, only carried inside Font
+typedef struct Texture2D
+{
+    unsigned int id;        // OpenGL texture id
+    int width;              // Texture base width
+    int height;             // Texture base height
+    int mipmaps;            // Mipmap levels, 1 by default
+    int format;             // Data format (PixelFormat type)
+} Texture2D;
+
+// Font character info
+typedef struct CharInfo
+{
+    int value;              // Character value (Unicode)
+    int offsetX;            // Character offset X when drawing
+    int offsetY;            // Character offset Y when drawing
+    int advanceX;           // Character advance position X
+    Image image;            // Character image data
+} CharInfo;
+
+// Font type, includes texture and charSet array data
+typedef struct Font
+{
+    int baseSize;           // Base size (default chars height)
+    int charsCount;         // Number of characters
+    Texture2D texture;      // Characters texture atlas
+    Rectangle *recs;        // Characters rectangles in texture
+    CharInfo *chars;        // Characters info data
+} Font;
+
+// Pixel formats, same values as raylib 3.0
+typedef enum
+{
+    UNCOMPRESSED_GRAYSCALE = 1,     // 8 bit per pixel (no alpha)
+    UNCOMPRESSED_GRAY_ALPHA,        // 8*2 bpp (2 channels)
+    UNCOMPRESSED_R5G6B5,            // 16 bpp
+    UNCOMPRESSED_R8G8B8,            // 24 bpp
+    UNCOMPRESSED_R5G5B5A1,          // 16 bpp (1 bit alpha)
+    UNCOMPRESSED_R4G4B4A4,          // 16 bpp (4 bit alpha)
+    UNCOMPRESSED_R8G8B8A8,          // 32 bpp
+    UNCOMPRESSED_R32,               // 32 bpp (1 channel - float)
+    UNCOMPRESSED_R32G32B32,         // 32*3 bpp (3 channels - float)
+    UNCOMPRESSED_R32G32B32A32,      // 32*4 bpp (4 channels - float)
+    COMPRESSED_DXT1_RGB,            // 4 bpp (no alpha)
+    COMPRESSED_DXT1_RGBA,           // 4 bpp (1 bit alpha)
+    COMPRESSED_DXT3_RGBA,           // 8 bpp
+    COMPRESSED_DXT5_RGBA,           // 8 bpp
+    COMPRESSED_ETC1_RGB,            // 4 bpp
+    COMPRESSED_ETC2_RGB,            // 4 bpp
+    COMPRESSED_ETC2_EAC_RGBA,       // 8 bpp
+    COMPRESSED_PVRT_RGB,            // 4 bpp
+    COMPRESSED_PVRT_RGBA,           // 4 bpp
+    COMPRESSED_ASTC_4x4_RGBA,       // 8 bpp
+    COMPRESSED_ASTC_8x8_RGBA        // 2 bpp
+} PixelFormat;
+#endif // RAYLIB_SIMD_STANDALONE
+
+// Precision of the RaylibSIMD_ImageDraw blend. Float is within 1 LSB of the
+// exact blend per destination channel, Fixed16 within 1 LSB once the color
+// error is weighted by the blended alpha (see TestBlendAccuracy).
+typedef enum
+{
+    RaylibSIMD_BlendPrecision_Float,   // Blend in [0, 1] float space, all supported formats (default)
+    RaylibSIMD_BlendPrecision_Fixed16, // Blend in 16 bit integer space when src and dst are R8G8B8A8, see RaylibSIMD__BlendPixelFixed16
+} RaylibSIMD_BlendPrecision;
+
+// Blend equation of RaylibSIMD_ImageDrawEx
+typedef enum
+{
+    RaylibSIMD_BlendMode_Alpha,              // Straight alpha "over" (default, same as RaylibSIMD_ImageDraw)
+    RaylibSIMD_BlendMode_AlphaPremultiplied, // Premultiplied alpha "over", R8G8B8A8 only, see RaylibSIMD_ImageAlphaPremultiply. Within 2 LSB of the exact blend
+
+    // NOTE: Straight alpha color modes, R8G8B8A8 only. The tinted source color
+    // s is weighted by its alpha a and combined with the destination color d,
+    // alpha is composited like "over" except for Copy. Within 2 LSB of the
+    // exact blend, see RaylibSIMD__BlendPixelMode.
+    RaylibSIMD_BlendMode_Additive,           // d + s * a
+    RaylibSIMD_BlendMode_Subtract,           // d - s * a
+    RaylibSIMD_BlendMode_Multiply,           // d * lerp(1, s, a)
+    RaylibSIMD_BlendMode_Screen,             // 1 - (1 - d) * (1 - s * a)
+    RaylibSIMD_BlendMode_Min,                // lerp(d, min(s, d), a)
+    RaylibSIMD_BlendMode_Max,                // lerp(d, max(s, d), a)
+    RaylibSIMD_BlendMode_Copy,               // s, alpha included, i.e. the tinted source replaces the destination
+} RaylibSIMD_BlendMode;
+
+// Glyphs of a string laid out once by RaylibSIMD_LoadTextRun, so that it can be
+// drawn again with RaylibSIMD_ImageDrawTextRun without decoding and looking up
+// every character
+typedef struct RaylibSIMD_TextGlyph
+{
+    int index;              // Of the glyph in font.chars
+    Rectangle rec;          // Destination rectangle relative to the text position
+} RaylibSIMD_TextGlyph;
+
+typedef struct RaylibSIMD_TextRun
+{
+    int glyphCount;
+    RaylibSIMD_TextGlyph *glyphs;
+    Vector2 size;           // Size of the laid out text, like MeasureTextEx
+} RaylibSIMD_TextRun;
+
+// Implementation used by RaylibSIMD_ImageDraw, forcing one is meant for benchmarking and testing
+typedef enum
+{
+    RaylibSIMD_ImageDrawMode_Auto,      // SIMD when both formats are supported, Original otherwise (default)
+    RaylibSIMD_ImageDrawMode_Original,  // raylib's GetPixelColor, ColorAlphaBlend, SetPixelColor loop
+    RaylibSIMD_ImageDrawMode_Flattened, // Scalar float blend, R8G8B8A8 to R8G8B8A8 only
+    RaylibSIMD_ImageDrawMode_SIMD,
+} RaylibSIMD_ImageDrawMode;
+
+// Filter used when RaylibSIMD_ImageDraw stretches the source rectangle over a differently sized destination rectangle
+typedef enum
+{
+    RaylibSIMD_ScaleFilter_Bilinear, // Default
+    RaylibSIMD_ScaleFilter_Nearest,
+} RaylibSIMD_ScaleFilter;
+
+// Edges of the primitives drawn by RaylibSIMD_ImageDrawLine, RaylibSIMD_ImageDrawCircle and the like
+typedef enum
+{
+    RaylibSIMD_ShapeEdges_Aliased,     // Pixels whose center is inside are set to the color like RaylibSIMD_ImageDrawRectangleRec (default)
+    RaylibSIMD_ShapeEdges_Antialiased, // The color is blended over every pixel by the fraction of it the shape covers
+} RaylibSIMD_ShapeEdges;
+
+// Filter used by RaylibSIMD_ImageMipmaps, and to update the mipmap levels under what's drawn on an image that has them
+typedef enum
+{
+    RaylibSIMD_MipmapFilter_Box,      // Average of the 2x2 pixels above (default)
+    RaylibSIMD_MipmapFilter_BoxGamma, // Average of the 2x2 pixels above in linear light, for sRGB colors in 8 bit formats
+} RaylibSIMD_MipmapFilter;
+
 RLAPI void  RaylibSIMD_ImageDraw            (Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint);
+RLAPI void  RaylibSIMD_ImageDrawEx          (Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, RaylibSIMD_BlendMode blendMode);
+RLAPI void  RaylibSIMD_ImageDrawPro         (Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint); // Like DrawTexturePro, rotation in degrees around origin
+RLAPI void  RaylibSIMD_ImageDrawMasked      (Image *dst, Image src, Rectangle srcRec, Image mask, Rectangle maskRec, Vector2 position, Color tint); // Source alpha multiplied by the mask's coverage
+RLAPI void  RaylibSIMD_ImageDrawColorMasked (Image *dst, Image mask, Rectangle maskRec, Vector2 position, Color color);                     // Color drawn through the mask's coverage
+RLAPI void  RaylibSIMD_ImageDrawTextEx      (Image *dst, Vector2 position, Font font, const char *text, float fontSize, float spacing, Color color); // Glyphs laid out like DrawTextEx
+RLAPI RaylibSIMD_TextRun RaylibSIMD_LoadTextRun(Font font, const char *text, float fontSize, float spacing);
+RLAPI void  RaylibSIMD_UnloadTextRun        (RaylibSIMD_TextRun run);
+RLAPI void  RaylibSIMD_ImageDrawTextRun     (Image *dst, Font font, RaylibSIMD_TextRun run, Vector2 position, Color color);
 RLAPI Image RaylibSIMD_GenImageColor        (int width, int height, Color color);
+RLAPI Image RaylibSIMD_LoadScratchImage     (int width, int height, int format); // Uncompressed image from the scratch pool, cache line aligned, contents undefined
+RLAPI void  RaylibSIMD_UnloadScratchImage   (Image image); // Back to the pool for the next scratch image, not UnloadImage
 RLAPI void  RaylibSIMD_ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color);
 RLAPI void  RaylibSIMD_ImageDrawRectangle   (Image *dst, int posX, int posY, int width, int height, Color color);
 RLAPI void  RaylibSIMD_ImageClearBackground (Image *dst, Color color);
+RLAPI void  RaylibSIMD_ImageDrawLine        (Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color); // 1 pixel wide, endpoints included
+RLAPI void  RaylibSIMD_ImageDrawLineEx      (Image *dst, Vector2 startPos, Vector2 endPos, float thick, Color color);
+RLAPI void  RaylibSIMD_ImageDrawCircle      (Image *dst, int centerX, int centerY, int radius, Color color);
+RLAPI void  RaylibSIMD_ImageDrawCircleV     (Image *dst, Vector2 center, float radius, Color color);
+RLAPI void  RaylibSIMD_ImageDrawCircleLines (Image *dst, int centerX, int centerY, int radius, Color color);
+RLAPI void  RaylibSIMD_ImageDrawTriangle    (Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color); // Any winding order
+RLAPI void  RaylibSIMD_ImageDrawRectangleLines       (Image *dst, Rectangle rec, int thick, Color color); // Lines inside rec
+RLAPI void  RaylibSIMD_ImageDrawRectangleRounded     (Image *dst, Rectangle rec, float roundness, Color color); // Corner radius is roundness * half the shorter side
+RLAPI void  RaylibSIMD_ImageDrawRectangleRoundedLines(Image *dst, Rectangle rec, float roundness, int thick, Color color);
+RLAPI void  RaylibSIMD_SetBlendPrecision    (RaylibSIMD_BlendPrecision precision);
+RLAPI void  RaylibSIMD_SetScaleFilter       (RaylibSIMD_ScaleFilter filter);
+RLAPI void  RaylibSIMD_SetShapeEdges        (RaylibSIMD_ShapeEdges edges);
+RLAPI void  RaylibSIMD_SetMipmapFilter      (RaylibSIMD_MipmapFilter filter);
+RLAPI void  RaylibSIMD_SetImageDrawMode     (RaylibSIMD_ImageDrawMode mode); // Modes that can't handle a draw fall back to Auto
+RLAPI void  RaylibSIMD_SetWorkerCount       (int count); // Threads used by large draws including the caller, 1 (default) is single threaded, 0 uses every core
+RLAPI int   RaylibSIMD_GetWorkerCount       (void);
+RLAPI void  RaylibSIMD_ReleaseScratch       (void);      // Free the memory the scratch pool keeps between calls
+RLAPI void  RaylibSIMD_SetImageAlignment    (int alignment); // Power of 2 for image data RaylibSIMD allocates, 0 (default) uses RL_MALLOC. RL_FREE must be free(), not supported on Windows
+RLAPI void  RaylibSIMD_BeginBatch           (Image *dst); // Record draws, fills and color adjustments on dst until the batch is flushed, source pixels must outlive the flush
+RLAPI void  RaylibSIMD_FlushBatch           (void);       // Run the recorded commands tile by tile, on the worker pool when it's running
+RLAPI void  RaylibSIMD_EndBatch             (void);       // Flush and stop recording
+RLAPI void  RaylibSIMD_ImageAlphaPremultiply  (Image *image);
+RLAPI void  RaylibSIMD_ImageAlphaUnpremultiply(Image *image);
+RLAPI void  RaylibSIMD_ImageFormat          (Image *image, int newFormat); // Convert between uncompressed formats, same results as raylib's ImageFormat, and to and from DXT1, DXT3 and DXT5
+RLAPI void  RaylibSIMD_ImageColorTint       (Image *image, Color color);
+RLAPI void  RaylibSIMD_ImageColorInvert     (Image *image);
+RLAPI void  RaylibSIMD_ImageColorGrayscale  (Image *image); // Keeps the image format, unlike raylib's which converts to GRAYSCALE
+RLAPI void  RaylibSIMD_ImageColorContrast   (Image *image, float contrast);   // -100 to 100
+RLAPI void  RaylibSIMD_ImageColorBrightness (Image *image, int brightness);   // -255 to 255
+RLAPI void  RaylibSIMD_ImageColorReplace    (Image *image, Color color, Color replace);
+RLAPI void  RaylibSIMD_ImageBlurBox         (Image *image, int radius);   // (2 * radius + 1)^2 box, same cost at any radius
+RLAPI void  RaylibSIMD_ImageBlurGaussian    (Image *image, float sigma);  // Kernel out to 3 sigma, at most 64 pixels
+RLAPI void  RaylibSIMD_ImageSharpen         (Image *image, float sigma, float amount); // Unsharp mask, adds amount times the difference from the blurred image
+RLAPI void  RaylibSIMD_ImageConvolve        (Image *image, float const *kernelX, int sizeX, float const *kernelY, int sizeY); // Separable kernel, odd sizes up to 129
+RLAPI void  RaylibSIMD_ImageMipmaps         (Image *image); // Every level down to 1x1, unlike raylib's levels already there are rebuilt from the base level
 
 #if defined(__cplusplus)
 }
@@ -17,6 +238,7 @@ RLAPI void  RaylibSIMD_ImageClearBackground (Image *dst, Color color);
 #endif // RAYLIB_SIMD_H
 
 #ifdef RAYLIB_SIMD_IMPLEMENTATION
+#include <math.h>
 #include <stdint.h>
 
 #if defined(_MSC_VER)
@@ -31,357 +253,6621 @@ RLAPI void  RaylibSIMD_ImageClearBackground (Image *dst, Color color);
     #include <intrin.h>
 #elif defined(RS_COMPILER_CLANG) || defined(RS_COMPILER_GCC)
     #include <x86intrin.h>
+    #include <cpuid.h>
 #else
     #error "SIMD Implementation Required"
 #endif
 
+// NOTE: Kernels for wider instruction sets are compiled per function so that
+// the library builds with the compiler's default flags and picks the widest
+// kernel the CPU supports at runtime. MSVC allows any intrinsic in any
+// function so no annotation is needed there.
+#if defined(RS_COMPILER_MSVC)
+    #define RS_TARGET_SSE41
+    #define RS_TARGET_AVX2
+    #define RS_TARGET_AVX512
+#else
+    #define RS_TARGET_SSE41  __attribute__((target("sse4.1")))
+    #define RS_TARGET_AVX2   __attribute__((target("avx2")))
+    #define RS_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#endif
+
 #define RS_FILE_SCOPE static
 #define RS_MAX(a, b) ((a) > (b) ? (a) : (b))
 #define RS_MIN(a, b) ((a) < (b) ? (a) : (b))
 #define RS_CAST(x) (x)
 
-RS_FILE_SCOPE uint32_t RaylibSIMD__ColorToU32(Color color)
-{
-    uint32_t result = (RS_CAST(uint32_t) color.r << 0) |
-                      (RS_CAST(uint32_t) color.g << 8) |
-                      (RS_CAST(uint32_t) color.b << 16) |
-                      (RS_CAST(uint32_t) color.a << 24);
-    return result;
-}
+// NOTE: Kernels specialized at compile time call a shared body with a constant
+// argument, which has to be inlined for the constant to be folded.
+#if defined(RS_COMPILER_MSVC)
+    #define RS_FORCE_INLINE __forceinline
+#else
+    #define RS_FORCE_INLINE inline __attribute__((always_inline))
+#endif
 
-RS_FILE_SCOPE void RaylibSIMD__SoftwareBlendPixel(unsigned char const *src_ptr, unsigned char *dest_ptr, Color tint, float src_alpha_min)
+#if defined(RAYLIB_SIMD_STANDALONE)
+// NOTE: Stand-ins for the textures.c environment, the pixel helpers are
+// raylib 3.0's so the Original draw mode produces raylib's results.
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(RL_MALLOC)
+    #define RL_MALLOC(sz)     malloc(sz)
+    #define RL_CALLOC(n,sz)   calloc(n,sz)
+    #define RL_REALLOC(ptr,sz) realloc(ptr,sz)
+    #define RL_FREE(ptr)      free(ptr)
+#endif
+
+typedef enum
 {
-    float const INV_255 = 1.f / 255.f;
-    uint32_t src_pixel  = *RS_CAST(uint32_t *)src_ptr;
-    uint32_t dest_pixel = *RS_CAST(uint32_t *)dest_ptr;
-    float src_r = RS_CAST(float)((src_pixel >> 0) & 0xFF);
-    float src_g = RS_CAST(float)((src_pixel >> 8) & 0xFF);
-    float src_b = RS_CAST(float)((src_pixel >> 16) & 0xFF);
-    float src_a = RS_CAST(float)((src_pixel >> 24) & 0xFF);
-    src_a       = RS_MAX(src_a, src_alpha_min);
+    LOG_ALL = 0,
+    LOG_TRACE,
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARNING,
+    LOG_ERROR,
+    LOG_FATAL,
+    LOG_NONE
+} TraceLogType;
 
-    float dest_r = RS_CAST(float)((dest_pixel >> 0) & 0xFF);
-    float dest_g = RS_CAST(float)((dest_pixel >> 8) & 0xFF);
-    float dest_b = RS_CAST(float)((dest_pixel >> 16) & 0xFF);
-    float dest_a = RS_CAST(float)((dest_pixel >> 24) & 0xFF);
+#define TRACELOG(level, ...) RaylibSIMD__TraceLog(level, __VA_ARGS__)
+RS_FILE_SCOPE void RaylibSIMD__TraceLog(int level, char const *text, ...)
+{
+    char const *prefix = "INFO";
+    if (level == LOG_WARNING)    prefix = "WARNING";
+    else if (level == LOG_ERROR) prefix = "ERROR";
+    else if (level == LOG_FATAL) prefix = "FATAL";
 
-    float src_r01 = src_r * INV_255;
-    float src_g01 = src_g * INV_255;
-    float src_b01 = src_b * INV_255;
-    float src_a01 = src_a * INV_255;
+    va_list args;
+    va_start(args, text);
+    fprintf(stderr, "%s: ", prefix);
+    vfprintf(stderr, text, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+}
 
-    float tint_r01  = tint.r * INV_255;
-    float tint_g01  = tint.g * INV_255;
-    float tint_b01  = tint.b * INV_255;
-    float tint_a01  = tint.a * INV_255;
+RS_FILE_SCOPE int GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
 
-    float src_tint_r01 = tint_r01 * src_r01;
-    float src_tint_g01 = tint_g01 * src_g01;
-    float src_tint_b01 = tint_b01 * src_b01;
-    float src_tint_a01 = tint_a01 * src_a01;
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case UNCOMPRESSED_R32: bpp = 32; break;
+        case UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA:
+        case COMPRESSED_ETC2_EAC_RGBA:
+        case COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
 
-    float dest_r01 = dest_r * INV_255;
-    float dest_g01 = dest_g * INV_255;
-    float dest_b01 = dest_b * INV_255;
-    float dest_a01 = dest_a * INV_255;
+    dataSize = width*height*bpp/8;  // Total data size in bytes
 
-    float blend_a01     = src_tint_a01 + dest_a01 * (1.0f - src_tint_a01);
-    float inv_blend_a01 = 1.f / blend_a01;
+    // Most compressed formats works on 4x4 blocks,
+    // if texture is smaller, minimum dataSize is 8 or 16
+    if ((width < 4) && (height < 4))
+    {
+        if ((format >= COMPRESSED_DXT1_RGB) && (format < COMPRESSED_DXT3_RGBA)) dataSize = 8;
+        else if ((format >= COMPRESSED_DXT3_RGBA) && (format < COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+    }
 
-    float blend_r01 = ((src_tint_r01 * src_tint_a01) + (dest_r01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
-    float blend_g01 = ((src_tint_g01 * src_tint_a01) + (dest_g01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
-    float blend_b01 = ((src_tint_b01 * src_tint_a01) + (dest_b01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
+    return dataSize;
+}
 
-    float blend_a = blend_a01 * 255.f;
-    float blend_r = blend_r01 * 255.f;
-    float blend_g = blend_g01 * 255.f;
-    float blend_b = blend_b01 * 255.f;
+RS_FILE_SCOPE Color GetPixelColor(void *srcPtr, int format)
+{
+    Color col = { 0 };
+    unsigned char const *bytes = RS_CAST(unsigned char const *)srcPtr;
+    unsigned short pixel       = 0;
+    if (GetPixelDataSize(1, 1, format) == 2) memcpy(&pixel, srcPtr, sizeof(pixel));
 
-    unsigned char blend_r255 = RS_CAST(unsigned char)blend_r;
-    unsigned char blend_g255 = RS_CAST(unsigned char)blend_g;
-    unsigned char blend_b255 = RS_CAST(unsigned char)blend_b;
-    unsigned char blend_a255 = RS_CAST(unsigned char)blend_a;
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: col = (Color){ bytes[0], bytes[0], bytes[0], 255 }; break;
+        case UNCOMPRESSED_GRAY_ALPHA: col = (Color){ bytes[0], bytes[0], bytes[0], bytes[1] }; break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            col.r = (unsigned char)((pixel >> 11)*255/31);
+            col.g = (unsigned char)(((pixel >> 5) & 0x3F)*255/63);
+            col.b = (unsigned char)((pixel & 0x1F)*255/31);
+            col.a = 255;
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            col.r = (unsigned char)((pixel >> 11)*255/31);
+            col.g = (unsigned char)(((pixel >> 6) & 0x1F)*255/31);
+            col.b = (unsigned char)(((pixel >> 1) & 0x1F)*255/31);
+            col.a = (pixel & 0x1)? 255 : 0;
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            col.r = (unsigned char)((pixel >> 12)*255/15);
+            col.g = (unsigned char)(((pixel >> 8) & 0xF)*255/15);
+            col.b = (unsigned char)(((pixel >> 4) & 0xF)*255/15);
+            col.a = (unsigned char)((pixel & 0xF)*255/15);
+        } break;
+        case UNCOMPRESSED_R8G8B8A8: col = (Color){ bytes[0], bytes[1], bytes[2], bytes[3] }; break;
+        case UNCOMPRESSED_R8G8B8: col = (Color){ bytes[0], bytes[1], bytes[2], 255 }; break;
+        default: break;
+    }
 
-    uint32_t blend_pixel = (RS_CAST(uint32_t)blend_r255 & 0xFF) << 0 |
-                            (RS_CAST(uint32_t)blend_g255 & 0xFF) << 8 |
-                            (RS_CAST(uint32_t)blend_b255 & 0xFF) << 16 |
-                            (RS_CAST(uint32_t)blend_a255 & 0xFF) << 24;
-    *(RS_CAST(uint32_t *)dest_ptr) = blend_pixel;
+    return col;
 }
 
-typedef struct
+// NOTE: round(value) for the non-negative values SetPixelColor produces
+RS_FILE_SCOPE unsigned char RaylibSIMD__RoundU8(float value)
 {
-    __m128i shuffle;
-    uint8_t r_bit_mask;
-    uint8_t g_bit_mask;
-    uint8_t b_bit_mask;
-    uint8_t a_bit_mask;
-    uint8_t r_bit_shift;
-    uint8_t g_bit_shift;
-    uint8_t b_bit_shift;
-    uint8_t a_bit_shift;
-    float r_to_01_coefficient;
-    float b_to_01_coefficient;
-    float g_to_01_coefficient;
-    float a_to_01_coefficient;
-} RaylibSIMD_PixelPerLaneShuffle;
+    unsigned char result = RS_CAST(unsigned char)value;
+    if (value - RS_CAST(float)result >= 0.5f) result++;
+    return result;
+}
 
-static RaylibSIMD_PixelPerLaneShuffle RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(int format)
+RS_FILE_SCOPE void SetPixelColor(void *dstPtr, Color color, int format)
 {
-    RaylibSIMD_PixelPerLaneShuffle result = {0};
-    result.shuffle                        = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
-    result.r_bit_mask                     = 0xFF;
-    result.g_bit_mask                     = 0xFF;
-    result.b_bit_mask                     = 0xFF;
-    result.a_bit_mask                     = 0xFF;
-    result.r_bit_shift                    = 0;
-    result.g_bit_shift                    = 8;
-    result.b_bit_shift                    = 16;
-    result.a_bit_shift                    = 24;
-    result.r_to_01_coefficient            = 1.f / 255.f;
-    result.g_to_01_coefficient            = 1.f / 255.f;
-    result.b_to_01_coefficient            = 1.f / 255.f;
-    result.a_to_01_coefficient            = 1.f / 255.f;
+    float const r = (float)color.r/255.0f;
+    float const g = (float)color.g/255.0f;
+    float const b = (float)color.b/255.0f;
+    float const a = (float)color.a/255.0f;
+    unsigned char *bytes = RS_CAST(unsigned char *)dstPtr;
+    unsigned short pixel = 0;
 
-    switch(format)
+    switch (format)
     {
+        case UNCOMPRESSED_GRAYSCALE: bytes[0] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f); break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            bytes[0] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+            bytes[1] = color.a;
+        } break;
+        case UNCOMPRESSED_R5G6B5:
+        {
+            pixel = (unsigned short)(RaylibSIMD__RoundU8(r*31.0f) << 11 | RaylibSIMD__RoundU8(g*63.0f) << 5 | RaylibSIMD__RoundU8(b*31.0f));
+            memcpy(dstPtr, &pixel, sizeof(pixel));
+        } break;
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            unsigned short alpha = (a > (50.0f/255.0f))? 1 : 0; // NOTE: raylib's UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD
+            pixel = (unsigned short)(RaylibSIMD__RoundU8(r*31.0f) << 11 | RaylibSIMD__RoundU8(g*31.0f) << 6 | RaylibSIMD__RoundU8(b*31.0f) << 1 | alpha);
+            memcpy(dstPtr, &pixel, sizeof(pixel));
+        } break;
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            pixel = (unsigned short)(RaylibSIMD__RoundU8(r*15.0f) << 12 | RaylibSIMD__RoundU8(g*15.0f) << 8 | RaylibSIMD__RoundU8(b*15.0f) << 4 | RaylibSIMD__RoundU8(a*15.0f));
+            memcpy(dstPtr, &pixel, sizeof(pixel));
+        } break;
+        case UNCOMPRESSED_R8G8B8:
+        {
+            bytes[0] = color.r;
+            bytes[1] = color.g;
+            bytes[2] = color.b;
+        } break;
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            bytes[0] = color.r;
+            bytes[1] = color.g;
+            bytes[2] = color.b;
+            bytes[3] = color.a;
+        } break;
         default: break;
+    }
+}
 
-        // NOTE: We load 4 pixels x 4 colors at a time. But if the
-        // source image is RGB, then the 4th color loaded in each
-        // pixel is going to be the RED component of the next pixel.
-        //
-        // Pixels[] = {RGB, RGB, RGB, RGB, ...}
-        //
-        // For example, naively loading the next pixels in a 3BPP
-        // byte stream, produces in a 128 bit SIMD register
-        //
-        // Pixel    |   1  2     3     4     5  6*
-        // Register | {[RGBR] [GBRG] [BRGB] [RGBR]}
-        //              ^
-        //              |
-        //              +---- This is the start of the 2nd pixel.
-        //
-        // * Note that only the red channel of the 6th pixel gets loaded.
-        //
-        // The 2nd pixel needs to be moved into the SIMD lane.
-        // and so forth for subsequent pixels. We shift the color
-        // channels to correctly set up the SIMD lane, like so.
-        //
-        // Pixel    |   1      2      3      4
-        // Register | {[RGB.] [RGB.] [RGB.] [RGB.]]}
-        //
-        // We do this by shuffling the loaded bits into place
-        // duplicating the red channel and copying onwards. In the
-        // RGBA case, we do a no-op shuffle that preserves positions
-        // of all color components to avoid branches in the blitting
-        // hot path.
+RS_FILE_SCOPE Color ColorAlphaBlend(Color dst, Color src, Color tint)
+{
+    Color out = { 255, 255, 255, 255 };
 
-        // NOTE: R8G8B8 24bit Pixel
-        // Bits       | 23 22 21 20   19 18 17 16 | 15 14 13 12   11 10 9 8 | 7654 3210
-        // Color Bits |  R  R  R  R    R  R  R  R | G   G  G  G    G  G G G | BBBB BBBB
-        //
-        // A 128bit SIMD register with 4x32bit lanes can store
-        // 1 pixel per register and the red channel of the next
-        // pixel.
-        //
-        // Pixel    |   1  2     3     4     5  6
-        // Register | {[RGBR] [GBRG] [BRGB] [RGBR]}
-        //
-        // Desired layout 1 pixel per 32 bit lane
-        //
-        // Pixel           |   1      2      3      4
-        // Register        | {[RGB.] [RGB.] [RGB.] [RGB.]]}
-        // Bits            |  [0:23] [24:47] [48:71] [72:95]
-        // Bytes (Shuffle) |  [0:2]  [3:5]   [6:8]   [9:11]
-        case UNCOMPRESSED_R8G8B8:
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*(unsigned int)tint.r) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*(unsigned int)tint.g) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*(unsigned int)tint.b) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*(unsigned int)tint.a) >> 8);
+
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
         {
-            result.shuffle = _mm_setr_epi8(0, 1, 2, 0, // Lane 1
-                                           3, 4, 5, 0,
-                                           6, 7, 8, 0,
-                                           9, 10, 11, 0);
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
         }
-        break;
+    }
 
-        // NOTE: RGBA4444 16bit Pixel
-        // Bits       | 15 14 13 12 | 11 10 98 | 7654 | 3210
-        // Color Bits |  R  R  R  R | G   G GG | BBBB | AAAA
-        //
-        // A 128bit SIMD register with 4x32bit lanes can store
-        // 2 pixels per register.
-        //
-        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
-        //
+    return out;
+}
+#endif // RAYLIB_SIMD_STANDALONE
+
+typedef enum
+{
+    RaylibSIMD_InstructionSet_Unknown = -1,
+    RaylibSIMD_InstructionSet_None,   // No SSE4.1, SIMD kernels unavailable
+    RaylibSIMD_InstructionSet_SSE41,  // 128 bit, 4 pixels per iteration
+    RaylibSIMD_InstructionSet_AVX2,   // 256 bit, 8 pixels per iteration
+    RaylibSIMD_InstructionSet_AVX512, // 512 bit, 16 pixels per iteration (AVX512F + AVX512BW)
+} RaylibSIMD_InstructionSet;
+
+RS_FILE_SCOPE void RaylibSIMD__CPUID(uint32_t leaf, uint32_t sub_leaf, uint32_t regs[4])
+{
+#if defined(RS_COMPILER_MSVC)
+    int result[4];
+    __cpuidex(result, RS_CAST(int)leaf, RS_CAST(int)sub_leaf);
+    regs[0] = RS_CAST(uint32_t)result[0];
+    regs[1] = RS_CAST(uint32_t)result[1];
+    regs[2] = RS_CAST(uint32_t)result[2];
+    regs[3] = RS_CAST(uint32_t)result[3];
+#else
+    __cpuid_count(leaf, sub_leaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// NOTE: The OS must save the wider registers on a context switch for them to
+// be usable, which is reported in the XCR0 register.
+RS_FILE_SCOPE uint64_t RaylibSIMD__XCR0(void)
+{
+#if defined(RS_COMPILER_MSVC)
+    uint64_t result = _xgetbv(0);
+#else
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    uint64_t result = (RS_CAST(uint64_t)edx << 32) | eax;
+#endif
+    return result;
+}
+
+RS_FILE_SCOPE RaylibSIMD_InstructionSet RaylibSIMD__DetectInstructionSet(void)
+{
+    RaylibSIMD_InstructionSet result = RaylibSIMD_InstructionSet_None;
+    uint32_t regs[4] = {0};
+    RaylibSIMD__CPUID(0, 0, regs);
+    uint32_t const max_leaf = regs[0];
+    if (max_leaf < 1) return result;
+
+    RaylibSIMD__CPUID(1, 0, regs);
+    int const has_ssse3   = (regs[2] >> 9)  & 1;
+    int const has_sse41   = (regs[2] >> 19) & 1;
+    int const has_osxsave = (regs[2] >> 27) & 1;
+    int const has_avx     = (regs[2] >> 28) & 1;
+    if (!has_ssse3 || !has_sse41) return result;
+    result = RaylibSIMD_InstructionSet_SSE41;
+
+    if (!has_osxsave || !has_avx || max_leaf < 7) return result;
+    uint64_t const xcr0 = RaylibSIMD__XCR0();
+    if ((xcr0 & 0x6) != 0x6) return result; // XMM, YMM state
+
+    RaylibSIMD__CPUID(7, 0, regs);
+    int const has_avx2     = (regs[1] >> 5)  & 1;
+    int const has_avx512f  = (regs[1] >> 16) & 1;
+    int const has_avx512bw = (regs[1] >> 30) & 1;
+    if (!has_avx2) return result;
+    result = RaylibSIMD_InstructionSet_AVX2;
+
+    if (!has_avx512f || !has_avx512bw || (xcr0 & 0xE0) != 0xE0) return result; // Opmask, ZMM state
+    result = RaylibSIMD_InstructionSet_AVX512;
+    return result;
+}
+
+// NOTE: Detected once and cached, racing threads compute the same answer.
+RS_FILE_SCOPE RaylibSIMD_InstructionSet RaylibSIMD__InstructionSet(void)
+{
+    static RaylibSIMD_InstructionSet result = RaylibSIMD_InstructionSet_Unknown;
+    if (result == RaylibSIMD_InstructionSet_Unknown) result = RaylibSIMD__DetectInstructionSet();
+    return result;
+}
+
+// NOTE: Optional worker pool that splits large draws into row bands. It is
+// disabled until RaylibSIMD_SetWorkerCount asks for more than one thread and
+// can be compiled out entirely with RAYLIB_SIMD_NO_THREADS.
+//
+// windows.h is not included since its declarations collide with raylib's
+// (Rectangle, CloseWindow, ...), the few functions needed are declared here
+// with opaque pointers instead, in the same way raylib's core does.
+#define RS_MAX_WORKERS 64
+
+// NOTE: Runs task_index [0, task_count) of the current job, a task is one band
+// of rows of a draw.
+typedef void RaylibSIMD__TaskProc(void *user_data, int task_index);
+
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+#if defined(_WIN32)
+#if !defined(_WINDOWS_)
+__declspec(dllimport) void *         __stdcall CreateThread(void *attributes, size_t stack_size, unsigned long (__stdcall *proc)(void *), void *param, unsigned long flags, unsigned long *thread_id);
+__declspec(dllimport) unsigned long  __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int            __stdcall CloseHandle(void *handle);
+__declspec(dllimport) void           __stdcall AcquireSRWLockExclusive(void *lock);
+__declspec(dllimport) void           __stdcall ReleaseSRWLockExclusive(void *lock);
+__declspec(dllimport) unsigned char  __stdcall TryAcquireSRWLockExclusive(void *lock);
+__declspec(dllimport) int            __stdcall SleepConditionVariableSRW(void *condition, void *lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void           __stdcall WakeAllConditionVariable(void *condition);
+__declspec(dllimport) unsigned long  __stdcall GetActiveProcessorCount(unsigned short group);
+#endif
+
+// NOTE: SRWLOCK and CONDITION_VARIABLE are a single pointer that is valid
+// when zero initialised.
+typedef struct { void *handle; } RaylibSIMD__Mutex;
+typedef struct { void *handle; } RaylibSIMD__Condition;
+typedef struct { void *handle; } RaylibSIMD__Thread;
+
+RS_FILE_SCOPE void RaylibSIMD__MutexInit(RaylibSIMD__Mutex *mutex)                                     { mutex->handle = NULL; }
+RS_FILE_SCOPE void RaylibSIMD__MutexLock(RaylibSIMD__Mutex *mutex)                                     { AcquireSRWLockExclusive(RS_CAST(void *)&mutex->handle); }
+RS_FILE_SCOPE void RaylibSIMD__MutexUnlock(RaylibSIMD__Mutex *mutex)                                   { ReleaseSRWLockExclusive(RS_CAST(void *)&mutex->handle); }
+RS_FILE_SCOPE bool RaylibSIMD__MutexTryLock(RaylibSIMD__Mutex *mutex)                                  { return TryAcquireSRWLockExclusive(RS_CAST(void *)&mutex->handle) != 0; }
+RS_FILE_SCOPE void RaylibSIMD__ConditionInit(RaylibSIMD__Condition *condition)                         { condition->handle = NULL; }
+RS_FILE_SCOPE void RaylibSIMD__ConditionWait(RaylibSIMD__Condition *condition, RaylibSIMD__Mutex *mutex) { SleepConditionVariableSRW(RS_CAST(void *)&condition->handle, RS_CAST(void *)&mutex->handle, 0xFFFFFFFF /*INFINITE*/, 0); }
+RS_FILE_SCOPE void RaylibSIMD__ConditionBroadcast(RaylibSIMD__Condition *condition)                    { WakeAllConditionVariable(RS_CAST(void *)&condition->handle); }
+RS_FILE_SCOPE int  RaylibSIMD__ProcessorCount(void)                                                    { return RS_CAST(int)GetActiveProcessorCount(0xFFFF /*ALL_PROCESSOR_GROUPS*/); }
+
+typedef struct { void (*proc)(void *); void *user_data; } RaylibSIMD__ThreadStart;
+RS_FILE_SCOPE unsigned long __stdcall RaylibSIMD__ThreadEntry(void *user_data)
+{
+    RaylibSIMD__ThreadStart *start = RS_CAST(RaylibSIMD__ThreadStart *)user_data;
+    start->proc(start->user_data);
+    return 0;
+}
+
+RS_FILE_SCOPE bool RaylibSIMD__ThreadCreate(RaylibSIMD__Thread *thread, RaylibSIMD__ThreadStart *start)
+{
+    thread->handle = CreateThread(NULL, 0, RaylibSIMD__ThreadEntry, start, 0, NULL);
+    return thread->handle != NULL;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ThreadJoin(RaylibSIMD__Thread *thread)
+{
+    WaitForSingleObject(thread->handle, 0xFFFFFFFF /*INFINITE*/);
+    CloseHandle(thread->handle);
+}
+#else
+#include <pthread.h>
+#include <unistd.h>
+
+typedef struct { pthread_mutex_t handle; } RaylibSIMD__Mutex;
+typedef struct { pthread_cond_t  handle; } RaylibSIMD__Condition;
+typedef struct { pthread_t       handle; } RaylibSIMD__Thread;
+
+RS_FILE_SCOPE void RaylibSIMD__MutexInit(RaylibSIMD__Mutex *mutex)                                     { pthread_mutex_init(&mutex->handle, NULL); }
+RS_FILE_SCOPE void RaylibSIMD__MutexLock(RaylibSIMD__Mutex *mutex)                                     { pthread_mutex_lock(&mutex->handle); }
+RS_FILE_SCOPE void RaylibSIMD__MutexUnlock(RaylibSIMD__Mutex *mutex)                                   { pthread_mutex_unlock(&mutex->handle); }
+RS_FILE_SCOPE bool RaylibSIMD__MutexTryLock(RaylibSIMD__Mutex *mutex)                                  { return pthread_mutex_trylock(&mutex->handle) == 0; }
+RS_FILE_SCOPE void RaylibSIMD__ConditionInit(RaylibSIMD__Condition *condition)                         { pthread_cond_init(&condition->handle, NULL); }
+RS_FILE_SCOPE void RaylibSIMD__ConditionWait(RaylibSIMD__Condition *condition, RaylibSIMD__Mutex *mutex) { pthread_cond_wait(&condition->handle, &mutex->handle); }
+RS_FILE_SCOPE void RaylibSIMD__ConditionBroadcast(RaylibSIMD__Condition *condition)                    { pthread_cond_broadcast(&condition->handle); }
+RS_FILE_SCOPE int  RaylibSIMD__ProcessorCount(void)                                                    { return RS_CAST(int)sysconf(_SC_NPROCESSORS_ONLN); }
+
+typedef struct { void (*proc)(void *); void *user_data; } RaylibSIMD__ThreadStart;
+RS_FILE_SCOPE void *RaylibSIMD__ThreadEntry(void *user_data)
+{
+    RaylibSIMD__ThreadStart *start = RS_CAST(RaylibSIMD__ThreadStart *)user_data;
+    start->proc(start->user_data);
+    return NULL;
+}
+
+RS_FILE_SCOPE bool RaylibSIMD__ThreadCreate(RaylibSIMD__Thread *thread, RaylibSIMD__ThreadStart *start)
+{
+    return pthread_create(&thread->handle, NULL, RaylibSIMD__ThreadEntry, start) == 0;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ThreadJoin(RaylibSIMD__Thread *thread)
+{
+    pthread_join(thread->handle, NULL);
+}
+#endif
+
+typedef struct
+{
+    bool                    initialised;
+    RaylibSIMD__Mutex       submit_mutex; // Held by the thread that owns the pool for the current job
+    RaylibSIMD__Mutex       mutex;        // Guards everything below
+    RaylibSIMD__Condition   work_available;
+    RaylibSIMD__Condition   work_done;
+    bool                    shutdown;
+    uint64_t                generation;   // Incremented for every job so sleeping workers know to wake up
+    RaylibSIMD__TaskProc   *proc;
+    void                   *user_data;
+    int                     task_count;
+    int                     next_task;
+    int                     tasks_done;
+    int                     thread_count; // Worker threads, excluding the thread submitting the job
+    RaylibSIMD__Thread      threads[RS_MAX_WORKERS];
+    RaylibSIMD__ThreadStart thread_start;
+} RaylibSIMD__WorkerPool;
+
+RS_FILE_SCOPE RaylibSIMD__WorkerPool RaylibSIMD__worker_pool;
+
+// NOTE: Expects pool->mutex to be held, it's released while each task runs.
+RS_FILE_SCOPE void RaylibSIMD__RunPendingTasks(RaylibSIMD__WorkerPool *pool)
+{
+    while (pool->next_task < pool->task_count)
+    {
+        int const task_index         = pool->next_task++;
+        RaylibSIMD__TaskProc *proc   = pool->proc;
+        void *user_data              = pool->user_data;
+        RaylibSIMD__MutexUnlock(&pool->mutex);
+        proc(user_data, task_index);
+        RaylibSIMD__MutexLock(&pool->mutex);
+        if (++pool->tasks_done == pool->task_count) RaylibSIMD__ConditionBroadcast(&pool->work_done);
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__WorkerLoop(void *user_data)
+{
+    RaylibSIMD__WorkerPool *pool = RS_CAST(RaylibSIMD__WorkerPool *)user_data;
+    RaylibSIMD__MutexLock(&pool->mutex);
+    uint64_t generation = pool->generation;
+    for (;;)
+    {
+        while (!pool->shutdown && pool->generation == generation)
+            RaylibSIMD__ConditionWait(&pool->work_available, &pool->mutex);
+
+        if (pool->shutdown) break;
+        generation = pool->generation;
+        RaylibSIMD__RunPendingTasks(pool);
+    }
+    RaylibSIMD__MutexUnlock(&pool->mutex);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__StopWorkers(RaylibSIMD__WorkerPool *pool)
+{
+    if (!pool->initialised) return;
+    RaylibSIMD__MutexLock(&pool->mutex);
+    pool->shutdown = true;
+    RaylibSIMD__ConditionBroadcast(&pool->work_available);
+    RaylibSIMD__MutexUnlock(&pool->mutex);
+
+    for (int index = 0; index < pool->thread_count; index++)
+        RaylibSIMD__ThreadJoin(pool->threads + index);
+
+    pool->thread_count = 0;
+    pool->shutdown     = false;
+}
+#endif // !defined(RAYLIB_SIMD_NO_THREADS)
+
+// NOTE: Run every task of a job, spread over the worker pool when it's
+// running. Falls back to the calling thread when the pool is busy with another
+// job (another thread drawing, or a task that itself draws).
+RS_FILE_SCOPE void RaylibSIMD__RunTasks(RaylibSIMD__TaskProc *proc, void *user_data, int task_count)
+{
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    RaylibSIMD__WorkerPool *pool = &RaylibSIMD__worker_pool;
+    if (task_count > 1 && pool->thread_count > 0 && RaylibSIMD__MutexTryLock(&pool->submit_mutex))
+    {
+        RaylibSIMD__MutexLock(&pool->mutex);
+        pool->proc       = proc;
+        pool->user_data  = user_data;
+        pool->task_count = task_count;
+        pool->next_task  = 0;
+        pool->tasks_done = 0;
+        pool->generation++;
+        RaylibSIMD__ConditionBroadcast(&pool->work_available);
+
+        RaylibSIMD__RunPendingTasks(pool);
+        while (pool->tasks_done < pool->task_count)
+            RaylibSIMD__ConditionWait(&pool->work_done, &pool->mutex);
+
+        RaylibSIMD__MutexUnlock(&pool->mutex);
+        RaylibSIMD__MutexUnlock(&pool->submit_mutex);
+        return;
+    }
+#endif
+
+    for (int task_index = 0; task_index < task_count; task_index++)
+        proc(user_data, task_index);
+}
+
+// NOTE: Split the rows of a draw into bands for the worker pool. Bands are
+// kept big enough that waking the workers is paid back, and there are a few
+// per thread so that uneven bands (e.g. mostly transparent rows) even out.
+#define RS_MIN_PIXELS_PER_TASK (64 * 1024)
+RS_FILE_SCOPE int RaylibSIMD__RowsPerTask(int width, int height)
+{
+    int result = height;
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    int const threads = RaylibSIMD__worker_pool.thread_count + 1;
+    if (threads > 1 && width > 0)
+    {
+        int const min_rows = RS_MAX(RS_MIN_PIXELS_PER_TASK / width, 1);
+        int const tasks    = RS_MAX(RS_MIN(height / min_rows, threads * 4), 1);
+        result             = (height + tasks - 1) / tasks;
+    }
+#else
+    (void)width;
+#endif
+    return result;
+}
+
+void RaylibSIMD_SetWorkerCount(int count)
+{
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    RaylibSIMD__WorkerPool *pool = &RaylibSIMD__worker_pool;
+    if (count < 1) count = RaylibSIMD__ProcessorCount();
+    count = RS_MIN(RS_MAX(count, 1), RS_MAX_WORKERS + 1);
+    if (count - 1 == pool->thread_count) return;
+
+    if (!pool->initialised)
+    {
+        RaylibSIMD__MutexInit(&pool->submit_mutex);
+        RaylibSIMD__MutexInit(&pool->mutex);
+        RaylibSIMD__ConditionInit(&pool->work_available);
+        RaylibSIMD__ConditionInit(&pool->work_done);
+        pool->thread_start.proc      = RaylibSIMD__WorkerLoop;
+        pool->thread_start.user_data = pool;
+        pool->initialised            = true;
+    }
+
+    RaylibSIMD__StopWorkers(pool);
+    for (int index = 0; index < count - 1; index++)
+    {
+        if (!RaylibSIMD__ThreadCreate(pool->threads + index, &pool->thread_start))
+        {
+            TRACELOG(LOG_WARNING, "Failed to start RaylibSIMD worker thread, using %d worker(s)", index + 1);
+            break;
+        }
+        pool->thread_count++;
+    }
+#else
+    if (count != 1) TRACELOG(LOG_WARNING, "RaylibSIMD compiled with RAYLIB_SIMD_NO_THREADS, draws stay on the calling thread");
+#endif
+}
+
+int RaylibSIMD_GetWorkerCount(void)
+{
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    return RaylibSIMD__worker_pool.thread_count + 1;
+#else
+    return 1;
+#endif
+}
+
+// NOTE: Memory a call only needs while it runs (filter rings, mipmap rows,
+// block strips) and scratch images come from a small pool instead of being
+// allocated and freed every time, which for large buffers also means fresh
+// pages faulted in on every call. Blocks start on a cache line and the rows
+// carved out of them are padded to whole lines with RS_ALIGN_UP, so that no
+// row shares or straddles one. Returned blocks are kept while there is a free
+// slot and they fit in RS_SCRATCH_POOL_BYTES, until RaylibSIMD_ReleaseScratch.
+#define RS_CACHE_LINE         64
+#define RS_ALIGN_UP(size)     ((RS_CAST(size_t)(size) + RS_CACHE_LINE - 1) & ~RS_CAST(size_t)(RS_CACHE_LINE - 1))
+#define RS_SCRATCH_POOL_SLOTS 32
+#define RS_SCRATCH_POOL_BYTES (64 * 1024 * 1024)
+
+// NOTE: Stored just before each block
+typedef struct
+{
+    void  *allocation;
+    size_t capacity;
+} RaylibSIMD__ScratchHeader;
+
+typedef struct
+{
+    void             *blocks[RS_SCRATCH_POOL_SLOTS];
+    int               block_count;
+    size_t            bytes;
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    RaylibSIMD__Mutex mutex;
+#endif
+} RaylibSIMD__ScratchPool;
+
+#if !defined(RAYLIB_SIMD_NO_THREADS)
+    #if defined(_WIN32)
+        RS_FILE_SCOPE RaylibSIMD__ScratchPool RaylibSIMD__scratch_pool = {{NULL}, 0, 0, {NULL}};
+    #else
+        RS_FILE_SCOPE RaylibSIMD__ScratchPool RaylibSIMD__scratch_pool = {{NULL}, 0, 0, {PTHREAD_MUTEX_INITIALIZER}};
+    #endif
+    #define RS_SCRATCH_LOCK()   RaylibSIMD__MutexLock(&RaylibSIMD__scratch_pool.mutex)
+    #define RS_SCRATCH_UNLOCK() RaylibSIMD__MutexUnlock(&RaylibSIMD__scratch_pool.mutex)
+#else
+    RS_FILE_SCOPE RaylibSIMD__ScratchPool RaylibSIMD__scratch_pool;
+    #define RS_SCRATCH_LOCK()
+    #define RS_SCRATCH_UNLOCK()
+#endif
+
+RS_FILE_SCOPE RaylibSIMD__ScratchHeader *RaylibSIMD__GetScratchHeader(void *block)
+{
+    RaylibSIMD__ScratchHeader *result = RS_CAST(RaylibSIMD__ScratchHeader *)(RS_CAST(unsigned char *)block - sizeof(RaylibSIMD__ScratchHeader));
+    return result;
+}
+
+// NOTE: The smallest kept block that fits, or a new one. Returns NULL when out
+// of memory.
+RS_FILE_SCOPE void *RaylibSIMD__ScratchAlloc(size_t size)
+{
+    RaylibSIMD__ScratchPool *pool = &RaylibSIMD__scratch_pool;
+    void *result                  = NULL;
+    RS_SCRATCH_LOCK();
+    int best = -1;
+    for (int index = 0; index < pool->block_count; index++)
+    {
+        size_t const capacity = RaylibSIMD__GetScratchHeader(pool->blocks[index])->capacity;
+        if ((capacity >= size) && ((best < 0) || (capacity < RaylibSIMD__GetScratchHeader(pool->blocks[best])->capacity))) best = index;
+    }
+    if (best >= 0)
+    {
+        result             = pool->blocks[best];
+        pool->bytes       -= RaylibSIMD__GetScratchHeader(result)->capacity;
+        pool->blocks[best] = pool->blocks[--pool->block_count];
+    }
+    RS_SCRATCH_UNLOCK();
+    if (result) return result;
+
+    size_t const capacity     = RS_ALIGN_UP(RS_MAX(size, 1));
+    unsigned char *allocation = RS_CAST(unsigned char *)RL_MALLOC(capacity + sizeof(RaylibSIMD__ScratchHeader) + RS_CACHE_LINE);
+    if (!allocation) return NULL;
+
+    result                               = RS_CAST(void *)RS_ALIGN_UP(RS_CAST(uintptr_t)allocation + sizeof(RaylibSIMD__ScratchHeader));
+    RaylibSIMD__GetScratchHeader(result)->allocation = allocation;
+    RaylibSIMD__GetScratchHeader(result)->capacity   = capacity;
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ScratchFree(void *block)
+{
+    if (!block) return;
+    RaylibSIMD__ScratchPool *pool            = &RaylibSIMD__scratch_pool;
+    RaylibSIMD__ScratchHeader const *header = RaylibSIMD__GetScratchHeader(block);
+    RS_SCRATCH_LOCK();
+    bool const keep = (pool->block_count < RS_SCRATCH_POOL_SLOTS) && (pool->bytes + header->capacity <= RS_SCRATCH_POOL_BYTES);
+    if (keep)
+    {
+        pool->blocks[pool->block_count++] = block;
+        pool->bytes                      += header->capacity;
+    }
+    RS_SCRATCH_UNLOCK();
+    if (!keep) RL_FREE(header->allocation);
+}
+
+void RaylibSIMD_ReleaseScratch(void)
+{
+    RaylibSIMD__ScratchPool *pool = &RaylibSIMD__scratch_pool;
+    void *blocks[RS_SCRATCH_POOL_SLOTS];
+    RS_SCRATCH_LOCK();
+    int const block_count = pool->block_count;
+    memcpy(blocks, pool->blocks, block_count * sizeof(void *));
+    pool->block_count = 0;
+    pool->bytes       = 0;
+    RS_SCRATCH_UNLOCK();
+    for (int index = 0; index < block_count; index++) RL_FREE(RaylibSIMD__GetScratchHeader(blocks[index])->allocation);
+}
+
+// NOTE: Image data allocated here is freed by raylib's UnloadImage with
+// RL_FREE, so it can only be aligned by an allocator whose memory RL_FREE
+// accepts. posix_memalign's is freed by free(), raylib's default RL_FREE, which
+// is why RaylibSIMD_SetImageAlignment is opt-in. Windows has no equivalent,
+// _aligned_malloc needs _aligned_free.
+RS_FILE_SCOPE size_t RaylibSIMD__image_alignment;
+
+RS_FILE_SCOPE void *RaylibSIMD__ImageAlloc(size_t size)
+{
+#if !defined(_WIN32)
+    if (RaylibSIMD__image_alignment)
+    {
+        void *result = NULL;
+        if (posix_memalign(&result, RaylibSIMD__image_alignment, RS_MAX(size, 1)) != 0) result = NULL;
+        return result;
+    }
+#endif
+    return RL_MALLOC(size);
+}
+
+void RaylibSIMD_SetImageAlignment(int alignment)
+{
+    if ((alignment < 0) || (alignment & (alignment - 1)))
+    {
+        TRACELOG(LOG_WARNING, "Image alignment %d is not a power of 2", alignment);
+        return;
+    }
+#if defined(_WIN32)
+    if (alignment > 0) TRACELOG(LOG_WARNING, "Image alignment is not supported on Windows, RL_FREE can't free aligned memory");
+#else
+    RaylibSIMD__image_alignment = (alignment > 0) ? RS_MAX(RS_CAST(size_t)alignment, sizeof(void *)) : 0;
+#endif
+}
+
+RS_FILE_SCOPE uint32_t RaylibSIMD__ColorToU32(Color color)
+{
+    uint32_t result = (RS_CAST(uint32_t) color.r << 0) |
+                      (RS_CAST(uint32_t) color.g << 8) |
+                      (RS_CAST(uint32_t) color.b << 16) |
+                      (RS_CAST(uint32_t) color.a << 24);
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__SoftwareBlendPixel(unsigned char const *src_ptr, unsigned char *dest_ptr, Color tint, float src_alpha_min)
+{
+    float const INV_255 = 1.f / 255.f;
+    uint32_t src_pixel  = *RS_CAST(uint32_t *)src_ptr;
+    uint32_t dest_pixel = *RS_CAST(uint32_t *)dest_ptr;
+    float src_r = RS_CAST(float)((src_pixel >> 0) & 0xFF);
+    float src_g = RS_CAST(float)((src_pixel >> 8) & 0xFF);
+    float src_b = RS_CAST(float)((src_pixel >> 16) & 0xFF);
+    float src_a = RS_CAST(float)((src_pixel >> 24) & 0xFF);
+    src_a       = RS_MAX(src_a, src_alpha_min);
+
+    float dest_r = RS_CAST(float)((dest_pixel >> 0) & 0xFF);
+    float dest_g = RS_CAST(float)((dest_pixel >> 8) & 0xFF);
+    float dest_b = RS_CAST(float)((dest_pixel >> 16) & 0xFF);
+    float dest_a = RS_CAST(float)((dest_pixel >> 24) & 0xFF);
+
+    float src_r01 = src_r * INV_255;
+    float src_g01 = src_g * INV_255;
+    float src_b01 = src_b * INV_255;
+    float src_a01 = src_a * INV_255;
+
+    float tint_r01  = tint.r * INV_255;
+    float tint_g01  = tint.g * INV_255;
+    float tint_b01  = tint.b * INV_255;
+    float tint_a01  = tint.a * INV_255;
+
+    float src_tint_r01 = tint_r01 * src_r01;
+    float src_tint_g01 = tint_g01 * src_g01;
+    float src_tint_b01 = tint_b01 * src_b01;
+    float src_tint_a01 = tint_a01 * src_a01;
+
+    float dest_r01 = dest_r * INV_255;
+    float dest_g01 = dest_g * INV_255;
+    float dest_b01 = dest_b * INV_255;
+    float dest_a01 = dest_a * INV_255;
+
+    float blend_a01     = src_tint_a01 + dest_a01 * (1.0f - src_tint_a01);
+    float inv_blend_a01 = 1.f / blend_a01;
+
+    float blend_r01 = ((src_tint_r01 * src_tint_a01) + (dest_r01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
+    float blend_g01 = ((src_tint_g01 * src_tint_a01) + (dest_g01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
+    float blend_b01 = ((src_tint_b01 * src_tint_a01) + (dest_b01 * dest_a01 * (1.f - src_tint_a01))) * inv_blend_a01;
+
+    float blend_a = blend_a01 * 255.f;
+    float blend_r = blend_r01 * 255.f;
+    float blend_g = blend_g01 * 255.f;
+    float blend_b = blend_b01 * 255.f;
+
+    unsigned char blend_r255 = RS_CAST(unsigned char)blend_r;
+    unsigned char blend_g255 = RS_CAST(unsigned char)blend_g;
+    unsigned char blend_b255 = RS_CAST(unsigned char)blend_b;
+    unsigned char blend_a255 = RS_CAST(unsigned char)blend_a;
+
+    uint32_t blend_pixel = (RS_CAST(uint32_t)blend_r255 & 0xFF) << 0 |
+                            (RS_CAST(uint32_t)blend_g255 & 0xFF) << 8 |
+                            (RS_CAST(uint32_t)blend_b255 & 0xFF) << 16 |
+                            (RS_CAST(uint32_t)blend_a255 & 0xFF) << 24;
+    *(RS_CAST(uint32_t *)dest_ptr) = blend_pixel;
+}
+
+// NOTE: Reference for RaylibSIMD_BlendPrecision_Fixed16, the SIMD kernels
+// produce bit-identical results. Straight alpha Porter-Duff "over" evaluated
+// in integers with 8 bit inputs, where
+//
+//   div255(x) = ((x + 128) * 257) >> 16   Exactly round(x / 255) for x in [0, 255 * 255]
+//
+//   src_c     = div255(src_c * tint_c)
+//   src_a     = div255(src_a * tint_a)
+//   blend_a   = src_a + div255(dest_a * (255 - src_a))
+//
+// The stored alpha is rounded to 8 bits but the color weights are not: a
+// weight rounded to 8 bits is up to half an alpha step off, which for a faint
+// source over a faint dest moves the color by 2 LSB. They are kept in 1/16
+// alpha steps (255 * 16 = 4080 for opaque) instead,
+//
+//   src_w     = ((src_a * tint_a + 8) * 4112) >> 16          ~round(src_a * tint_a * 16 / 255)
+//   dest_w    = (2 * (4080 - src_w) * ((dest_a * 257 + 2) >> 2) + 16384) >> 15
+//                                                            ~round(dest_a * (4080 - src_w) / 255)
+//   blend_w   = src_w + dest_w
+//   blend_c   = (2 * (src_c * src_w + dest_c * dest_w) + blend_w) / (2 * blend_w)
+//
+// i.e. the color is the weighted average rounded half up, and 0 when the
+// weights are 0. Both weights are exact for opaque and transparent inputs and
+// fit the 16 bit multiplies of the kernels. The numerator never exceeds
+// 255 * blend_w so the result fits in 8 bits without clamping.
+RS_FILE_SCOPE uint32_t RaylibSIMD__Div255(uint32_t x)
+{
+    uint32_t result = ((x + 128) * 257) >> 16;
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BlendPixelFixed16(unsigned char const *src_ptr, unsigned char *dest_ptr, Color tint)
+{
+    uint32_t src_at = src_ptr[3] * RS_CAST(uint32_t)tint.a;
+    uint32_t src_a  = RaylibSIMD__Div255(src_at);
+    uint32_t src_r  = RaylibSIMD__Div255(src_ptr[0] * RS_CAST(uint32_t)tint.r);
+    uint32_t src_g  = RaylibSIMD__Div255(src_ptr[1] * RS_CAST(uint32_t)tint.g);
+    uint32_t src_b  = RaylibSIMD__Div255(src_ptr[2] * RS_CAST(uint32_t)tint.b);
+    uint32_t blend_a = src_a + RaylibSIMD__Div255(dest_ptr[3] * (255 - src_a));
+
+    uint32_t src_w   = ((src_at + 8) * 4112) >> 16;
+    uint32_t dest_w  = (2 * (4080 - src_w) * ((dest_ptr[3] * 257 + 2) >> 2) + 16384) >> 15;
+    uint32_t blend_w = src_w + dest_w;
+    uint32_t blend_r = 0;
+    uint32_t blend_g = 0;
+    uint32_t blend_b = 0;
+    if (blend_w)
+    {
+        blend_r = (2 * (src_r * src_w + dest_ptr[0] * dest_w) + blend_w) / (2 * blend_w);
+        blend_g = (2 * (src_g * src_w + dest_ptr[1] * dest_w) + blend_w) / (2 * blend_w);
+        blend_b = (2 * (src_b * src_w + dest_ptr[2] * dest_w) + blend_w) / (2 * blend_w);
+    }
+
+    dest_ptr[0] = RS_CAST(unsigned char)blend_r;
+    dest_ptr[1] = RS_CAST(unsigned char)blend_g;
+    dest_ptr[2] = RS_CAST(unsigned char)blend_b;
+    dest_ptr[3] = RS_CAST(unsigned char)blend_a;
+}
+
+// NOTE: Reference for RaylibSIMD_BlendMode_AlphaPremultiplied, the SIMD
+// kernels produce bit-identical results. Source and dest are R8G8B8A8 with the
+// color already multiplied by alpha (see RaylibSIMD_ImageAlphaPremultiply) and
+// the tint has been premultiplied with RaylibSIMD__PremultiplyColor, so "over"
+// needs no divide:
+//
+//   src_c   = div255(src_c * tint_c)                          For r, g, b and a
+//   blend_c = min(255, src_c + div255(dest_c * (255 - src_a))) For r, g, b and a
+RS_FILE_SCOPE Color RaylibSIMD__PremultiplyColor(Color color)
+{
+    Color result = {0};
+    result.r     = RS_CAST(unsigned char)RaylibSIMD__Div255(color.r * RS_CAST(uint32_t)color.a);
+    result.g     = RS_CAST(unsigned char)RaylibSIMD__Div255(color.g * RS_CAST(uint32_t)color.a);
+    result.b     = RS_CAST(unsigned char)RaylibSIMD__Div255(color.b * RS_CAST(uint32_t)color.a);
+    result.a     = color.a;
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BlendPixelPremultiplied(unsigned char const *src_ptr, unsigned char *dest_ptr, Color tint)
+{
+    uint32_t src_a      = RaylibSIMD__Div255(src_ptr[3] * RS_CAST(uint32_t)tint.a);
+    uint32_t src_r      = RaylibSIMD__Div255(src_ptr[0] * RS_CAST(uint32_t)tint.r);
+    uint32_t src_g      = RaylibSIMD__Div255(src_ptr[1] * RS_CAST(uint32_t)tint.g);
+    uint32_t src_b      = RaylibSIMD__Div255(src_ptr[2] * RS_CAST(uint32_t)tint.b);
+    uint32_t inv_src_a  = 255 - src_a;
+
+    dest_ptr[0] = RS_CAST(unsigned char)RS_MIN(255, src_r + RaylibSIMD__Div255(dest_ptr[0] * inv_src_a));
+    dest_ptr[1] = RS_CAST(unsigned char)RS_MIN(255, src_g + RaylibSIMD__Div255(dest_ptr[1] * inv_src_a));
+    dest_ptr[2] = RS_CAST(unsigned char)RS_MIN(255, src_b + RaylibSIMD__Div255(dest_ptr[2] * inv_src_a));
+    dest_ptr[3] = RS_CAST(unsigned char)RS_MIN(255, src_a + RaylibSIMD__Div255(dest_ptr[3] * inv_src_a));
+}
+
+// NOTE: Reference for the straight alpha color modes (RaylibSIMD_BlendMode_Additive
+// and after), the SIMD kernels produce bit-identical results. Every product is
+// of two 8 bit values, or a sum of two whose weights add up to 255, so each
+// step is one div255 on 16 bits:
+//
+//   src_c = div255(src_c * tint_c)                      For r, g, b and a
+//   sa_c  = div255(src_c * src_a)                       Source color weighted by its alpha
+//
+//   Additive | min(255, dest_c + sa_c)
+//   Subtract | max(0, dest_c - sa_c)
+//   Multiply | div255(dest_c * (255 - src_a + sa_c))
+//   Screen   | 255 - div255((255 - dest_c) * (255 - sa_c))
+//   Min, Max | div255(min/max(src_c, dest_c) * src_a + dest_c * (255 - src_a))
+//   Copy     | src_c
+//
+//   blend_a  = src_a + div255(dest_a * (255 - src_a))   src_a for Copy
+RS_FILE_SCOPE RS_FORCE_INLINE uint32_t RaylibSIMD__BlendChannelMode(RaylibSIMD_BlendMode mode, uint32_t src_c, uint32_t dest_c, uint32_t src_a)
+{
+    uint32_t const sa_c = RaylibSIMD__Div255(src_c * src_a);
+    uint32_t result     = src_c;
+    switch (mode)
+    {
+        default: break;
+        case RaylibSIMD_BlendMode_Additive: result = RS_MIN(255, dest_c + sa_c); break;
+        case RaylibSIMD_BlendMode_Subtract: result = (dest_c > sa_c) ? dest_c - sa_c : 0; break;
+        case RaylibSIMD_BlendMode_Multiply: result = RaylibSIMD__Div255(dest_c * (255 - src_a + sa_c)); break;
+        case RaylibSIMD_BlendMode_Screen:   result = 255 - RaylibSIMD__Div255((255 - dest_c) * (255 - sa_c)); break;
+        case RaylibSIMD_BlendMode_Min:      result = RaylibSIMD__Div255(RS_MIN(src_c, dest_c) * src_a + dest_c * (255 - src_a)); break;
+        case RaylibSIMD_BlendMode_Max:      result = RaylibSIMD__Div255(RS_MAX(src_c, dest_c) * src_a + dest_c * (255 - src_a)); break;
+    }
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BlendPixelMode(unsigned char const *src_ptr, unsigned char *dest_ptr, Color tint, RaylibSIMD_BlendMode mode)
+{
+    uint32_t src_a = RaylibSIMD__Div255(src_ptr[3] * RS_CAST(uint32_t)tint.a);
+    uint32_t src_r = RaylibSIMD__Div255(src_ptr[0] * RS_CAST(uint32_t)tint.r);
+    uint32_t src_g = RaylibSIMD__Div255(src_ptr[1] * RS_CAST(uint32_t)tint.g);
+    uint32_t src_b = RaylibSIMD__Div255(src_ptr[2] * RS_CAST(uint32_t)tint.b);
+
+    dest_ptr[0] = RS_CAST(unsigned char)RaylibSIMD__BlendChannelMode(mode, src_r, dest_ptr[0], src_a);
+    dest_ptr[1] = RS_CAST(unsigned char)RaylibSIMD__BlendChannelMode(mode, src_g, dest_ptr[1], src_a);
+    dest_ptr[2] = RS_CAST(unsigned char)RaylibSIMD__BlendChannelMode(mode, src_b, dest_ptr[2], src_a);
+    dest_ptr[3] = RS_CAST(unsigned char)((mode == RaylibSIMD_BlendMode_Copy) ? src_a : src_a + RaylibSIMD__Div255(dest_ptr[3] * (255 - src_a)));
+}
+
+// NOTE: References for the RaylibSIMD_ImageAlpha(Un)Premultiply kernels,
+// unpremultiply rounds half up and maps alpha 0 to transparent black.
+RS_FILE_SCOPE void RaylibSIMD__PremultiplyPixel(unsigned char *ptr)
+{
+    uint32_t a = ptr[3];
+    ptr[0]     = RS_CAST(unsigned char)RaylibSIMD__Div255(ptr[0] * a);
+    ptr[1]     = RS_CAST(unsigned char)RaylibSIMD__Div255(ptr[1] * a);
+    ptr[2]     = RS_CAST(unsigned char)RaylibSIMD__Div255(ptr[2] * a);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__UnpremultiplyPixel(unsigned char *ptr)
+{
+    uint32_t a = ptr[3];
+    for (int index = 0; index < 3; index++)
+    {
+        uint32_t c = a ? (2 * 255 * ptr[index] + a) / (2 * a) : 0;
+        ptr[index] = RS_CAST(unsigned char)RS_MIN(255, c);
+    }
+}
+
+typedef struct
+{
+    __m128i shuffle;
+    uint8_t r_bit_mask;
+    uint8_t g_bit_mask;
+    uint8_t b_bit_mask;
+    uint8_t a_bit_mask;
+    uint8_t r_bit_shift;
+    uint8_t g_bit_shift;
+    uint8_t b_bit_shift;
+    uint8_t a_bit_shift;
+    float r_to_01_coefficient;
+    float b_to_01_coefficient;
+    float g_to_01_coefficient;
+    float a_to_01_coefficient;
+} RaylibSIMD_PixelPerLaneShuffle;
+
+static RaylibSIMD_PixelPerLaneShuffle RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(int format)
+{
+    RaylibSIMD_PixelPerLaneShuffle result = {0};
+    result.shuffle                        = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    result.r_bit_mask                     = 0xFF;
+    result.g_bit_mask                     = 0xFF;
+    result.b_bit_mask                     = 0xFF;
+    result.a_bit_mask                     = 0xFF;
+    result.r_bit_shift                    = 0;
+    result.g_bit_shift                    = 8;
+    result.b_bit_shift                    = 16;
+    result.a_bit_shift                    = 24;
+    result.r_to_01_coefficient            = 1.f / 255.f;
+    result.g_to_01_coefficient            = 1.f / 255.f;
+    result.b_to_01_coefficient            = 1.f / 255.f;
+    result.a_to_01_coefficient            = 1.f / 255.f;
+
+    switch(format)
+    {
+        default: break;
+
+        // NOTE: We load 4 pixels x 4 colors at a time. But if the
+        // source image is RGB, then the 4th color loaded in each
+        // pixel is going to be the RED component of the next pixel.
+        //
+        // Pixels[] = {RGB, RGB, RGB, RGB, ...}
+        //
+        // For example, naively loading the next pixels in a 3BPP
+        // byte stream, produces in a 128 bit SIMD register
+        //
+        // Pixel    |   1  2     3     4     5  6*
+        // Register | {[RGBR] [GBRG] [BRGB] [RGBR]}
+        //              ^
+        //              |
+        //              +---- This is the start of the 2nd pixel.
+        //
+        // * Note that only the red channel of the 6th pixel gets loaded.
+        //
+        // The 2nd pixel needs to be moved into the SIMD lane.
+        // and so forth for subsequent pixels. We shift the color
+        // channels to correctly set up the SIMD lane, like so.
+        //
+        // Pixel    |   1      2      3      4
+        // Register | {[RGB.] [RGB.] [RGB.] [RGB.]]}
+        //
+        // We do this by shuffling the loaded bits into place
+        // duplicating the red channel and copying onwards. In the
+        // RGBA case, we do a no-op shuffle that preserves positions
+        // of all color components to avoid branches in the blitting
+        // hot path.
+
+        // NOTE: R8G8B8 24bit Pixel
+        // Bits       | 23 22 21 20   19 18 17 16 | 15 14 13 12   11 10 9 8 | 7654 3210
+        // Color Bits |  R  R  R  R    R  R  R  R | G   G  G  G    G  G G G | BBBB BBBB
+        //
+        // A 128bit SIMD register with 4x32bit lanes can store
+        // 1 pixel per register and the red channel of the next
+        // pixel.
+        //
+        // Pixel    |   1  2     3     4     5  6
+        // Register | {[RGBR] [GBRG] [BRGB] [RGBR]}
+        //
+        // Desired layout 1 pixel per 32 bit lane
+        //
+        // Pixel           |   1      2      3      4
+        // Register        | {[RGB.] [RGB.] [RGB.] [RGB.]]}
+        // Bits            |  [0:23] [24:47] [48:71] [72:95]
+        // Bytes (Shuffle) |  [0:2]  [3:5]   [6:8]   [9:11]
+        case UNCOMPRESSED_R8G8B8:
+        {
+            result.shuffle = _mm_setr_epi8(0, 1, 2, 0, // Lane 1
+                                           3, 4, 5, 0,
+                                           6, 7, 8, 0,
+                                           9, 10, 11, 0);
+        }
+        break;
+
+        // NOTE: RGBA4444 16bit Pixel
+        // Bits       | 15 14 13 12 | 11 10 98 | 7654 | 3210
+        // Color Bits |  R  R  R  R | G   G GG | BBBB | AAAA
+        //
+        // A 128bit SIMD register with 4x32bit lanes can store
+        // 2 pixels per register.
+        //
+        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
+        //
+        // See UNCOMPRESSED_R8G8B8 for reason for shuffle.
+        // Desired layout 1 pixel per 32 bit lane
+        //
+        // Register        | {[P1]   [P2]    [P3]    [P4]}
+        // Bits            |  [0:15] [16:31] [32:46] [46:61]
+        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
+                                           2, 3, 2, 3,
+                                           4, 5, 4, 5,
+                                           6, 7, 6, 7);
+            result.r_bit_mask = 0b1111;
+            result.g_bit_mask = 0b1111;
+            result.b_bit_mask = 0b1111;
+            result.a_bit_mask = 0b1111;
+
+            result.r_bit_shift = 12;
+            result.g_bit_shift = 8;
+            result.b_bit_shift = 4;
+            result.a_bit_shift = 0;
+
+            result.r_to_01_coefficient = 1.f/15.f;
+            result.g_to_01_coefficient = 1.f/15.f;
+            result.b_to_01_coefficient = 1.f/15.f;
+            result.a_to_01_coefficient = 1.f/15.f;
+        }
+        break;
+
+        // NOTE: RGB565 16bit Pixel
+        // Bits       | 15 14 13 12 11 | 10 98765 | 43210
+        // Color Bits |  R  R  R  R  R | G  GGGGG | BBBBB
+        //
+        // A 128bit SIMD register with 4x32bit lanes can store
+        // 2 pixels per register.
+        //
+        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
+        //
+        // See UNCOMPRESSED_R8G8B8 for reason for shuffle.
+        // Desired layout 1 pixel per 32 bit lane
+        //
+        // Register        | {[P1]   [P2]    [P3]    [P4]}
+        // Bits            |  [0:15] [16:31] [32:46] [46:61]
+        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
+        case UNCOMPRESSED_R5G6B5:
+        {
+            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
+                                           2, 3, 2, 3,
+                                           4, 5, 4, 5,
+                                           6, 7, 6, 7);
+            result.r_bit_mask = 0b011111;
+            result.g_bit_mask = 0b111111;
+            result.b_bit_mask = 0b011111;
+
+            result.r_bit_shift = 11;
+            result.g_bit_shift = 5;
+            result.b_bit_shift = 0;
+
+            result.r_to_01_coefficient = 1.f/31.f;
+            result.g_to_01_coefficient = 1.f/63.f;
+            result.b_to_01_coefficient = 1.f/31.f;
+        }
+        break;
+
+        // NOTE: RGBA5551 16bit Pixel
+        // Bits       | 15 14 13 12 11 | 10 9876 | 54321 | 0
+        // Color Bits |  R  R  R  R  R | G  GGGG | BBBBB | A
+        //
+        // A 128bit SIMD register with 4x32bit lanes can store
+        // 2 pixels per register.
+        //
+        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
+        //
         // See UNCOMPRESSED_R8G8B8 for reason for shuffle.
         // Desired layout 1 pixel per 32 bit lane
         //
-        // Register        | {[P1]   [P2]    [P3]    [P4]}
-        // Bits            |  [0:15] [16:31] [32:46] [46:61]
-        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
+        // Register        | {[P1]   [P2]    [P3]    [P4]}
+        // Bits            |  [0:15] [16:31] [32:46] [46:61]
+        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
+                                           2, 3, 2, 3,
+                                           4, 5, 4, 5,
+                                           6, 7, 6, 7);
+            result.r_bit_mask = 0b11111;
+            result.g_bit_mask = 0b11111;
+            result.b_bit_mask = 0b11111;
+            result.a_bit_mask = 0b00001;
+
+            result.r_bit_shift = 11;
+            result.g_bit_shift = 6;
+            result.b_bit_shift = 1;
+            result.a_bit_shift = 0;
+
+            result.r_to_01_coefficient = 1.f/31.f;
+            result.g_to_01_coefficient = 1.f/31.f;
+            result.b_to_01_coefficient = 1.f/31.f;
+            result.a_to_01_coefficient = 1.f;
+        }
+        break;
+
+        // NOTE: GRAYSCALE 8bit Pixel
+        // A 128bit SIMD register with 4x32bit lanes can store
+        // 4 pixels per lane.
+        //
+        // Register   | {[P1, P2, P3, P4] [P5, P6, P7, P8] ..}
+        //
+        // Desired layout 1 pixel per 32 bit lane, zero extended.
+        // R, G and B all read the gray value, so a blend whose R,
+        // G and B are equal (see RaylibSIMD__BlendParams dest_gray)
+        // packs back into the low byte. The alpha byte is zero and
+        // raised by the alpha minimum.
+        //
+        // Register        | {[P1...] [P2...] [P3...] [P4...]}
+        // Bytes (Shuffle) |  [0]     [1]     [2]     [3]
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            result.shuffle = _mm_setr_epi8(0, -1, -1, -1, // Lane 1
+                                           1, -1, -1, -1,
+                                           2, -1, -1, -1,
+                                           3, -1, -1, -1);
+            result.g_bit_shift = 0;
+            result.b_bit_shift = 0;
+        }
+        break;
+
+        // NOTE: GRAY_ALPHA 16bit Pixel
+        // Bits       | 15 14 13 12 11 10 9 8 | 7654 3210
+        // Color Bits |  A  A  A  A  A  A A A | YYYY YYYY
+        //
+        // See UNCOMPRESSED_GRAYSCALE, the alpha byte sits above the
+        // gray value.
+        //
+        // Register        | {[YA..] [YA..] [YA..] [YA..]}
+        // Bytes (Shuffle) |  [0:1]  [2:3]  [4:5]  [6:7]
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            result.shuffle = _mm_setr_epi8(0, 1, -1, -1, // Lane 1
+                                           2, 3, -1, -1,
+                                           4, 5, -1, -1,
+                                           6, 7, -1, -1);
+            result.g_bit_shift = 0;
+            result.b_bit_shift = 0;
+            result.a_bit_shift = 8;
+        }
+        break;
+    }
+
+    return result;
+}
+
+RS_FILE_SCOPE int RaylibSIMD__FormatToBitsPerPixel(int format)
+{
+    int result = 4;
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE: result = 8; break;
+        case UNCOMPRESSED_GRAY_ALPHA:
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4: result = 16; break;
+        case UNCOMPRESSED_R8G8B8A8: result = 32; break;
+        case UNCOMPRESSED_R8G8B8: result = 24; break;
+        case UNCOMPRESSED_R32: result = 32; break;
+        case UNCOMPRESSED_R32G32B32: result = 32*3; break;
+        case UNCOMPRESSED_R32G32B32A32: result = 32*4; break;
+        case COMPRESSED_DXT1_RGB:
+        case COMPRESSED_DXT1_RGBA:
+        case COMPRESSED_ETC1_RGB:
+        case COMPRESSED_ETC2_RGB:
+        case COMPRESSED_PVRT_RGB:
+        case COMPRESSED_PVRT_RGBA: result = 4; break;
+        case COMPRESSED_DXT3_RGBA:
+        case COMPRESSED_DXT5_RGBA:
+        case COMPRESSED_ETC2_EAC_RGBA:
+        case COMPRESSED_ASTC_4x4_RGBA: result = 8; break;
+        case COMPRESSED_ASTC_8x8_RGBA: result = 2; break;
+        default: break;
+    }
+
+    return result;
+}
+
+typedef struct
+{
+    RaylibSIMD_PixelPerLaneShuffle src_lanes;
+    RaylibSIMD_PixelPerLaneShuffle dest_lanes;
+    int   src_bytes_per_pixel;
+    int   dest_bytes_per_pixel;
+    float src_alpha_min;
+    float dest_alpha_min;
+    float tint_r01;
+    float tint_g01;
+    float tint_b01;
+    float tint_a01;
+    Color tint;
+    bool  dest_gray; // Tinted source colors are reduced to luminance, see RaylibSIMD__EncodePixel
+    int   src_format;
+    int   dest_format;
+    float encode_bias; // Added to blended channels so truncating encoders round, see RaylibSIMD__BlendPixelChannels
+} RaylibSIMD__BlendParams;
+
+// NOTE: Blends as many pixels of the row as fit in whole SIMD iterations and
+// returns the count blended. The caller finishes the remaining pixels.
+typedef int RaylibSIMD__BlendRowProc(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params);
+
+// NOTE: Every group of 4 pixels is read with a 16 byte load, which reaches past
+// the 4th pixel for formats narrower than 32 bits, i.e. 2 more R8G8B8 pixels
+// or 4 more 16 bit pixels. Iterations whose loads would leave the span are left
+// to the caller.
+RS_FILE_SCOPE int RaylibSIMD__BlendRowOverRead(RaylibSIMD__BlendParams const *params)
+{
+    int const src_over_read  = (16 + params->src_bytes_per_pixel - 1) / params->src_bytes_per_pixel - 4;
+    int const dest_over_read = (16 + params->dest_bytes_per_pixel - 1) / params->dest_bytes_per_pixel - 4;
+    int const result         = RS_MAX(RS_MAX(src_over_read, dest_over_read), 0);
+    return result;
+}
+
+RS_FILE_SCOPE int RaylibSIMD__BlendRowIterations(int pixels, int pixels_per_iteration, RaylibSIMD__BlendParams const *params)
+{
+    int const safe_pixels = pixels - RaylibSIMD__BlendRowOverRead(params);
+    int result            = (safe_pixels > 0) ? (safe_pixels / pixels_per_iteration) : 0;
+    return result;
+}
+
+// NOTE: Stores 4 blended pixels, 1 per 32 bit lane, at the destination's
+// pixel size. R8G8B8 drops the 4th byte of every lane, 16 bit formats drop the
+// upper half (which holds the unused alpha of R5G6B5) and GRAYSCALE keeps the
+// low byte.
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__StorePixels4x_SSE41(unsigned char *dest, __m128i pixels_4x, int dest_bytes_per_pixel)
+{
+    switch (dest_bytes_per_pixel)
+    {
+        case 4: _mm_storeu_si128((__m128i *)dest, pixels_4x); break;
+
+        case 3:
+        {
+            __m128i const pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+            __m128i packed     = _mm_shuffle_epi8(pixels_4x, pack);
+            uint32_t const pixel_3 = RS_CAST(uint32_t)_mm_extract_epi32(packed, 2);
+            _mm_storel_epi64((__m128i *)dest, packed);
+            memcpy(dest + 8, &pixel_3, sizeof(pixel_3));
+        }
+        break;
+
+        case 2:
+        {
+            __m128i packed = _mm_packus_epi32(_mm_and_si128(pixels_4x, _mm_set1_epi32(0xFFFF)), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)dest, packed);
+        }
+        break;
+
+        case 1:
+        {
+            __m128i const pack    = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            uint32_t const packed = RS_CAST(uint32_t)_mm_cvtsi128_si32(_mm_shuffle_epi8(pixels_4x, pack));
+            memcpy(dest, &packed, sizeof(packed));
+        }
+        break;
+    }
+}
+
+// NOTE: Scalar equivalent of RaylibSIMD__BlendRow_SSE41 for the pixels left
+// over by the kernels. Unlike RaylibSIMD__SoftwareBlendPixel it reads and
+// writes any of the SIMD formats through the lane layout and rounds like
+// _mm_cvtps_epi32.
+RS_FILE_SCOPE void RaylibSIMD__BlendPixelLanes(unsigned char const *src_ptr, unsigned char *dest_ptr, RaylibSIMD__BlendParams const *params)
+{
+    RaylibSIMD_PixelPerLaneShuffle const *src_lanes  = &params->src_lanes;
+    RaylibSIMD_PixelPerLaneShuffle const *dest_lanes = &params->dest_lanes;
+
+    uint32_t src_pixel  = 0;
+    uint32_t dest_pixel = 0;
+    memcpy(&src_pixel, src_ptr, params->src_bytes_per_pixel);
+    memcpy(&dest_pixel, dest_ptr, params->dest_bytes_per_pixel);
+
+    float src_r01  = RS_CAST(float)((src_pixel >> src_lanes->r_bit_shift) & src_lanes->r_bit_mask) * src_lanes->r_to_01_coefficient * params->tint_r01;
+    float src_g01  = RS_CAST(float)((src_pixel >> src_lanes->g_bit_shift) & src_lanes->g_bit_mask) * src_lanes->g_to_01_coefficient * params->tint_g01;
+    float src_b01  = RS_CAST(float)((src_pixel >> src_lanes->b_bit_shift) & src_lanes->b_bit_mask) * src_lanes->b_to_01_coefficient * params->tint_b01;
+    float src_a    = RS_CAST(float)((src_pixel >> src_lanes->a_bit_shift) & src_lanes->a_bit_mask);
+    float src_a01  = RS_MAX(src_a, params->src_alpha_min) * src_lanes->a_to_01_coefficient * params->tint_a01;
+    if (params->dest_gray)
+    {
+        src_r01 = src_g01 = src_b01 = src_r01 * 0.299f + src_g01 * 0.587f + src_b01 * 0.114f;
+    }
+
+    float dest_r01 = RS_CAST(float)((dest_pixel >> dest_lanes->r_bit_shift) & dest_lanes->r_bit_mask) * dest_lanes->r_to_01_coefficient;
+    float dest_g01 = RS_CAST(float)((dest_pixel >> dest_lanes->g_bit_shift) & dest_lanes->g_bit_mask) * dest_lanes->g_to_01_coefficient;
+    float dest_b01 = RS_CAST(float)((dest_pixel >> dest_lanes->b_bit_shift) & dest_lanes->b_bit_mask) * dest_lanes->b_to_01_coefficient;
+    float dest_a   = RS_CAST(float)((dest_pixel >> dest_lanes->a_bit_shift) & dest_lanes->a_bit_mask);
+    float dest_a01 = RS_MAX(dest_a, params->dest_alpha_min) * dest_lanes->a_to_01_coefficient;
+
+    float dest_weight   = dest_a01 * (1.f - src_a01);
+    float blend_a01     = src_a01 + dest_weight;
+    float inv_blend_a01 = 1.f / RS_MAX(blend_a01, 1.f / 65536.f);
+    float blend_r01     = (src_r01 * src_a01 + dest_r01 * dest_weight) * inv_blend_a01;
+    float blend_g01     = (src_g01 * src_a01 + dest_g01 * dest_weight) * inv_blend_a01;
+    float blend_b01     = (src_b01 * src_a01 + dest_b01 * dest_weight) * inv_blend_a01;
+
+    uint32_t blend_r = RS_CAST(uint32_t)(blend_r01 / dest_lanes->r_to_01_coefficient + 0.5f);
+    uint32_t blend_g = RS_CAST(uint32_t)(blend_g01 / dest_lanes->g_to_01_coefficient + 0.5f);
+    uint32_t blend_b = RS_CAST(uint32_t)(blend_b01 / dest_lanes->b_to_01_coefficient + 0.5f);
+    uint32_t blend_a = RS_CAST(uint32_t)(blend_a01 / dest_lanes->a_to_01_coefficient + 0.5f);
+
+    uint32_t blend_pixel = (RS_MIN(blend_r, dest_lanes->r_bit_mask) << dest_lanes->r_bit_shift) |
+                           (RS_MIN(blend_g, dest_lanes->g_bit_mask) << dest_lanes->g_bit_shift) |
+                           (RS_MIN(blend_b, dest_lanes->b_bit_mask) << dest_lanes->b_bit_shift) |
+                           (RS_MIN(blend_a, dest_lanes->a_bit_mask) << dest_lanes->a_bit_shift);
+    memcpy(dest_ptr, &blend_pixel, params->dest_bytes_per_pixel);
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__BlendRow_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    // NOTE: The general approach to SIMD the drawing loop is to
+    // pull out each pixel into each available f32 SIMD lane to
+    // do color blends in a [0, 1] 32 bit float space.
+    // For example a __m128 consists of 4x32 bit lanes.
+    //
+    // SIMD Register
+    // {[Pixel1] [Pixel2] [Pixel3] [Pixel4]}
+    //
+    // Followed by pulling each color component from pixels 1, 2,
+    // 3 and 4 into a SIMD lane to perform the color blend.
+    //
+    // {[R1] [R2] [R3] [R4]} Register 1
+    // {[G1] [G2] [G3] [G4]}    ..
+    // {[B1] [B2] [B3] [B4]}    ..
+    // {[A1] [A2] [A3] [A4]}    ..
+    //
+    // We collate the same colors of each pixel into the lanes
+    // because the required blend equation is the same across the
+    // same color components.
+    RaylibSIMD_PixelPerLaneShuffle const *src_lanes  = &params->src_lanes;
+    RaylibSIMD_PixelPerLaneShuffle const *dest_lanes = &params->dest_lanes;
+
+    __m128 const tint_r01_4x        = _mm_set1_ps(params->tint_r01);
+    __m128 const tint_g01_4x        = _mm_set1_ps(params->tint_g01);
+    __m128 const tint_b01_4x        = _mm_set1_ps(params->tint_b01);
+    __m128 const tint_a01_4x        = _mm_set1_ps(params->tint_a01);
+    __m128 const one_4x             = _mm_set1_ps(1.f);
+    __m128 const min_blend_a01_4x   = _mm_set1_ps(1.f / 65536.f);
+    __m128 const luma_r_4x          = _mm_set1_ps(0.299f);
+    __m128 const luma_g_4x          = _mm_set1_ps(0.587f);
+    __m128 const luma_b_4x          = _mm_set1_ps(0.114f);
+
+    __m128 const src_alpha_min_4x   = _mm_set1_ps(params->src_alpha_min);
+    __m128 const dest_alpha_min_4x  = _mm_set1_ps(params->dest_alpha_min);
+    __m128i const src_r_bit_mask    = _mm_set1_epi32(src_lanes->r_bit_mask);
+    __m128i const src_g_bit_mask    = _mm_set1_epi32(src_lanes->g_bit_mask);
+    __m128i const src_b_bit_mask    = _mm_set1_epi32(src_lanes->b_bit_mask);
+    __m128i const src_a_bit_mask    = _mm_set1_epi32(src_lanes->a_bit_mask);
+
+    __m128 const src_r_to_01_coefficient  = _mm_set1_ps(src_lanes->r_to_01_coefficient);
+    __m128 const src_g_to_01_coefficient  = _mm_set1_ps(src_lanes->g_to_01_coefficient);
+    __m128 const src_b_to_01_coefficient  = _mm_set1_ps(src_lanes->b_to_01_coefficient);
+    __m128 const src_a_to_01_coefficient  = _mm_set1_ps(src_lanes->a_to_01_coefficient);
+
+    __m128i const dest_r_bit_mask         = _mm_set1_epi32(dest_lanes->r_bit_mask);
+    __m128i const dest_g_bit_mask         = _mm_set1_epi32(dest_lanes->g_bit_mask);
+    __m128i const dest_b_bit_mask         = _mm_set1_epi32(dest_lanes->b_bit_mask);
+    __m128i const dest_a_bit_mask         = _mm_set1_epi32(dest_lanes->a_bit_mask);
+
+    __m128 const dest_r_to_01_coefficient = _mm_set1_ps(dest_lanes->r_to_01_coefficient);
+    __m128 const dest_g_to_01_coefficient = _mm_set1_ps(dest_lanes->g_to_01_coefficient);
+    __m128 const dest_b_to_01_coefficient = _mm_set1_ps(dest_lanes->b_to_01_coefficient);
+    __m128 const dest_a_to_01_coefficient = _mm_set1_ps(dest_lanes->a_to_01_coefficient);
+
+    __m128 const dest_r01_to_pixel_format_coefficient = _mm_set1_ps(1.f / dest_lanes->r_to_01_coefficient);
+    __m128 const dest_g01_to_pixel_format_coefficient = _mm_set1_ps(1.f / dest_lanes->g_to_01_coefficient);
+    __m128 const dest_b01_to_pixel_format_coefficient = _mm_set1_ps(1.f / dest_lanes->b_to_01_coefficient);
+    __m128 const dest_a01_to_pixel_format_coefficient = _mm_set1_ps(1.f / dest_lanes->a_to_01_coefficient);
+
+    // NOTE: Divide by float because we blend in [0,1] 32 bit float space
+    // Each color component requires 1 SIMD float lane to perform such blend.
+    int const PIXELS_PER_SIMD_WRITE     = sizeof(__m128) / sizeof(float);
+    int const src_bytes_per_simd_write  = PIXELS_PER_SIMD_WRITE * params->src_bytes_per_pixel;
+    int const dest_bytes_per_simd_write = PIXELS_PER_SIMD_WRITE * params->dest_bytes_per_pixel;
+    int const simd_iterations           = RaylibSIMD__BlendRowIterations(pixels, PIXELS_PER_SIMD_WRITE, params);
+
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        unsigned char *dest = dest_ptr;
+
+        // NOTE: Extract Pixels From Buffer
+        __m128i src_pixels_4x           = _mm_loadu_si128((__m128i *)src_ptr);
+        __m128i dest_pixels_4x          = _mm_loadu_si128((__m128i *)dest_ptr);
+
+        // NOTE: Arrange loaded pixels to 1 pixel per lane.
+        __m128i src_pixels_4x_shuffled  = _mm_shuffle_epi8(src_pixels_4x, src_lanes->shuffle);
+        __m128i dest_pixels_4x_shuffled = _mm_shuffle_epi8(dest_pixels_4x, dest_lanes->shuffle);
+
+        // NOTE: Advance Pixel Buffer
+        src_ptr += src_bytes_per_simd_write;
+        dest_ptr += dest_bytes_per_simd_write;
+
+        // NOTE: Unpack Source & Dest Pixel Layout for SIMD
+        // From {ABGR1, ABGR2, ABGR3, ABGR3} to {RRRR} {GGGG} {BBBB} {AAAA} where each
+        // new {...} is one SIMD register with u32x4 lanes of the same color component.
+        //
+        //    1. Shift colour component to lowest 8 bits
+        //    2. Isolate the color component
+        //
+        __m128i src0123_r_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes->r_bit_shift), src_r_bit_mask);
+        __m128i src0123_g_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes->g_bit_shift), src_g_bit_mask);
+        __m128i src0123_b_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes->b_bit_shift), src_b_bit_mask);
+        __m128i src0123_a_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes->a_bit_shift), src_a_bit_mask);
+
+        __m128i dest0123_r_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes->r_bit_shift), dest_r_bit_mask);
+        __m128i dest0123_g_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes->g_bit_shift), dest_g_bit_mask);
+        __m128i dest0123_b_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes->b_bit_shift), dest_b_bit_mask);
+        __m128i dest0123_a_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes->a_bit_shift), dest_a_bit_mask);
+
+        // NOTE: Convert to SIMD f32x4
+        __m128 src0123_r  = _mm_cvtepi32_ps(src0123_r_int);
+        __m128 src0123_g  = _mm_cvtepi32_ps(src0123_g_int);
+        __m128 src0123_b  = _mm_cvtepi32_ps(src0123_b_int);
+        __m128 src0123_a  = _mm_cvtepi32_ps(src0123_a_int);
+
+        __m128 dest0123_r = _mm_cvtepi32_ps(dest0123_r_int);
+        __m128 dest0123_g = _mm_cvtepi32_ps(dest0123_g_int);
+        __m128 dest0123_b = _mm_cvtepi32_ps(dest0123_b_int);
+        __m128 dest0123_a = _mm_cvtepi32_ps(dest0123_a_int);
+
+        // NOTE: For images without an alpha component the src_alpha_min_4x is set to 255 to completely overwrite dest.
+        //       For images with an alpha component the src_alpha_min_4x is set to 0 (i.e. no-op)
+        src0123_a  = _mm_max_ps(src0123_a, src_alpha_min_4x);
+        dest0123_a = _mm_max_ps(dest0123_a, dest_alpha_min_4x);
+
+        // NOTE: Source Pixels to Normalized [0, 1] Float Space
+        __m128 src0123_r01 = _mm_mul_ps(src0123_r, src_r_to_01_coefficient);
+        __m128 src0123_g01 = _mm_mul_ps(src0123_g, src_g_to_01_coefficient);
+        __m128 src0123_b01 = _mm_mul_ps(src0123_b, src_b_to_01_coefficient);
+        __m128 src0123_a01 = _mm_mul_ps(src0123_a, src_a_to_01_coefficient);
+
+        // NOTE: Tint Source Pixels
+        __m128 src0123_tinted_r01 = _mm_mul_ps(src0123_r01, tint_r01_4x);
+        __m128 src0123_tinted_g01 = _mm_mul_ps(src0123_g01, tint_g01_4x);
+        __m128 src0123_tinted_b01 = _mm_mul_ps(src0123_b01, tint_b01_4x);
+        __m128 src0123_tinted_a01 = _mm_mul_ps(src0123_a01, tint_a01_4x);
+
+        // NOTE: Gray destinations store 1 channel, reduce the source to
+        // luminance so the blended R, G and B are equal
+        if (params->dest_gray)
+        {
+            src0123_tinted_r01 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(src0123_tinted_r01, luma_r_4x), _mm_mul_ps(src0123_tinted_g01, luma_g_4x)), _mm_mul_ps(src0123_tinted_b01, luma_b_4x));
+            src0123_tinted_g01 = src0123_tinted_r01;
+            src0123_tinted_b01 = src0123_tinted_r01;
+        }
+
+        // NOTE: Dest Pixels to Normalized [0, 1] Float Space
+        __m128 dest0123_r01 = _mm_mul_ps(dest0123_r, dest_r_to_01_coefficient);
+        __m128 dest0123_g01 = _mm_mul_ps(dest0123_g, dest_g_to_01_coefficient);
+        __m128 dest0123_b01 = _mm_mul_ps(dest0123_b, dest_b_to_01_coefficient);
+        __m128 dest0123_a01 = _mm_mul_ps(dest0123_a, dest_a_to_01_coefficient);
+
+        // NOTE: Porter Duff Blend
+        // NOTE: Blend Alpha
+        // i.e. blend_a = src_a + (dest_a * (1 - src_a))
+        // The reciprocal is clamped so that a fully transparent result
+        // (blend_a = 0) produces 0 instead of NaN.
+        __m128 one_minus_src0123_tinted_a01 = _mm_sub_ps(one_4x, src0123_tinted_a01);
+        __m128 dest0123_weight              = _mm_mul_ps(dest0123_a01, one_minus_src0123_tinted_a01);
+        __m128 blend0123_a01                = _mm_add_ps(src0123_tinted_a01, dest0123_weight);
+        __m128 inv_blend0123_a01            = _mm_rcp_ps(_mm_max_ps(blend0123_a01, min_blend_a01_4x));
+
+        // NOTE: Blend Colors
+        // i.e. blend_r = ((src_r * src_a) + (dest_r * dest_a * (1.f - src_a))) / blend_a;
+        __m128 blend0123_r01 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(src0123_tinted_r01, src0123_tinted_a01), _mm_mul_ps(dest0123_r01, dest0123_weight)), inv_blend0123_a01);
+        __m128 blend0123_g01 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(src0123_tinted_g01, src0123_tinted_a01), _mm_mul_ps(dest0123_g01, dest0123_weight)), inv_blend0123_a01);
+        __m128 blend0123_b01 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(src0123_tinted_b01, src0123_tinted_a01), _mm_mul_ps(dest0123_b01, dest0123_weight)), inv_blend0123_a01);
+
+        // NOTE: Convert Blend to F32 Space for Pixel Format
+        // i.e. For RGBA8888 to [0-255], RGBA4444 to [0-16] .. etc.
+        __m128 blend0123_a = _mm_mul_ps(blend0123_a01, dest_a01_to_pixel_format_coefficient);
+        __m128 blend0123_r = _mm_mul_ps(blend0123_r01, dest_r01_to_pixel_format_coefficient);
+        __m128 blend0123_g = _mm_mul_ps(blend0123_g01, dest_g01_to_pixel_format_coefficient);
+        __m128 blend0123_b = _mm_mul_ps(blend0123_b01, dest_b01_to_pixel_format_coefficient);
+
+        // NOTE: Convert Blend to Integer Space
+        __m128i blended0123_a_int = _mm_cvtps_epi32(blend0123_a);
+        __m128i blended0123_r_int = _mm_cvtps_epi32(blend0123_r);
+        __m128i blended0123_g_int = _mm_cvtps_epi32(blend0123_g);
+        __m128i blended0123_b_int = _mm_cvtps_epi32(blend0123_b);
+
+        // NOTE: Repack The Pixel
+        // From {RRRR} {GGGG} {BBBB} {AAAA} to target format, i.e. for RGBA8888 {ABGR ABGR ABGR ABGR}
+        // Each blend has the color component converted to 8 bits sitting in the low bits of the SIMD lane.
+        // Shift the colors into place and or them together to get the final output
+        //
+        //      blended0123_r_int = {[0,0,0,R], [0,0,0,R], [0,0,0,R], [0,0,0,R]}
+        //      blended0123_g_int = {[0,0,0,G], [0,0,0,G], [0,0,0,G], [0,0,0,G]}
+        //      blended0123_b_int = {[0,0,0,B], [0,0,0,B], [0,0,0,B], [0,0,0,B]}
+        //      blended0123_b_int = {[0,0,0,A], [0,0,0,A], [0,0,0,A], [0,0,0,A]}
+        //      pixel0123         = {[A,B,G,R], [A,B,G,R], [A,B,G,R], [A,B,G,R]}
+        //
+
+        __m128i blended0123_a_int_shifted = _mm_slli_epi32(blended0123_a_int, dest_lanes->a_bit_shift);
+        __m128i blended0123_r_int_shifted = _mm_slli_epi32(blended0123_r_int, dest_lanes->r_bit_shift);
+        __m128i blended0123_g_int_shifted = _mm_slli_epi32(blended0123_g_int, dest_lanes->g_bit_shift);
+        __m128i blended0123_b_int_shifted = _mm_slli_epi32(blended0123_b_int, dest_lanes->b_bit_shift);
+
+        __m128i pixel0123_ar = _mm_or_si128(blended0123_a_int_shifted, blended0123_r_int_shifted);
+        __m128i pixel0123_gb = _mm_or_si128(blended0123_g_int_shifted, blended0123_b_int_shifted);
+        __m128i pixel0123    = _mm_or_si128(pixel0123_ar, pixel0123_gb);
+        RaylibSIMD__StorePixels4x_SSE41(dest, pixel0123, params->dest_bytes_per_pixel);
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: AVX2 equivalent of RaylibSIMD__StorePixels4x_SSE41 for 8 pixels, kept
+// in AVX2 code so the kernel's loop doesn't switch to legacy SSE to store.
+RS_FILE_SCOPE RS_TARGET_AVX2 void RaylibSIMD__StorePixels8x_AVX2(unsigned char *dest, __m256i pixels_8x, int dest_bytes_per_pixel)
+{
+    switch (dest_bytes_per_pixel)
+    {
+        case 4: _mm256_storeu_si256((__m256i *)dest, pixels_8x); break;
+
+        case 3:
+        {
+            __m256i const pack  = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+            __m256i const lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+            __m256i packed      = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(pixels_8x, pack), lanes);
+            _mm_storeu_si128((__m128i *)dest, _mm256_castsi256_si128(packed));
+            _mm_storel_epi64((__m128i *)(dest + 16), _mm256_extracti128_si256(packed, 1));
+        }
+        break;
+
+        case 2:
+        {
+            __m256i packed = _mm256_packus_epi32(_mm256_and_si256(pixels_8x, _mm256_set1_epi32(0xFFFF)), _mm256_setzero_si256());
+            packed         = _mm256_permute4x64_epi64(packed, 0x08);
+            _mm_storeu_si128((__m128i *)dest, _mm256_castsi256_si128(packed));
+        }
+        break;
+
+        case 1:
+        {
+            __m256i const pack  = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+            __m256i const lanes = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+            __m256i packed      = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(pixels_8x, pack), lanes);
+            _mm_storel_epi64((__m128i *)dest, _mm256_castsi256_si128(packed));
+        }
+        break;
+    }
+}
+
+// NOTE: The AVX2 kernel is the SSE4.1 kernel with every register doubled in
+// width, 8 pixels are blended per iteration. _mm256_shuffle_epi8 can only
+// shuffle within each 128 bit half, so the 2nd group of 4 pixels is loaded into
+// the upper half separately and both halves reuse the 128 bit lane shuffle.
+//
+// Register | {[P1 P2 P3 P4 ..] [P5 P6 P7 P8 ..]}
+//             ^                 ^
+//             |                 +---- Loaded from src_ptr + 4 pixels
+//             +---------------------- Loaded from src_ptr
+RS_FILE_SCOPE RS_TARGET_AVX2 int RaylibSIMD__BlendRow_AVX2(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    RaylibSIMD_PixelPerLaneShuffle const *src_lanes  = &params->src_lanes;
+    RaylibSIMD_PixelPerLaneShuffle const *dest_lanes = &params->dest_lanes;
+
+    __m256i const src_shuffle_8x     = _mm256_broadcastsi128_si256(src_lanes->shuffle);
+    __m256i const dest_shuffle_8x    = _mm256_broadcastsi128_si256(dest_lanes->shuffle);
+
+    __m256 const tint_r01_8x         = _mm256_set1_ps(params->tint_r01);
+    __m256 const tint_g01_8x         = _mm256_set1_ps(params->tint_g01);
+    __m256 const tint_b01_8x         = _mm256_set1_ps(params->tint_b01);
+    __m256 const tint_a01_8x         = _mm256_set1_ps(params->tint_a01);
+    __m256 const one_8x              = _mm256_set1_ps(1.f);
+    __m256 const min_blend_a01_8x    = _mm256_set1_ps(1.f / 65536.f);
+    __m256 const luma_r_8x           = _mm256_set1_ps(0.299f);
+    __m256 const luma_g_8x           = _mm256_set1_ps(0.587f);
+    __m256 const luma_b_8x           = _mm256_set1_ps(0.114f);
+
+    __m256 const src_alpha_min_8x    = _mm256_set1_ps(params->src_alpha_min);
+    __m256 const dest_alpha_min_8x   = _mm256_set1_ps(params->dest_alpha_min);
+    __m256i const src_r_bit_mask     = _mm256_set1_epi32(src_lanes->r_bit_mask);
+    __m256i const src_g_bit_mask     = _mm256_set1_epi32(src_lanes->g_bit_mask);
+    __m256i const src_b_bit_mask     = _mm256_set1_epi32(src_lanes->b_bit_mask);
+    __m256i const src_a_bit_mask     = _mm256_set1_epi32(src_lanes->a_bit_mask);
+
+    __m256 const src_r_to_01_coefficient  = _mm256_set1_ps(src_lanes->r_to_01_coefficient);
+    __m256 const src_g_to_01_coefficient  = _mm256_set1_ps(src_lanes->g_to_01_coefficient);
+    __m256 const src_b_to_01_coefficient  = _mm256_set1_ps(src_lanes->b_to_01_coefficient);
+    __m256 const src_a_to_01_coefficient  = _mm256_set1_ps(src_lanes->a_to_01_coefficient);
+
+    __m256i const dest_r_bit_mask         = _mm256_set1_epi32(dest_lanes->r_bit_mask);
+    __m256i const dest_g_bit_mask         = _mm256_set1_epi32(dest_lanes->g_bit_mask);
+    __m256i const dest_b_bit_mask         = _mm256_set1_epi32(dest_lanes->b_bit_mask);
+    __m256i const dest_a_bit_mask         = _mm256_set1_epi32(dest_lanes->a_bit_mask);
+
+    __m256 const dest_r_to_01_coefficient = _mm256_set1_ps(dest_lanes->r_to_01_coefficient);
+    __m256 const dest_g_to_01_coefficient = _mm256_set1_ps(dest_lanes->g_to_01_coefficient);
+    __m256 const dest_b_to_01_coefficient = _mm256_set1_ps(dest_lanes->b_to_01_coefficient);
+    __m256 const dest_a_to_01_coefficient = _mm256_set1_ps(dest_lanes->a_to_01_coefficient);
+
+    __m256 const dest_r01_to_pixel_format_coefficient = _mm256_set1_ps(1.f / dest_lanes->r_to_01_coefficient);
+    __m256 const dest_g01_to_pixel_format_coefficient = _mm256_set1_ps(1.f / dest_lanes->g_to_01_coefficient);
+    __m256 const dest_b01_to_pixel_format_coefficient = _mm256_set1_ps(1.f / dest_lanes->b_to_01_coefficient);
+    __m256 const dest_a01_to_pixel_format_coefficient = _mm256_set1_ps(1.f / dest_lanes->a_to_01_coefficient);
+
+    int const PIXELS_PER_SIMD_WRITE     = sizeof(__m256) / sizeof(float);
+    int const PIXELS_PER_HALF           = PIXELS_PER_SIMD_WRITE / 2;
+    int const src_bytes_per_half        = PIXELS_PER_HALF * params->src_bytes_per_pixel;
+    int const dest_bytes_per_half       = PIXELS_PER_HALF * params->dest_bytes_per_pixel;
+    int const simd_iterations           = RaylibSIMD__BlendRowIterations(pixels, PIXELS_PER_SIMD_WRITE, params);
+
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        unsigned char *dest = dest_ptr;
+
+        // NOTE: Extract Pixels From Buffer
+        __m256i src_pixels_8x  = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)src_ptr)),
+                                                         _mm_loadu_si128((__m128i *)(src_ptr + src_bytes_per_half)), 1);
+        __m256i dest_pixels_8x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)dest_ptr)),
+                                                         _mm_loadu_si128((__m128i *)(dest_ptr + dest_bytes_per_half)), 1);
+
+        // NOTE: Arrange loaded pixels to 1 pixel per lane.
+        __m256i src_pixels_8x_shuffled  = _mm256_shuffle_epi8(src_pixels_8x, src_shuffle_8x);
+        __m256i dest_pixels_8x_shuffled = _mm256_shuffle_epi8(dest_pixels_8x, dest_shuffle_8x);
+
+        // NOTE: Advance Pixel Buffer
+        src_ptr += 2 * src_bytes_per_half;
+        dest_ptr += 2 * dest_bytes_per_half;
+
+        // NOTE: Unpack Source & Dest Pixel Layout for SIMD
+        __m256i src_r_int = _mm256_and_si256(_mm256_srli_epi32(src_pixels_8x_shuffled, src_lanes->r_bit_shift), src_r_bit_mask);
+        __m256i src_g_int = _mm256_and_si256(_mm256_srli_epi32(src_pixels_8x_shuffled, src_lanes->g_bit_shift), src_g_bit_mask);
+        __m256i src_b_int = _mm256_and_si256(_mm256_srli_epi32(src_pixels_8x_shuffled, src_lanes->b_bit_shift), src_b_bit_mask);
+        __m256i src_a_int = _mm256_and_si256(_mm256_srli_epi32(src_pixels_8x_shuffled, src_lanes->a_bit_shift), src_a_bit_mask);
+
+        __m256i dest_r_int = _mm256_and_si256(_mm256_srli_epi32(dest_pixels_8x_shuffled, dest_lanes->r_bit_shift), dest_r_bit_mask);
+        __m256i dest_g_int = _mm256_and_si256(_mm256_srli_epi32(dest_pixels_8x_shuffled, dest_lanes->g_bit_shift), dest_g_bit_mask);
+        __m256i dest_b_int = _mm256_and_si256(_mm256_srli_epi32(dest_pixels_8x_shuffled, dest_lanes->b_bit_shift), dest_b_bit_mask);
+        __m256i dest_a_int = _mm256_and_si256(_mm256_srli_epi32(dest_pixels_8x_shuffled, dest_lanes->a_bit_shift), dest_a_bit_mask);
+
+        // NOTE: Convert to SIMD f32x8, apply alpha minimums for formats without alpha
+        __m256 src_a  = _mm256_max_ps(_mm256_cvtepi32_ps(src_a_int), src_alpha_min_8x);
+        __m256 dest_a = _mm256_max_ps(_mm256_cvtepi32_ps(dest_a_int), dest_alpha_min_8x);
+
+        // NOTE: Source Pixels to Normalized [0, 1] Float Space and Tint
+        __m256 src_tinted_r01 = _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(src_r_int), src_r_to_01_coefficient), tint_r01_8x);
+        __m256 src_tinted_g01 = _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(src_g_int), src_g_to_01_coefficient), tint_g01_8x);
+        __m256 src_tinted_b01 = _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(src_b_int), src_b_to_01_coefficient), tint_b01_8x);
+        __m256 src_tinted_a01 = _mm256_mul_ps(_mm256_mul_ps(src_a, src_a_to_01_coefficient), tint_a01_8x);
+        if (params->dest_gray)
+        {
+            src_tinted_r01 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(src_tinted_r01, luma_r_8x), _mm256_mul_ps(src_tinted_g01, luma_g_8x)), _mm256_mul_ps(src_tinted_b01, luma_b_8x));
+            src_tinted_g01 = src_tinted_r01;
+            src_tinted_b01 = src_tinted_r01;
+        }
+
+        // NOTE: Dest Pixels to Normalized [0, 1] Float Space
+        __m256 dest_r01 = _mm256_mul_ps(_mm256_cvtepi32_ps(dest_r_int), dest_r_to_01_coefficient);
+        __m256 dest_g01 = _mm256_mul_ps(_mm256_cvtepi32_ps(dest_g_int), dest_g_to_01_coefficient);
+        __m256 dest_b01 = _mm256_mul_ps(_mm256_cvtepi32_ps(dest_b_int), dest_b_to_01_coefficient);
+        __m256 dest_a01 = _mm256_mul_ps(dest_a, dest_a_to_01_coefficient);
+
+        // NOTE: Porter Duff Blend, see RaylibSIMD__BlendRow_SSE41
+        __m256 dest_weight     = _mm256_mul_ps(dest_a01, _mm256_sub_ps(one_8x, src_tinted_a01));
+        __m256 blend_a01       = _mm256_add_ps(src_tinted_a01, dest_weight);
+        __m256 inv_blend_a01   = _mm256_rcp_ps(_mm256_max_ps(blend_a01, min_blend_a01_8x));
+
+        __m256 blend_r01 = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(src_tinted_r01, src_tinted_a01), _mm256_mul_ps(dest_r01, dest_weight)), inv_blend_a01);
+        __m256 blend_g01 = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(src_tinted_g01, src_tinted_a01), _mm256_mul_ps(dest_g01, dest_weight)), inv_blend_a01);
+        __m256 blend_b01 = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(src_tinted_b01, src_tinted_a01), _mm256_mul_ps(dest_b01, dest_weight)), inv_blend_a01);
+
+        // NOTE: Convert Blend to Integer Space for Pixel Format
+        __m256i blended_a_int = _mm256_cvtps_epi32(_mm256_mul_ps(blend_a01, dest_a01_to_pixel_format_coefficient));
+        __m256i blended_r_int = _mm256_cvtps_epi32(_mm256_mul_ps(blend_r01, dest_r01_to_pixel_format_coefficient));
+        __m256i blended_g_int = _mm256_cvtps_epi32(_mm256_mul_ps(blend_g01, dest_g01_to_pixel_format_coefficient));
+        __m256i blended_b_int = _mm256_cvtps_epi32(_mm256_mul_ps(blend_b01, dest_b01_to_pixel_format_coefficient));
+
+        // NOTE: Repack The Pixel
+        __m256i pixel_ar = _mm256_or_si256(_mm256_slli_epi32(blended_a_int, dest_lanes->a_bit_shift), _mm256_slli_epi32(blended_r_int, dest_lanes->r_bit_shift));
+        __m256i pixel_gb = _mm256_or_si256(_mm256_slli_epi32(blended_g_int, dest_lanes->g_bit_shift), _mm256_slli_epi32(blended_b_int, dest_lanes->b_bit_shift));
+        __m256i pixel_8x = _mm256_or_si256(pixel_ar, pixel_gb);
+        RaylibSIMD__StorePixels8x_AVX2(dest, pixel_8x, params->dest_bytes_per_pixel);
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: Mask of the first bytes of a 64 byte register, bytes is in [0, 64]
+RS_FILE_SCOPE __mmask64 RaylibSIMD__ByteMask64(int bytes)
+{
+    __mmask64 result = (bytes >= 64) ? ~RS_CAST(__mmask64)0 : ((RS_CAST(__mmask64)1 << bytes) - 1);
+    return result;
+}
+
+// NOTE: AVX512 equivalent of RaylibSIMD__StorePixels4x_SSE41, packs 16 pixels,
+// 1 per 32 bit lane, to the destination's pixel size at the start of the
+// register for a masked store. Calling the SSE4.1 store from the AVX512
+// kernel runs legacy SSE code in the loop.
+RS_FILE_SCOPE RS_TARGET_AVX512 __m512i RaylibSIMD__PackPixels16x_AVX512(__m512i pixels_16x, int dest_bytes_per_pixel)
+{
+    __m512i result = pixels_16x;
+    switch (dest_bytes_per_pixel)
+    {
+        case 3:
+        {
+            __m512i const pack  = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+            __m512i const lanes = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15);
+            result              = _mm512_permutexvar_epi32(lanes, _mm512_shuffle_epi8(pixels_16x, pack));
+        }
+        break;
+
+        case 2: result = _mm512_castsi256_si512(_mm512_cvtepi32_epi16(pixels_16x)); break;
+        case 1: result = _mm512_castsi128_si512(_mm512_cvtepi32_epi8(pixels_16x)); break;
+    }
+    return result;
+}
+
+// NOTE: The AVX-512 kernel follows the AVX2 kernel with 16 pixels per
+// iteration, each 128 bit quarter of the register is loaded with 4 pixels.
+RS_FILE_SCOPE RS_TARGET_AVX512 int RaylibSIMD__BlendRow_AVX512(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    RaylibSIMD_PixelPerLaneShuffle const *src_lanes  = &params->src_lanes;
+    RaylibSIMD_PixelPerLaneShuffle const *dest_lanes = &params->dest_lanes;
+
+    __m512i const src_shuffle_16x    = _mm512_broadcast_i32x4(src_lanes->shuffle);
+    __m512i const dest_shuffle_16x   = _mm512_broadcast_i32x4(dest_lanes->shuffle);
+
+    __m512 const tint_r01_16x        = _mm512_set1_ps(params->tint_r01);
+    __m512 const tint_g01_16x        = _mm512_set1_ps(params->tint_g01);
+    __m512 const tint_b01_16x        = _mm512_set1_ps(params->tint_b01);
+    __m512 const tint_a01_16x        = _mm512_set1_ps(params->tint_a01);
+    __m512 const one_16x             = _mm512_set1_ps(1.f);
+    __m512 const min_blend_a01_16x   = _mm512_set1_ps(1.f / 65536.f);
+    __m512 const luma_r_16x          = _mm512_set1_ps(0.299f);
+    __m512 const luma_g_16x          = _mm512_set1_ps(0.587f);
+    __m512 const luma_b_16x          = _mm512_set1_ps(0.114f);
+
+    __m512 const src_alpha_min_16x   = _mm512_set1_ps(params->src_alpha_min);
+    __m512 const dest_alpha_min_16x  = _mm512_set1_ps(params->dest_alpha_min);
+    __m512i const src_r_bit_mask     = _mm512_set1_epi32(src_lanes->r_bit_mask);
+    __m512i const src_g_bit_mask     = _mm512_set1_epi32(src_lanes->g_bit_mask);
+    __m512i const src_b_bit_mask     = _mm512_set1_epi32(src_lanes->b_bit_mask);
+    __m512i const src_a_bit_mask     = _mm512_set1_epi32(src_lanes->a_bit_mask);
+
+    __m512 const src_r_to_01_coefficient  = _mm512_set1_ps(src_lanes->r_to_01_coefficient);
+    __m512 const src_g_to_01_coefficient  = _mm512_set1_ps(src_lanes->g_to_01_coefficient);
+    __m512 const src_b_to_01_coefficient  = _mm512_set1_ps(src_lanes->b_to_01_coefficient);
+    __m512 const src_a_to_01_coefficient  = _mm512_set1_ps(src_lanes->a_to_01_coefficient);
+
+    __m512i const dest_r_bit_mask         = _mm512_set1_epi32(dest_lanes->r_bit_mask);
+    __m512i const dest_g_bit_mask         = _mm512_set1_epi32(dest_lanes->g_bit_mask);
+    __m512i const dest_b_bit_mask         = _mm512_set1_epi32(dest_lanes->b_bit_mask);
+    __m512i const dest_a_bit_mask         = _mm512_set1_epi32(dest_lanes->a_bit_mask);
+
+    __m512 const dest_r_to_01_coefficient = _mm512_set1_ps(dest_lanes->r_to_01_coefficient);
+    __m512 const dest_g_to_01_coefficient = _mm512_set1_ps(dest_lanes->g_to_01_coefficient);
+    __m512 const dest_b_to_01_coefficient = _mm512_set1_ps(dest_lanes->b_to_01_coefficient);
+    __m512 const dest_a_to_01_coefficient = _mm512_set1_ps(dest_lanes->a_to_01_coefficient);
+
+    __m512 const dest_r01_to_pixel_format_coefficient = _mm512_set1_ps(1.f / dest_lanes->r_to_01_coefficient);
+    __m512 const dest_g01_to_pixel_format_coefficient = _mm512_set1_ps(1.f / dest_lanes->g_to_01_coefficient);
+    __m512 const dest_b01_to_pixel_format_coefficient = _mm512_set1_ps(1.f / dest_lanes->b_to_01_coefficient);
+    __m512 const dest_a01_to_pixel_format_coefficient = _mm512_set1_ps(1.f / dest_lanes->a_to_01_coefficient);
+
+    int const PIXELS_PER_SIMD_WRITE     = sizeof(__m512) / sizeof(float);
+    int const PIXELS_PER_QUARTER        = PIXELS_PER_SIMD_WRITE / 4;
+    int const src_bytes_per_quarter     = PIXELS_PER_QUARTER * params->src_bytes_per_pixel;
+    int const dest_bytes_per_quarter    = PIXELS_PER_QUARTER * params->dest_bytes_per_pixel;
+    int const simd_iterations           = RaylibSIMD__BlendRowIterations(pixels, PIXELS_PER_SIMD_WRITE, params);
+    int const iterations                = (pixels + PIXELS_PER_SIMD_WRITE - 1) / PIXELS_PER_SIMD_WRITE;
+
+    // NOTE: The iterations past simd_iterations, whose 16 byte quarter loads
+    // would leave the span, load only the bytes of their pixels with a byte
+    // mask (masked off bytes can't fault) and move each quarter into place by
+    // its 32 bit lanes. Every iteration stores through a byte mask, so the
+    // kernel blends the whole span.
+    int const src_bpp                   = params->src_bytes_per_pixel;
+    int const dest_bpp                  = params->dest_bytes_per_pixel;
+    __m512i const src_quarter_lanes     = _mm512_setr_epi32(0, 1, 2, 3, src_bpp + 0, src_bpp + 1, src_bpp + 2, src_bpp + 3,
+                                                            2 * src_bpp + 0, 2 * src_bpp + 1, 2 * src_bpp + 2, 2 * src_bpp + 3,
+                                                            3 * src_bpp + 0, 3 * src_bpp + 1, 3 * src_bpp + 2, 3 * src_bpp + 3);
+    __m512i const dest_quarter_lanes    = _mm512_setr_epi32(0, 1, 2, 3, dest_bpp + 0, dest_bpp + 1, dest_bpp + 2, dest_bpp + 3,
+                                                            2 * dest_bpp + 0, 2 * dest_bpp + 1, 2 * dest_bpp + 2, 2 * dest_bpp + 3,
+                                                            3 * dest_bpp + 0, 3 * dest_bpp + 1, 3 * dest_bpp + 2, 3 * dest_bpp + 3);
+
+    for (int x = 0; x < iterations; x++)
+    {
+        unsigned char *dest          = dest_ptr;
+        int const iteration_pixels   = RS_MIN(pixels - x * PIXELS_PER_SIMD_WRITE, PIXELS_PER_SIMD_WRITE);
+        __mmask64 const store_mask   = RaylibSIMD__ByteMask64(iteration_pixels * dest_bpp);
+
+        // NOTE: Extract Pixels From Buffer
+        __m512i src_pixels_16x, dest_pixels_16x;
+        if (x < simd_iterations)
+        {
+            src_pixels_16x  = _mm512_castsi128_si512(_mm_loadu_si128((__m128i *)src_ptr));
+            src_pixels_16x  = _mm512_inserti32x4(src_pixels_16x, _mm_loadu_si128((__m128i *)(src_ptr + 1 * src_bytes_per_quarter)), 1);
+            src_pixels_16x  = _mm512_inserti32x4(src_pixels_16x, _mm_loadu_si128((__m128i *)(src_ptr + 2 * src_bytes_per_quarter)), 2);
+            src_pixels_16x  = _mm512_inserti32x4(src_pixels_16x, _mm_loadu_si128((__m128i *)(src_ptr + 3 * src_bytes_per_quarter)), 3);
+
+            dest_pixels_16x = _mm512_castsi128_si512(_mm_loadu_si128((__m128i *)dest_ptr));
+            dest_pixels_16x = _mm512_inserti32x4(dest_pixels_16x, _mm_loadu_si128((__m128i *)(dest_ptr + 1 * dest_bytes_per_quarter)), 1);
+            dest_pixels_16x = _mm512_inserti32x4(dest_pixels_16x, _mm_loadu_si128((__m128i *)(dest_ptr + 2 * dest_bytes_per_quarter)), 2);
+            dest_pixels_16x = _mm512_inserti32x4(dest_pixels_16x, _mm_loadu_si128((__m128i *)(dest_ptr + 3 * dest_bytes_per_quarter)), 3);
+        }
+        else
+        {
+            src_pixels_16x  = _mm512_maskz_loadu_epi8(RaylibSIMD__ByteMask64(iteration_pixels * src_bpp), src_ptr);
+            src_pixels_16x  = _mm512_permutexvar_epi32(src_quarter_lanes, src_pixels_16x);
+            dest_pixels_16x = _mm512_maskz_loadu_epi8(store_mask, dest_ptr);
+            dest_pixels_16x = _mm512_permutexvar_epi32(dest_quarter_lanes, dest_pixels_16x);
+        }
+
+        // NOTE: Arrange loaded pixels to 1 pixel per lane.
+        __m512i src_pixels_16x_shuffled  = _mm512_shuffle_epi8(src_pixels_16x, src_shuffle_16x);
+        __m512i dest_pixels_16x_shuffled = _mm512_shuffle_epi8(dest_pixels_16x, dest_shuffle_16x);
+
+        // NOTE: Advance Pixel Buffer
+        src_ptr += 4 * src_bytes_per_quarter;
+        dest_ptr += 4 * dest_bytes_per_quarter;
+
+        // NOTE: Unpack Source & Dest Pixel Layout for SIMD
+        __m512i src_r_int = _mm512_and_si512(_mm512_srli_epi32(src_pixels_16x_shuffled, src_lanes->r_bit_shift), src_r_bit_mask);
+        __m512i src_g_int = _mm512_and_si512(_mm512_srli_epi32(src_pixels_16x_shuffled, src_lanes->g_bit_shift), src_g_bit_mask);
+        __m512i src_b_int = _mm512_and_si512(_mm512_srli_epi32(src_pixels_16x_shuffled, src_lanes->b_bit_shift), src_b_bit_mask);
+        __m512i src_a_int = _mm512_and_si512(_mm512_srli_epi32(src_pixels_16x_shuffled, src_lanes->a_bit_shift), src_a_bit_mask);
+
+        __m512i dest_r_int = _mm512_and_si512(_mm512_srli_epi32(dest_pixels_16x_shuffled, dest_lanes->r_bit_shift), dest_r_bit_mask);
+        __m512i dest_g_int = _mm512_and_si512(_mm512_srli_epi32(dest_pixels_16x_shuffled, dest_lanes->g_bit_shift), dest_g_bit_mask);
+        __m512i dest_b_int = _mm512_and_si512(_mm512_srli_epi32(dest_pixels_16x_shuffled, dest_lanes->b_bit_shift), dest_b_bit_mask);
+        __m512i dest_a_int = _mm512_and_si512(_mm512_srli_epi32(dest_pixels_16x_shuffled, dest_lanes->a_bit_shift), dest_a_bit_mask);
+
+        // NOTE: Convert to SIMD f32x16, apply alpha minimums for formats without alpha
+        __m512 src_a  = _mm512_max_ps(_mm512_cvtepi32_ps(src_a_int), src_alpha_min_16x);
+        __m512 dest_a = _mm512_max_ps(_mm512_cvtepi32_ps(dest_a_int), dest_alpha_min_16x);
+
+        // NOTE: Source Pixels to Normalized [0, 1] Float Space and Tint
+        __m512 src_tinted_r01 = _mm512_mul_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(src_r_int), src_r_to_01_coefficient), tint_r01_16x);
+        __m512 src_tinted_g01 = _mm512_mul_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(src_g_int), src_g_to_01_coefficient), tint_g01_16x);
+        __m512 src_tinted_b01 = _mm512_mul_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(src_b_int), src_b_to_01_coefficient), tint_b01_16x);
+        __m512 src_tinted_a01 = _mm512_mul_ps(_mm512_mul_ps(src_a, src_a_to_01_coefficient), tint_a01_16x);
+        if (params->dest_gray)
+        {
+            src_tinted_r01 = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(src_tinted_r01, luma_r_16x), _mm512_mul_ps(src_tinted_g01, luma_g_16x)), _mm512_mul_ps(src_tinted_b01, luma_b_16x));
+            src_tinted_g01 = src_tinted_r01;
+            src_tinted_b01 = src_tinted_r01;
+        }
+
+        // NOTE: Dest Pixels to Normalized [0, 1] Float Space
+        __m512 dest_r01 = _mm512_mul_ps(_mm512_cvtepi32_ps(dest_r_int), dest_r_to_01_coefficient);
+        __m512 dest_g01 = _mm512_mul_ps(_mm512_cvtepi32_ps(dest_g_int), dest_g_to_01_coefficient);
+        __m512 dest_b01 = _mm512_mul_ps(_mm512_cvtepi32_ps(dest_b_int), dest_b_to_01_coefficient);
+        __m512 dest_a01 = _mm512_mul_ps(dest_a, dest_a_to_01_coefficient);
+
+        // NOTE: Porter Duff Blend, see RaylibSIMD__BlendRow_SSE41
+        __m512 dest_weight     = _mm512_mul_ps(dest_a01, _mm512_sub_ps(one_16x, src_tinted_a01));
+        __m512 blend_a01       = _mm512_add_ps(src_tinted_a01, dest_weight);
+        __m512 inv_blend_a01   = _mm512_rcp14_ps(_mm512_max_ps(blend_a01, min_blend_a01_16x));
+
+        __m512 blend_r01 = _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(src_tinted_r01, src_tinted_a01), _mm512_mul_ps(dest_r01, dest_weight)), inv_blend_a01);
+        __m512 blend_g01 = _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(src_tinted_g01, src_tinted_a01), _mm512_mul_ps(dest_g01, dest_weight)), inv_blend_a01);
+        __m512 blend_b01 = _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(src_tinted_b01, src_tinted_a01), _mm512_mul_ps(dest_b01, dest_weight)), inv_blend_a01);
+
+        // NOTE: Convert Blend to Integer Space for Pixel Format
+        __m512i blended_a_int = _mm512_cvtps_epi32(_mm512_mul_ps(blend_a01, dest_a01_to_pixel_format_coefficient));
+        __m512i blended_r_int = _mm512_cvtps_epi32(_mm512_mul_ps(blend_r01, dest_r01_to_pixel_format_coefficient));
+        __m512i blended_g_int = _mm512_cvtps_epi32(_mm512_mul_ps(blend_g01, dest_g01_to_pixel_format_coefficient));
+        __m512i blended_b_int = _mm512_cvtps_epi32(_mm512_mul_ps(blend_b01, dest_b01_to_pixel_format_coefficient));
+
+        // NOTE: Repack The Pixel
+        __m512i pixel_ar = _mm512_or_si512(_mm512_slli_epi32(blended_a_int, dest_lanes->a_bit_shift), _mm512_slli_epi32(blended_r_int, dest_lanes->r_bit_shift));
+        __m512i pixel_gb = _mm512_or_si512(_mm512_slli_epi32(blended_g_int, dest_lanes->g_bit_shift), _mm512_slli_epi32(blended_b_int, dest_lanes->b_bit_shift));
+        __m512i pixel_16x = _mm512_or_si512(pixel_ar, pixel_gb);
+        _mm512_mask_storeu_epi8(dest, store_mask, RaylibSIMD__PackPixels16x_AVX512(pixel_16x, dest_bpp));
+    }
+
+    return pixels;
+}
+
+// NOTE: Widest kernel the CPU supports, or NULL if the CPU lacks SSE4.1.
+RS_FILE_SCOPE RaylibSIMD__BlendRowProc *RaylibSIMD__BlendRowKernel(RaylibSIMD_InstructionSet instruction_set)
+{
+    RaylibSIMD__BlendRowProc *result = NULL;
+    switch (instruction_set)
+    {
+        default: break;
+        case RaylibSIMD_InstructionSet_SSE41:  result = RaylibSIMD__BlendRow_SSE41;  break;
+        case RaylibSIMD_InstructionSet_AVX2:   result = RaylibSIMD__BlendRow_AVX2;   break;
+        case RaylibSIMD_InstructionSet_AVX512: result = RaylibSIMD__BlendRow_AVX512; break;
+    }
+    return result;
+}
+
+// NOTE: round(numerator / blend_a) for 8 lanes of 16 bit numerators, with a
+// reciprocal biased upwards by 2^-20 so that truncation gives the exact
+// quotient. Numerators are < 2^17 and divisors <= 510, so the quotient is either
+// an integer or at least 1/510 away from one, far more than the bias and float
+// rounding error combined.
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128i RaylibSIMD__DivideRounded8x_SSE41(__m128i numerator, __m128i blend_a, __m128 inv_divisor_lo, __m128 inv_divisor_hi)
+{
+    // NOTE: 2 * numerator + blend_a may exceed 16 bits, widen to 32 bit lanes
+    __m128i const zero  = _mm_setzero_si128();
+    __m128i dividend_lo = _mm_add_epi32(_mm_slli_epi32(_mm_unpacklo_epi16(numerator, zero), 1), _mm_unpacklo_epi16(blend_a, zero));
+    __m128i dividend_hi = _mm_add_epi32(_mm_slli_epi32(_mm_unpackhi_epi16(numerator, zero), 1), _mm_unpackhi_epi16(blend_a, zero));
+    __m128i result_lo   = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(dividend_lo), inv_divisor_lo));
+    __m128i result_hi   = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(dividend_hi), inv_divisor_hi));
+    __m128i result      = _mm_packus_epi32(result_lo, result_hi);
+    return result;
+}
+
+// NOTE: Fixed16 kernels, see RaylibSIMD__BlendPixelFixed16 for the reference.
+// Only R8G8B8A8 to R8G8B8A8 is supported. Each color component is widened to
+// 16 bits so a 128 bit register holds the same component of 8 pixels.
+//
+// Loaded     | {[RGBA1] [RGBA2] [RGBA3] [RGBA4]} {[RGBA5] [RGBA6] [RGBA7] [RGBA8]}
+// Shuffled   | {[RRRR]  [GGGG]  [BBBB]  [AAAA]}  {[RRRR]  [GGGG]  [BBBB]  [AAAA]}
+// Unpacked   | {R1 R2 R3 R4 R5 R6 R7 R8} {G1 .. G8} {B1 .. B8} {A1 .. A8} (16 bit lanes)
+//
+// The weighted sums need 20 bits, so src_c and dest_c are interleaved with
+// src_w and dest_w and summed into 32 bit lanes by one multiply-add. The only
+// step that leaves integer space is the divide by blend_w, done with a
+// reciprocal biased upwards by 2^-22 so that truncation gives the exact
+// quotient. Dividends are < 2^21 and divisors <= 8160, so the quotient is
+// either an integer or at least 1/8160 away from one, more than the bias and
+// float rounding error combined on quotients up to 255.5.
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128i RaylibSIMD__DivideWeighted8x_SSE41(__m128i src_c, __m128i dest_c, __m128i weights_lo, __m128i weights_hi,
+                                                                         __m128i blend_w_lo, __m128i blend_w_hi, __m128 inv_divisor_lo, __m128 inv_divisor_hi)
+{
+    __m128i numerator_lo = _mm_madd_epi16(_mm_unpacklo_epi16(src_c, dest_c), weights_lo);
+    __m128i numerator_hi = _mm_madd_epi16(_mm_unpackhi_epi16(src_c, dest_c), weights_hi);
+    __m128i dividend_lo  = _mm_add_epi32(_mm_slli_epi32(numerator_lo, 1), blend_w_lo);
+    __m128i dividend_hi  = _mm_add_epi32(_mm_slli_epi32(numerator_hi, 1), blend_w_hi);
+    __m128i result_lo    = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(dividend_lo), inv_divisor_lo));
+    __m128i result_hi    = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(dividend_hi), inv_divisor_hi));
+    __m128i result       = _mm_packus_epi32(result_lo, result_hi);
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__BlendRowFixed16_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    __m128i const zero            = _mm_setzero_si128();
+    __m128i const round_8x        = _mm_set1_epi16(128);
+    __m128i const div255_8x       = _mm_set1_epi16(257);
+    __m128i const max_8x          = _mm_set1_epi16(255);
+    __m128i const weight_round_8x = _mm_set1_epi16(8);
+    __m128i const weight_scale_8x = _mm_set1_epi16(4112);
+    __m128i const weight_max_8x   = _mm_set1_epi16(4080);
+    __m128i const two_8x          = _mm_set1_epi16(2);
+    __m128 const reciprocal_bias  = _mm_set1_ps(1.f + (1.f / 4194304.f));
+    __m128 const inv_opaque       = _mm_div_ps(reciprocal_bias, _mm_set1_ps(2.f * 4080.f));
+    __m128i const deinterleave    = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m128i const tint_r_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.r);
+    __m128i const tint_g_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.g);
+    __m128i const tint_b_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.b);
+    __m128i const tint_a_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 8;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, group the components of each 4 pixels
+        __m128i src_0123  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 0)),  deinterleave);
+        __m128i src_4567  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 16)), deinterleave);
+        __m128i dest_0123 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 0)),  deinterleave);
+        __m128i dest_4567 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 16)), deinterleave);
+
+        // NOTE: Unpack to {RRRRRRRR} {GGGGGGGG} .. with 16 bit lanes
+        __m128i src_rg  = _mm_unpacklo_epi32(src_0123, src_4567);
+        __m128i src_ba  = _mm_unpackhi_epi32(src_0123, src_4567);
+        __m128i dest_rg = _mm_unpacklo_epi32(dest_0123, dest_4567);
+        __m128i dest_ba = _mm_unpackhi_epi32(dest_0123, dest_4567);
+
+        __m128i src_r  = _mm_unpacklo_epi8(src_rg, zero);
+        __m128i src_g  = _mm_unpackhi_epi8(src_rg, zero);
+        __m128i src_b  = _mm_unpacklo_epi8(src_ba, zero);
+        __m128i src_a  = _mm_unpackhi_epi8(src_ba, zero);
+        __m128i dest_r = _mm_unpacklo_epi8(dest_rg, zero);
+        __m128i dest_g = _mm_unpackhi_epi8(dest_rg, zero);
+        __m128i dest_b = _mm_unpacklo_epi8(dest_ba, zero);
+        __m128i dest_a = _mm_unpackhi_epi8(dest_ba, zero);
+
+        // NOTE: Tint Source Pixels, div255(x) = ((x + 128) * 257) >> 16
+        __m128i src_at = _mm_mullo_epi16(src_a, tint_a_8x);
+        src_r = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(src_r, tint_r_8x), round_8x), div255_8x);
+        src_g = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(src_g, tint_g_8x), round_8x), div255_8x);
+        src_b = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(src_b, tint_b_8x), round_8x), div255_8x);
+        src_a = _mm_mulhi_epu16(_mm_add_epi16(src_at, round_8x), div255_8x);
+
+        // NOTE: Porter Duff Blend, the stored alpha in 8 bits
+        __m128i dest_a8 = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(dest_a, _mm_sub_epi16(max_8x, src_a)), round_8x), div255_8x);
+        __m128i blend_a = _mm_add_epi16(src_a, dest_a8);
+
+        // NOTE: The color weights in 1/16 alpha steps, (dest_a * 257 + 2) >> 2
+        // is evaluated as (dest_a << 6) + ((dest_a + 2) >> 2) so it can't overflow
+        __m128i src_w       = _mm_mulhi_epu16(_mm_add_epi16(src_at, weight_round_8x), weight_scale_8x);
+        __m128i dest_scale  = _mm_add_epi16(_mm_slli_epi16(dest_a, 6), _mm_srli_epi16(_mm_add_epi16(dest_a, two_8x), 2));
+        __m128i dest_w      = _mm_mulhrs_epi16(_mm_slli_epi16(_mm_sub_epi16(weight_max_8x, src_w), 1), dest_scale);
+        __m128i blend_w     = _mm_add_epi16(src_w, dest_w);
+        __m128i weights_lo  = _mm_unpacklo_epi16(src_w, dest_w);
+        __m128i weights_hi  = _mm_unpackhi_epi16(src_w, dest_w);
+        __m128i blend_w_lo  = _mm_unpacklo_epi16(blend_w, zero);
+        __m128i blend_w_hi  = _mm_unpackhi_epi16(blend_w, zero);
+
+        // NOTE: Opaque results all divide by 2 * 4080. A fully transparent one
+        // divides by 0, the 0 * inf NaN converts to a negative integer which
+        // the pack saturates to 0.
+        __m128 inv_divisor_lo = inv_opaque;
+        __m128 inv_divisor_hi = inv_opaque;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(blend_w, weight_max_8x)) != 0xFFFF)
+        {
+            __m128 divisor_lo = _mm_cvtepi32_ps(blend_w_lo);
+            __m128 divisor_hi = _mm_cvtepi32_ps(blend_w_hi);
+            inv_divisor_lo    = _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_lo, divisor_lo));
+            inv_divisor_hi    = _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_hi, divisor_hi));
+        }
+        __m128i blend_r = RaylibSIMD__DivideWeighted8x_SSE41(src_r, dest_r, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+        __m128i blend_g = RaylibSIMD__DivideWeighted8x_SSE41(src_g, dest_g, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+        __m128i blend_b = RaylibSIMD__DivideWeighted8x_SSE41(src_b, dest_b, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+
+        // NOTE: Repack The Pixel, {RRRRRRRR} {GGGGGGGG} .. to {RGBA1 .. RGBA4} {RGBA5 .. RGBA8}
+        __m128i pixel_rg = _mm_or_si128(blend_r, _mm_slli_epi16(blend_g, 8));
+        __m128i pixel_ba = _mm_or_si128(blend_b, _mm_slli_epi16(blend_a, 8));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 0),  _mm_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 16), _mm_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_AVX2 __m256i RaylibSIMD__DivideWeighted16x_AVX2(__m256i src_c, __m256i dest_c, __m256i weights_lo, __m256i weights_hi,
+                                                                        __m256i blend_w_lo, __m256i blend_w_hi, __m256 inv_divisor_lo, __m256 inv_divisor_hi)
+{
+    __m256i numerator_lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(src_c, dest_c), weights_lo);
+    __m256i numerator_hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(src_c, dest_c), weights_hi);
+    __m256i dividend_lo  = _mm256_add_epi32(_mm256_slli_epi32(numerator_lo, 1), blend_w_lo);
+    __m256i dividend_hi  = _mm256_add_epi32(_mm256_slli_epi32(numerator_hi, 1), blend_w_hi);
+    __m256i result_lo    = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(dividend_lo), inv_divisor_lo));
+    __m256i result_hi    = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(dividend_hi), inv_divisor_hi));
+    __m256i result       = _mm256_packus_epi32(result_lo, result_hi);
+    return result;
+}
+
+// NOTE: The AVX2 Fixed16 kernel is the SSE4.1 kernel with 16 pixels per iteration.
+RS_FILE_SCOPE RS_TARGET_AVX2 int RaylibSIMD__BlendRowFixed16_AVX2(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    __m256i const zero             = _mm256_setzero_si256();
+    __m256i const round_16x        = _mm256_set1_epi16(128);
+    __m256i const div255_16x       = _mm256_set1_epi16(257);
+    __m256i const max_16x          = _mm256_set1_epi16(255);
+    __m256i const weight_round_16x = _mm256_set1_epi16(8);
+    __m256i const weight_scale_16x = _mm256_set1_epi16(4112);
+    __m256i const weight_max_16x   = _mm256_set1_epi16(4080);
+    __m256i const two_16x          = _mm256_set1_epi16(2);
+    __m256 const reciprocal_bias   = _mm256_set1_ps(1.f + (1.f / 4194304.f));
+    __m256 const inv_opaque        = _mm256_div_ps(reciprocal_bias, _mm256_set1_ps(2.f * 4080.f));
+    __m256i const deinterleave     = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+    __m256i const tint_r_16x       = _mm256_set1_epi16(RS_CAST(short)params->tint.r);
+    __m256i const tint_g_16x       = _mm256_set1_epi16(RS_CAST(short)params->tint.g);
+    __m256i const tint_b_16x       = _mm256_set1_epi16(RS_CAST(short)params->tint.b);
+    __m256i const tint_a_16x       = _mm256_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 16;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, group the components of each 4 pixels
+        // in each 128 bit half. The unpacks below stay within each half so the
+        // components end up in the order {P1-4, P9-12 | P5-8, P13-16}, which
+        // the repack at the end undoes.
+        __m256i src_lo  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 0)),  deinterleave);
+        __m256i src_hi  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 32)), deinterleave);
+        __m256i dest_lo = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 0)),  deinterleave);
+        __m256i dest_hi = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 32)), deinterleave);
+
+        // NOTE: Unpack to {RRRRRRRR RRRRRRRR} {GGGGGGGG GGGGGGGG} .. with 16 bit lanes
+        __m256i src_rg  = _mm256_unpacklo_epi32(src_lo, src_hi);
+        __m256i src_ba  = _mm256_unpackhi_epi32(src_lo, src_hi);
+        __m256i dest_rg = _mm256_unpacklo_epi32(dest_lo, dest_hi);
+        __m256i dest_ba = _mm256_unpackhi_epi32(dest_lo, dest_hi);
+
+        __m256i src_r  = _mm256_unpacklo_epi8(src_rg, zero);
+        __m256i src_g  = _mm256_unpackhi_epi8(src_rg, zero);
+        __m256i src_b  = _mm256_unpacklo_epi8(src_ba, zero);
+        __m256i src_a  = _mm256_unpackhi_epi8(src_ba, zero);
+        __m256i dest_r = _mm256_unpacklo_epi8(dest_rg, zero);
+        __m256i dest_g = _mm256_unpackhi_epi8(dest_rg, zero);
+        __m256i dest_b = _mm256_unpacklo_epi8(dest_ba, zero);
+        __m256i dest_a = _mm256_unpackhi_epi8(dest_ba, zero);
+
+        // NOTE: Tint Source Pixels, div255(x) = ((x + 128) * 257) >> 16
+        __m256i src_at = _mm256_mullo_epi16(src_a, tint_a_16x);
+        src_r = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(src_r, tint_r_16x), round_16x), div255_16x);
+        src_g = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(src_g, tint_g_16x), round_16x), div255_16x);
+        src_b = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(src_b, tint_b_16x), round_16x), div255_16x);
+        src_a = _mm256_mulhi_epu16(_mm256_add_epi16(src_at, round_16x), div255_16x);
+
+        // NOTE: Porter Duff Blend, see RaylibSIMD__BlendRowFixed16_SSE41
+        __m256i dest_a8 = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(dest_a, _mm256_sub_epi16(max_16x, src_a)), round_16x), div255_16x);
+        __m256i blend_a = _mm256_add_epi16(src_a, dest_a8);
+
+        __m256i src_w      = _mm256_mulhi_epu16(_mm256_add_epi16(src_at, weight_round_16x), weight_scale_16x);
+        __m256i dest_scale = _mm256_add_epi16(_mm256_slli_epi16(dest_a, 6), _mm256_srli_epi16(_mm256_add_epi16(dest_a, two_16x), 2));
+        __m256i dest_w     = _mm256_mulhrs_epi16(_mm256_slli_epi16(_mm256_sub_epi16(weight_max_16x, src_w), 1), dest_scale);
+        __m256i blend_w    = _mm256_add_epi16(src_w, dest_w);
+        __m256i weights_lo = _mm256_unpacklo_epi16(src_w, dest_w);
+        __m256i weights_hi = _mm256_unpackhi_epi16(src_w, dest_w);
+        __m256i blend_w_lo = _mm256_unpacklo_epi16(blend_w, zero);
+        __m256i blend_w_hi = _mm256_unpackhi_epi16(blend_w, zero);
+
+        __m256 inv_divisor_lo = inv_opaque;
+        __m256 inv_divisor_hi = inv_opaque;
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(blend_w, weight_max_16x)) != -1)
+        {
+            __m256 divisor_lo = _mm256_cvtepi32_ps(blend_w_lo);
+            __m256 divisor_hi = _mm256_cvtepi32_ps(blend_w_hi);
+            inv_divisor_lo    = _mm256_div_ps(reciprocal_bias, _mm256_add_ps(divisor_lo, divisor_lo));
+            inv_divisor_hi    = _mm256_div_ps(reciprocal_bias, _mm256_add_ps(divisor_hi, divisor_hi));
+        }
+        __m256i blend_r = RaylibSIMD__DivideWeighted16x_AVX2(src_r, dest_r, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+        __m256i blend_g = RaylibSIMD__DivideWeighted16x_AVX2(src_g, dest_g, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+        __m256i blend_b = RaylibSIMD__DivideWeighted16x_AVX2(src_b, dest_b, weights_lo, weights_hi, blend_w_lo, blend_w_hi, inv_divisor_lo, inv_divisor_hi);
+
+        // NOTE: Repack The Pixel to {RGBA1 .. RGBA8} {RGBA9 .. RGBA16}
+        __m256i pixel_rg = _mm256_or_si256(blend_r, _mm256_slli_epi16(blend_g, 8));
+        __m256i pixel_ba = _mm256_or_si256(blend_b, _mm256_slli_epi16(blend_a, 8));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 0),  _mm256_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 32), _mm256_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+RS_FILE_SCOPE RaylibSIMD__BlendRowProc *RaylibSIMD__BlendRowFixed16Kernel(RaylibSIMD_InstructionSet instruction_set)
+{
+    RaylibSIMD__BlendRowProc *result = NULL;
+    switch (instruction_set)
+    {
+        default: break;
+        case RaylibSIMD_InstructionSet_SSE41:  result = RaylibSIMD__BlendRowFixed16_SSE41; break;
+        case RaylibSIMD_InstructionSet_AVX2:
+        case RaylibSIMD_InstructionSet_AVX512: result = RaylibSIMD__BlendRowFixed16_AVX2;  break;
+    }
+    return result;
+}
+
+// NOTE: Premultiplied "over" kernels, see RaylibSIMD__BlendPixelPremultiplied.
+// Pixels are unpacked to 16 bit lanes like the Fixed16 kernels but alpha is
+// treated as a 4th color, the result is a multiply-add per component.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__BlendRowPremultiplied_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    __m128i const zero            = _mm_setzero_si128();
+    __m128i const round_8x        = _mm_set1_epi16(128);
+    __m128i const div255_8x       = _mm_set1_epi16(257);
+    __m128i const max_8x          = _mm_set1_epi16(255);
+    __m128i const deinterleave    = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m128i const tint_r_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.r);
+    __m128i const tint_g_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.g);
+    __m128i const tint_b_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.b);
+    __m128i const tint_a_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 8;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, see RaylibSIMD__BlendRowFixed16_SSE41
+        __m128i src_0123  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 0)),  deinterleave);
+        __m128i src_4567  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 16)), deinterleave);
+        __m128i dest_0123 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 0)),  deinterleave);
+        __m128i dest_4567 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 16)), deinterleave);
+
+        __m128i src_rg  = _mm_unpacklo_epi32(src_0123, src_4567);
+        __m128i src_ba  = _mm_unpackhi_epi32(src_0123, src_4567);
+        __m128i dest_rg = _mm_unpacklo_epi32(dest_0123, dest_4567);
+        __m128i dest_ba = _mm_unpackhi_epi32(dest_0123, dest_4567);
+
+        // NOTE: Tint Source Pixels
+        __m128i src_r = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src_rg, zero), tint_r_8x), round_8x), div255_8x);
+        __m128i src_g = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src_rg, zero), tint_g_8x), round_8x), div255_8x);
+        __m128i src_b = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src_ba, zero), tint_b_8x), round_8x), div255_8x);
+        __m128i src_a = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src_ba, zero), tint_a_8x), round_8x), div255_8x);
+
+        // NOTE: Blend, blend_c = src_c + div255(dest_c * (255 - src_a))
+        __m128i inv_src_a = _mm_sub_epi16(max_8x, src_a);
+        __m128i blend_r   = _mm_add_epi16(src_r, _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dest_rg, zero), inv_src_a), round_8x), div255_8x));
+        __m128i blend_g   = _mm_add_epi16(src_g, _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dest_rg, zero), inv_src_a), round_8x), div255_8x));
+        __m128i blend_b   = _mm_add_epi16(src_b, _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dest_ba, zero), inv_src_a), round_8x), div255_8x));
+        __m128i blend_a   = _mm_add_epi16(src_a, _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dest_ba, zero), inv_src_a), round_8x), div255_8x));
+
+        // NOTE: Repack The Pixel, colors larger than alpha (invalid premultiplied input) saturate
+        __m128i pixel_rg = _mm_or_si128(_mm_min_epi16(blend_r, max_8x), _mm_slli_epi16(_mm_min_epi16(blend_g, max_8x), 8));
+        __m128i pixel_ba = _mm_or_si128(_mm_min_epi16(blend_b, max_8x), _mm_slli_epi16(_mm_min_epi16(blend_a, max_8x), 8));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 0),  _mm_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 16), _mm_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: 16 pixels per iteration, the lane order follows RaylibSIMD__BlendRowFixed16_AVX2.
+RS_FILE_SCOPE RS_TARGET_AVX2 int RaylibSIMD__BlendRowPremultiplied_AVX2(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    __m256i const zero            = _mm256_setzero_si256();
+    __m256i const round_16x       = _mm256_set1_epi16(128);
+    __m256i const div255_16x      = _mm256_set1_epi16(257);
+    __m256i const max_16x         = _mm256_set1_epi16(255);
+    __m256i const deinterleave    = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+    __m256i const tint_r_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.r);
+    __m256i const tint_g_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.g);
+    __m256i const tint_b_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.b);
+    __m256i const tint_a_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 16;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, see RaylibSIMD__BlendRowFixed16_AVX2
+        __m256i src_lo  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 0)),  deinterleave);
+        __m256i src_hi  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 32)), deinterleave);
+        __m256i dest_lo = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 0)),  deinterleave);
+        __m256i dest_hi = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 32)), deinterleave);
+
+        __m256i src_rg  = _mm256_unpacklo_epi32(src_lo, src_hi);
+        __m256i src_ba  = _mm256_unpackhi_epi32(src_lo, src_hi);
+        __m256i dest_rg = _mm256_unpacklo_epi32(dest_lo, dest_hi);
+        __m256i dest_ba = _mm256_unpackhi_epi32(dest_lo, dest_hi);
+
+        // NOTE: Tint Source Pixels
+        __m256i src_r = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src_rg, zero), tint_r_16x), round_16x), div255_16x);
+        __m256i src_g = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src_rg, zero), tint_g_16x), round_16x), div255_16x);
+        __m256i src_b = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src_ba, zero), tint_b_16x), round_16x), div255_16x);
+        __m256i src_a = _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src_ba, zero), tint_a_16x), round_16x), div255_16x);
+
+        // NOTE: Blend
+        __m256i inv_src_a = _mm256_sub_epi16(max_16x, src_a);
+        __m256i blend_r   = _mm256_add_epi16(src_r, _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dest_rg, zero), inv_src_a), round_16x), div255_16x));
+        __m256i blend_g   = _mm256_add_epi16(src_g, _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dest_rg, zero), inv_src_a), round_16x), div255_16x));
+        __m256i blend_b   = _mm256_add_epi16(src_b, _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dest_ba, zero), inv_src_a), round_16x), div255_16x));
+        __m256i blend_a   = _mm256_add_epi16(src_a, _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dest_ba, zero), inv_src_a), round_16x), div255_16x));
+
+        // NOTE: Repack The Pixel
+        __m256i pixel_rg = _mm256_or_si256(_mm256_min_epi16(blend_r, max_16x), _mm256_slli_epi16(_mm256_min_epi16(blend_g, max_16x), 8));
+        __m256i pixel_ba = _mm256_or_si256(_mm256_min_epi16(blend_b, max_16x), _mm256_slli_epi16(_mm256_min_epi16(blend_a, max_16x), 8));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 0),  _mm256_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 32), _mm256_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+RS_FILE_SCOPE RaylibSIMD__BlendRowProc *RaylibSIMD__BlendRowPremultipliedKernel(RaylibSIMD_InstructionSet instruction_set)
+{
+    RaylibSIMD__BlendRowProc *result = NULL;
+    switch (instruction_set)
+    {
+        default: break;
+        case RaylibSIMD_InstructionSet_SSE41:  result = RaylibSIMD__BlendRowPremultiplied_SSE41; break;
+        case RaylibSIMD_InstructionSet_AVX2:
+        case RaylibSIMD_InstructionSet_AVX512: result = RaylibSIMD__BlendRowPremultiplied_AVX2;  break;
+    }
+    return result;
+}
+
+// NOTE: Straight alpha color mode kernels, see RaylibSIMD__BlendPixelMode.
+// The pixel layout is the same as the premultiplied kernels. Each mode gets its
+// own kernel: the bodies below take the mode as an argument and are force
+// inlined into a wrapper per mode (RS_BLEND_MODE_KERNELS) that passes it as a
+// constant, so the switches are resolved at compile time.
+RS_FILE_SCOPE RS_TARGET_SSE41 RS_FORCE_INLINE __m128i RaylibSIMD__Div255_8x_SSE41(__m128i x)
+{
+    return _mm_mulhi_epu16(_mm_add_epi16(x, _mm_set1_epi16(128)), _mm_set1_epi16(257));
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 RS_FORCE_INLINE __m128i RaylibSIMD__BlendChannelMode8x_SSE41(RaylibSIMD_BlendMode mode, __m128i src_c, __m128i dest_c, __m128i src_a)
+{
+    __m128i const max_8x = _mm_set1_epi16(255);
+    __m128i const sa_c   = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(src_c, src_a));
+    __m128i const inv_a  = _mm_sub_epi16(max_8x, src_a);
+    __m128i result       = src_c;
+    switch (mode)
+    {
+        default: break;
+        case RaylibSIMD_BlendMode_Additive: result = _mm_min_epi16(_mm_add_epi16(dest_c, sa_c), max_8x); break;
+        case RaylibSIMD_BlendMode_Subtract: result = _mm_subs_epu16(dest_c, sa_c); break;
+        case RaylibSIMD_BlendMode_Multiply: result = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(dest_c, _mm_add_epi16(inv_a, sa_c))); break;
+        case RaylibSIMD_BlendMode_Screen:   result = _mm_sub_epi16(max_8x, RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(_mm_sub_epi16(max_8x, dest_c), _mm_sub_epi16(max_8x, sa_c)))); break;
+        case RaylibSIMD_BlendMode_Min:      result = RaylibSIMD__Div255_8x_SSE41(_mm_add_epi16(_mm_mullo_epi16(_mm_min_epi16(src_c, dest_c), src_a), _mm_mullo_epi16(dest_c, inv_a))); break;
+        case RaylibSIMD_BlendMode_Max:      result = RaylibSIMD__Div255_8x_SSE41(_mm_add_epi16(_mm_mullo_epi16(_mm_max_epi16(src_c, dest_c), src_a), _mm_mullo_epi16(dest_c, inv_a))); break;
+    }
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 RS_FORCE_INLINE int RaylibSIMD__BlendRowMode_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params, RaylibSIMD_BlendMode mode)
+{
+    __m128i const zero            = _mm_setzero_si128();
+    __m128i const max_8x          = _mm_set1_epi16(255);
+    __m128i const deinterleave    = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    __m128i const tint_r_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.r);
+    __m128i const tint_g_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.g);
+    __m128i const tint_b_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.b);
+    __m128i const tint_a_8x       = _mm_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 8;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, see RaylibSIMD__BlendRowFixed16_SSE41
+        __m128i src_0123  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 0)),  deinterleave);
+        __m128i src_4567  = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(src_ptr + 16)), deinterleave);
+        __m128i dest_0123 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 0)),  deinterleave);
+        __m128i dest_4567 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)(dest_ptr + 16)), deinterleave);
+
+        __m128i src_rg  = _mm_unpacklo_epi32(src_0123, src_4567);
+        __m128i src_ba  = _mm_unpackhi_epi32(src_0123, src_4567);
+        __m128i dest_rg = _mm_unpacklo_epi32(dest_0123, dest_4567);
+        __m128i dest_ba = _mm_unpackhi_epi32(dest_0123, dest_4567);
+
+        // NOTE: Tint Source Pixels
+        __m128i src_r = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(_mm_unpacklo_epi8(src_rg, zero), tint_r_8x));
+        __m128i src_g = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(_mm_unpackhi_epi8(src_rg, zero), tint_g_8x));
+        __m128i src_b = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(_mm_unpacklo_epi8(src_ba, zero), tint_b_8x));
+        __m128i src_a = RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(_mm_unpackhi_epi8(src_ba, zero), tint_a_8x));
+
+        // NOTE: Blend
+        __m128i dest_a  = _mm_unpackhi_epi8(dest_ba, zero);
+        __m128i blend_r = RaylibSIMD__BlendChannelMode8x_SSE41(mode, src_r, _mm_unpacklo_epi8(dest_rg, zero), src_a);
+        __m128i blend_g = RaylibSIMD__BlendChannelMode8x_SSE41(mode, src_g, _mm_unpackhi_epi8(dest_rg, zero), src_a);
+        __m128i blend_b = RaylibSIMD__BlendChannelMode8x_SSE41(mode, src_b, _mm_unpacklo_epi8(dest_ba, zero), src_a);
+        __m128i blend_a = src_a;
+        if (mode != RaylibSIMD_BlendMode_Copy) blend_a = _mm_add_epi16(src_a, RaylibSIMD__Div255_8x_SSE41(_mm_mullo_epi16(dest_a, _mm_sub_epi16(max_8x, src_a))));
+
+        // NOTE: Repack The Pixel, every channel is already in [0, 255]
+        __m128i pixel_rg = _mm_or_si128(blend_r, _mm_slli_epi16(blend_g, 8));
+        __m128i pixel_ba = _mm_or_si128(blend_b, _mm_slli_epi16(blend_a, 8));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 0),  _mm_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm_storeu_si128((__m128i *)(dest_ptr + 16), _mm_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_AVX2 RS_FORCE_INLINE __m256i RaylibSIMD__Div255_16x_AVX2(__m256i x)
+{
+    return _mm256_mulhi_epu16(_mm256_add_epi16(x, _mm256_set1_epi16(128)), _mm256_set1_epi16(257));
+}
+
+RS_FILE_SCOPE RS_TARGET_AVX2 RS_FORCE_INLINE __m256i RaylibSIMD__BlendChannelMode16x_AVX2(RaylibSIMD_BlendMode mode, __m256i src_c, __m256i dest_c, __m256i src_a)
+{
+    __m256i const max_16x = _mm256_set1_epi16(255);
+    __m256i const sa_c    = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(src_c, src_a));
+    __m256i const inv_a   = _mm256_sub_epi16(max_16x, src_a);
+    __m256i result        = src_c;
+    switch (mode)
+    {
+        default: break;
+        case RaylibSIMD_BlendMode_Additive: result = _mm256_min_epi16(_mm256_add_epi16(dest_c, sa_c), max_16x); break;
+        case RaylibSIMD_BlendMode_Subtract: result = _mm256_subs_epu16(dest_c, sa_c); break;
+        case RaylibSIMD_BlendMode_Multiply: result = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(dest_c, _mm256_add_epi16(inv_a, sa_c))); break;
+        case RaylibSIMD_BlendMode_Screen:   result = _mm256_sub_epi16(max_16x, RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(max_16x, dest_c), _mm256_sub_epi16(max_16x, sa_c)))); break;
+        case RaylibSIMD_BlendMode_Min:      result = RaylibSIMD__Div255_16x_AVX2(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_min_epi16(src_c, dest_c), src_a), _mm256_mullo_epi16(dest_c, inv_a))); break;
+        case RaylibSIMD_BlendMode_Max:      result = RaylibSIMD__Div255_16x_AVX2(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_max_epi16(src_c, dest_c), src_a), _mm256_mullo_epi16(dest_c, inv_a))); break;
+    }
+    return result;
+}
+
+// NOTE: 16 pixels per iteration, the lane order follows RaylibSIMD__BlendRowFixed16_AVX2.
+RS_FILE_SCOPE RS_TARGET_AVX2 RS_FORCE_INLINE int RaylibSIMD__BlendRowMode_AVX2(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params, RaylibSIMD_BlendMode mode)
+{
+    __m256i const zero            = _mm256_setzero_si256();
+    __m256i const max_16x         = _mm256_set1_epi16(255);
+    __m256i const deinterleave    = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+    __m256i const tint_r_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.r);
+    __m256i const tint_g_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.g);
+    __m256i const tint_b_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.b);
+    __m256i const tint_a_16x      = _mm256_set1_epi16(RS_CAST(short)params->tint.a);
+
+    int const PIXELS_PER_SIMD_WRITE = 16;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        // NOTE: Extract Pixels From Buffer, see RaylibSIMD__BlendRowFixed16_AVX2
+        __m256i src_lo  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 0)),  deinterleave);
+        __m256i src_hi  = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(src_ptr + 32)), deinterleave);
+        __m256i dest_lo = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 0)),  deinterleave);
+        __m256i dest_hi = _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i *)(dest_ptr + 32)), deinterleave);
+
+        __m256i src_rg  = _mm256_unpacklo_epi32(src_lo, src_hi);
+        __m256i src_ba  = _mm256_unpackhi_epi32(src_lo, src_hi);
+        __m256i dest_rg = _mm256_unpacklo_epi32(dest_lo, dest_hi);
+        __m256i dest_ba = _mm256_unpackhi_epi32(dest_lo, dest_hi);
+
+        // NOTE: Tint Source Pixels
+        __m256i src_r = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src_rg, zero), tint_r_16x));
+        __m256i src_g = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src_rg, zero), tint_g_16x));
+        __m256i src_b = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src_ba, zero), tint_b_16x));
+        __m256i src_a = RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src_ba, zero), tint_a_16x));
+
+        // NOTE: Blend
+        __m256i dest_a  = _mm256_unpackhi_epi8(dest_ba, zero);
+        __m256i blend_r = RaylibSIMD__BlendChannelMode16x_AVX2(mode, src_r, _mm256_unpacklo_epi8(dest_rg, zero), src_a);
+        __m256i blend_g = RaylibSIMD__BlendChannelMode16x_AVX2(mode, src_g, _mm256_unpackhi_epi8(dest_rg, zero), src_a);
+        __m256i blend_b = RaylibSIMD__BlendChannelMode16x_AVX2(mode, src_b, _mm256_unpacklo_epi8(dest_ba, zero), src_a);
+        __m256i blend_a = src_a;
+        if (mode != RaylibSIMD_BlendMode_Copy) blend_a = _mm256_add_epi16(src_a, RaylibSIMD__Div255_16x_AVX2(_mm256_mullo_epi16(dest_a, _mm256_sub_epi16(max_16x, src_a))));
+
+        // NOTE: Repack The Pixel
+        __m256i pixel_rg = _mm256_or_si256(blend_r, _mm256_slli_epi16(blend_g, 8));
+        __m256i pixel_ba = _mm256_or_si256(blend_b, _mm256_slli_epi16(blend_a, 8));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 0),  _mm256_unpacklo_epi16(pixel_rg, pixel_ba));
+        _mm256_storeu_si256((__m256i *)(dest_ptr + 32), _mm256_unpackhi_epi16(pixel_rg, pixel_ba));
+
+        src_ptr += PIXELS_PER_SIMD_WRITE * 4;
+        dest_ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+#define RS_BLEND_MODE_KERNELS(name)                                                                                                                                  \
+    RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__BlendRow##name##_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params) \
+    {                                                                                                                                                                \
+        return RaylibSIMD__BlendRowMode_SSE41(src_ptr, dest_ptr, pixels, params, RaylibSIMD_BlendMode_##name);                                                       \
+    }                                                                                                                                                                \
+    RS_FILE_SCOPE RS_TARGET_AVX2 int RaylibSIMD__BlendRow##name##_AVX2(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)   \
+    {                                                                                                                                                                \
+        return RaylibSIMD__BlendRowMode_AVX2(src_ptr, dest_ptr, pixels, params, RaylibSIMD_BlendMode_##name);                                                        \
+    }
+
+RS_BLEND_MODE_KERNELS(Additive)
+RS_BLEND_MODE_KERNELS(Subtract)
+RS_BLEND_MODE_KERNELS(Multiply)
+RS_BLEND_MODE_KERNELS(Screen)
+RS_BLEND_MODE_KERNELS(Min)
+RS_BLEND_MODE_KERNELS(Max)
+RS_BLEND_MODE_KERNELS(Copy)
+
+// NOTE: Kernels of a color mode, the SSE4.1 one also blends the tails
+RS_FILE_SCOPE void RaylibSIMD__BlendRowModeKernels(RaylibSIMD_BlendMode mode, RaylibSIMD_InstructionSet instruction_set, RaylibSIMD__BlendRowProc **blend_row, RaylibSIMD__BlendRowProc **blend_row_sse)
+{
+    RaylibSIMD__BlendRowProc *sse41 = NULL;
+    RaylibSIMD__BlendRowProc *avx2  = NULL;
+    switch (mode)
+    {
+        default: break;
+        case RaylibSIMD_BlendMode_Additive: sse41 = RaylibSIMD__BlendRowAdditive_SSE41; avx2 = RaylibSIMD__BlendRowAdditive_AVX2; break;
+        case RaylibSIMD_BlendMode_Subtract: sse41 = RaylibSIMD__BlendRowSubtract_SSE41; avx2 = RaylibSIMD__BlendRowSubtract_AVX2; break;
+        case RaylibSIMD_BlendMode_Multiply: sse41 = RaylibSIMD__BlendRowMultiply_SSE41; avx2 = RaylibSIMD__BlendRowMultiply_AVX2; break;
+        case RaylibSIMD_BlendMode_Screen:   sse41 = RaylibSIMD__BlendRowScreen_SSE41;   avx2 = RaylibSIMD__BlendRowScreen_AVX2;   break;
+        case RaylibSIMD_BlendMode_Min:      sse41 = RaylibSIMD__BlendRowMin_SSE41;      avx2 = RaylibSIMD__BlendRowMin_AVX2;      break;
+        case RaylibSIMD_BlendMode_Max:      sse41 = RaylibSIMD__BlendRowMax_SSE41;      avx2 = RaylibSIMD__BlendRowMax_AVX2;      break;
+        case RaylibSIMD_BlendMode_Copy:     sse41 = RaylibSIMD__BlendRowCopy_SSE41;     avx2 = RaylibSIMD__BlendRowCopy_AVX2;     break;
+    }
+
+    *blend_row     = (instruction_set >= RaylibSIMD_InstructionSet_AVX2) ? avx2 : sse41;
+    *blend_row_sse = sse41;
+}
+
+// NOTE: Premultiply 4 R8G8B8A8 pixels per iteration, see RaylibSIMD__PremultiplyPixel.
+// Each pixel is widened to 16 bit lanes and multiplied by its own alpha
+// broadcast over r, g, b. Alpha is multiplied by 255, i.e. left unchanged.
+//
+// Widened    | {R1 G1 B1 A1 R2 G2 B2 A2}
+// Multiplier | {A1 A1 A1 255 A2 A2 A2 255}
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__PremultiplyRow_SSE41(unsigned char *ptr, int pixels)
+{
+    __m128i const zero         = _mm_setzero_si128();
+    __m128i const round_8x     = _mm_set1_epi16(128);
+    __m128i const div255_8x    = _mm_set1_epi16(257);
+    __m128i const alpha_lo     = _mm_setr_epi8(3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1);
+    __m128i const alpha_hi     = _mm_setr_epi8(11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1);
+    __m128i const alpha_255    = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+
+    int const PIXELS_PER_SIMD_WRITE = 4;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        __m128i pixels_4x     = _mm_loadu_si128((__m128i *)ptr);
+        __m128i multiplier_lo = _mm_or_si128(_mm_shuffle_epi8(pixels_4x, alpha_lo), alpha_255);
+        __m128i multiplier_hi = _mm_or_si128(_mm_shuffle_epi8(pixels_4x, alpha_hi), alpha_255);
+        __m128i result_lo     = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels_4x, zero), multiplier_lo), round_8x), div255_8x);
+        __m128i result_hi     = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels_4x, zero), multiplier_hi), round_8x), div255_8x);
+        _mm_storeu_si128((__m128i *)ptr, _mm_packus_epi16(result_lo, result_hi));
+        ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: Unpremultiply 4 R8G8B8A8 pixels per iteration, see RaylibSIMD__UnpremultiplyPixel.
+// Same layout as premultiply with the alpha as the divisor, the exact divide
+// is RaylibSIMD__DivideRounded8x_SSE41. Alpha is divided by 255,
+// i.e. left unchanged.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__UnpremultiplyRow_SSE41(unsigned char *ptr, int pixels)
+{
+    __m128i const zero            = _mm_setzero_si128();
+    __m128i const max_8x          = _mm_set1_epi16(255);
+    __m128 const reciprocal_bias  = _mm_set1_ps(1.f + (1.f / 1048576.f));
+    __m128i const alpha_lo        = _mm_setr_epi8(3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1);
+    __m128i const alpha_hi        = _mm_setr_epi8(11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1);
+    __m128i const alpha_255       = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+
+    int const PIXELS_PER_SIMD_WRITE = 4;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        __m128i pixels_4x  = _mm_loadu_si128((__m128i *)ptr);
+        __m128i divisor_lo = _mm_or_si128(_mm_shuffle_epi8(pixels_4x, alpha_lo), alpha_255);
+        __m128i divisor_hi = _mm_or_si128(_mm_shuffle_epi8(pixels_4x, alpha_hi), alpha_255);
+
+        __m128 divisor_lo_lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(divisor_lo, zero));
+        __m128 divisor_lo_hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(divisor_lo, zero));
+        __m128 divisor_hi_lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(divisor_hi, zero));
+        __m128 divisor_hi_hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(divisor_hi, zero));
+
+        __m128i result_lo = RaylibSIMD__DivideRounded8x_SSE41(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels_4x, zero), max_8x),
+                                                              divisor_lo,
+                                                              _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_lo_lo, divisor_lo_lo)),
+                                                              _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_lo_hi, divisor_lo_hi)));
+        __m128i result_hi = RaylibSIMD__DivideRounded8x_SSE41(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels_4x, zero), max_8x),
+                                                              divisor_hi,
+                                                              _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_hi_lo, divisor_hi_lo)),
+                                                              _mm_div_ps(reciprocal_bias, _mm_add_ps(divisor_hi_hi, divisor_hi_hi)));
+
+        // NOTE: Colors larger than alpha (invalid premultiplied input) clamp
+        // to 255, the pack saturates as signed 16 bit so clamp first.
+        result_lo = _mm_min_epu16(result_lo, max_8x);
+        result_hi = _mm_min_epu16(result_hi, max_8x);
+        _mm_storeu_si128((__m128i *)ptr, _mm_packus_epi16(result_lo, result_hi));
+        ptr += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: Pixel format conversion, the same math as raylib's ImageFormat.
+// Pixels are decoded to normalized floats like GetImageDataNormalized, then
+// encoded to the new format, where
+//
+// 8 bit channels   | (unsigned char)(channel * 255)
+// 4/5/6 bit        | round(channel * 15/31/63), halfway rounds away from zero
+// 1 bit alpha      | alpha > 50/255
+// Gray             | r * 0.299 + g * 0.587 + b * 0.114
+// R32              | Decodes into red only, like GetPixelColor
+//
+// Unlike raylib, channels outside [0, 1] (from the float formats) saturate
+// instead of wrapping into the neighbouring bits.
+//
+// The SIMD kernels are bit-exact with the scalar reference below.
+RS_FILE_SCOPE void RaylibSIMD__DecodePixel(unsigned char const *src, int format, float channels[4])
+{
+    channels[0] = channels[1] = channels[2] = 0.0f;
+    channels[3] = 1.0f;
+    switch (format)
+    {
+        default: break;
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            channels[0] = channels[1] = channels[2] = RS_CAST(float)src[0] / 255.0f;
+        }
+        break;
+
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            channels[0] = channels[1] = channels[2] = RS_CAST(float)src[0] / 255.0f;
+            channels[3] = RS_CAST(float)src[1] / 255.0f;
+        }
+        break;
+
+        case UNCOMPRESSED_R5G6B5:
+        {
+            uint16_t pixel = 0;
+            memcpy(&pixel, src, sizeof(pixel));
+            channels[0] = RS_CAST(float)((pixel >> 11) & 0x1F) * (1.0f / 31);
+            channels[1] = RS_CAST(float)((pixel >> 5) & 0x3F) * (1.0f / 63);
+            channels[2] = RS_CAST(float)((pixel >> 0) & 0x1F) * (1.0f / 31);
+        }
+        break;
+
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            uint16_t pixel = 0;
+            memcpy(&pixel, src, sizeof(pixel));
+            channels[0] = RS_CAST(float)((pixel >> 11) & 0x1F) * (1.0f / 31);
+            channels[1] = RS_CAST(float)((pixel >> 6) & 0x1F) * (1.0f / 31);
+            channels[2] = RS_CAST(float)((pixel >> 1) & 0x1F) * (1.0f / 31);
+            channels[3] = RS_CAST(float)(pixel & 0x1);
+        }
+        break;
+
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            uint16_t pixel = 0;
+            memcpy(&pixel, src, sizeof(pixel));
+            channels[0] = RS_CAST(float)((pixel >> 12) & 0xF) * (1.0f / 15);
+            channels[1] = RS_CAST(float)((pixel >> 8) & 0xF) * (1.0f / 15);
+            channels[2] = RS_CAST(float)((pixel >> 4) & 0xF) * (1.0f / 15);
+            channels[3] = RS_CAST(float)((pixel >> 0) & 0xF) * (1.0f / 15);
+        }
+        break;
+
+        case UNCOMPRESSED_R8G8B8A8: channels[3] = RS_CAST(float)src[3] / 255.0f; // fallthrough
+        case UNCOMPRESSED_R8G8B8:
+        {
+            channels[0] = RS_CAST(float)src[0] / 255.0f;
+            channels[1] = RS_CAST(float)src[1] / 255.0f;
+            channels[2] = RS_CAST(float)src[2] / 255.0f;
+        }
+        break;
+
+        case UNCOMPRESSED_R32:          memcpy(channels, src, sizeof(float) * 1); break;
+        case UNCOMPRESSED_R32G32B32:    memcpy(channels, src, sizeof(float) * 3); break;
+        case UNCOMPRESSED_R32G32B32A32: memcpy(channels, src, sizeof(float) * 4); break;
+    }
+}
+
+// NOTE: (unsigned char)(value * scale) with saturation
+RS_FILE_SCOPE uint32_t RaylibSIMD__EncodeTruncate(float value, float scale)
+{
+    float scaled    = RS_MIN(RS_MAX(value * scale, 0.0f), scale);
+    uint32_t result = RS_CAST(uint32_t)scaled;
+    return result;
+}
+
+// NOTE: round(value * scale) with saturation
+RS_FILE_SCOPE uint32_t RaylibSIMD__EncodeRound(float value, float scale)
+{
+    float scaled    = RS_MIN(RS_MAX(value * scale, 0.0f), scale);
+    uint32_t result = RS_CAST(uint32_t)scaled;
+    if (scaled - RS_CAST(float)result >= 0.5f) result++;
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__EncodePixel(float const channels[4], int format, unsigned char *dest)
+{
+    float const gray = channels[0] * 0.299f + channels[1] * 0.587f + channels[2] * 0.114f;
+    switch (format)
+    {
+        default: break;
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            dest[0] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(gray, 255.0f);
+        }
+        break;
+
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            dest[0] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(gray, 255.0f);
+            dest[1] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(channels[3], 255.0f);
+        }
+        break;
+
+        case UNCOMPRESSED_R5G6B5:
+        {
+            uint16_t pixel = RS_CAST(uint16_t)(RaylibSIMD__EncodeRound(channels[0], 31.0f) << 11 |
+                                               RaylibSIMD__EncodeRound(channels[1], 63.0f) << 5 |
+                                               RaylibSIMD__EncodeRound(channels[2], 31.0f) << 0);
+            memcpy(dest, &pixel, sizeof(pixel));
+        }
+        break;
+
+        case UNCOMPRESSED_R5G5B5A1:
+        {
+            uint16_t pixel = RS_CAST(uint16_t)(RaylibSIMD__EncodeRound(channels[0], 31.0f) << 11 |
+                                               RaylibSIMD__EncodeRound(channels[1], 31.0f) << 6 |
+                                               RaylibSIMD__EncodeRound(channels[2], 31.0f) << 1 |
+                                               (channels[3] > (50.0f / 255.0f) ? 1 : 0));
+            memcpy(dest, &pixel, sizeof(pixel));
+        }
+        break;
+
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            uint16_t pixel = RS_CAST(uint16_t)(RaylibSIMD__EncodeRound(channels[0], 15.0f) << 12 |
+                                               RaylibSIMD__EncodeRound(channels[1], 15.0f) << 8 |
+                                               RaylibSIMD__EncodeRound(channels[2], 15.0f) << 4 |
+                                               RaylibSIMD__EncodeRound(channels[3], 15.0f) << 0);
+            memcpy(dest, &pixel, sizeof(pixel));
+        }
+        break;
+
+        case UNCOMPRESSED_R8G8B8A8: dest[3] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(channels[3], 255.0f); // fallthrough
+        case UNCOMPRESSED_R8G8B8:
+        {
+            dest[0] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(channels[0], 255.0f);
+            dest[1] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(channels[1], 255.0f);
+            dest[2] = RS_CAST(unsigned char)RaylibSIMD__EncodeTruncate(channels[2], 255.0f);
+        }
+        break;
+
+        case UNCOMPRESSED_R32:          memcpy(dest, &gray, sizeof(float)); break;
+        case UNCOMPRESSED_R32G32B32:    memcpy(dest, channels, sizeof(float) * 3); break;
+        case UNCOMPRESSED_R32G32B32A32: memcpy(dest, channels, sizeof(float) * 4); break;
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ConvertPixels(unsigned char const *src, int src_format, unsigned char *dest, int dest_format, int pixels)
+{
+    int const src_bytes_per_pixel  = RaylibSIMD__FormatToBitsPerPixel(src_format) / 8;
+    int const dest_bytes_per_pixel = RaylibSIMD__FormatToBitsPerPixel(dest_format) / 8;
+    for (int index = 0; index < pixels; index++)
+    {
+        float channels[4];
+        RaylibSIMD__DecodePixel(src + index * src_bytes_per_pixel, src_format, channels);
+        RaylibSIMD__EncodePixel(channels, dest_format, dest + index * dest_bytes_per_pixel);
+    }
+}
+
+// NOTE: Decode 4 pixels into 4 channel vectors {R0 R1 R2 R3}, {G0 ..}, ..
+// Reads exactly 4 pixels.
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__DecodePixels4x_SSE41(unsigned char const *src, int format, __m128 channels[4])
+{
+    __m128 const divisor_255 = _mm_set1_ps(255.0f);
+    __m128i const mask_8 = _mm_set1_epi32(0xFF);
+    channels[0] = channels[1] = channels[2] = _mm_setzero_ps();
+    channels[3] = _mm_set1_ps(1.0f);
+    switch (format)
+    {
+        default: break;
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            int32_t pixels = 0;
+            memcpy(&pixels, src, sizeof(pixels));
+            __m128 gray = _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(pixels))), divisor_255);
+            channels[0] = channels[1] = channels[2] = gray;
+        }
+        break;
+
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            __m128i pixels = _mm_cvtepu16_epi32(_mm_loadl_epi64(RS_CAST(__m128i const *)src));
+            __m128 gray    = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, mask_8)), divisor_255);
+            channels[0] = channels[1] = channels[2] = gray;
+            channels[3] = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(pixels, 8)), divisor_255);
+        }
+        break;
+
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
+        case UNCOMPRESSED_R4G4B4A4:
+        {
+            __m128i pixels = _mm_cvtepu16_epi32(_mm_loadl_epi64(RS_CAST(__m128i const *)src));
+            if (format == UNCOMPRESSED_R5G6B5)
+            {
+                channels[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 11), _mm_set1_epi32(0x1F))), _mm_set1_ps(1.0f / 31));
+                channels[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 5),  _mm_set1_epi32(0x3F))), _mm_set1_ps(1.0f / 63));
+                channels[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels,                     _mm_set1_epi32(0x1F))), _mm_set1_ps(1.0f / 31));
+            }
+            else if (format == UNCOMPRESSED_R5G5B5A1)
+            {
+                channels[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 11), _mm_set1_epi32(0x1F))), _mm_set1_ps(1.0f / 31));
+                channels[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 6),  _mm_set1_epi32(0x1F))), _mm_set1_ps(1.0f / 31));
+                channels[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 1),  _mm_set1_epi32(0x1F))), _mm_set1_ps(1.0f / 31));
+                channels[3] = _mm_cvtepi32_ps(_mm_and_si128(pixels, _mm_set1_epi32(0x1)));
+            }
+            else
+            {
+                __m128 const inv_15 = _mm_set1_ps(1.0f / 15);
+                __m128i const mask  = _mm_set1_epi32(0xF);
+                channels[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 12), mask)), inv_15);
+                channels[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8),  mask)), inv_15);
+                channels[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 4),  mask)), inv_15);
+                channels[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, mask)), inv_15);
+            }
+        }
+        break;
+
+        case UNCOMPRESSED_R8G8B8:
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            // NOTE: Expand R8G8B8 to {R G B _} per 32 bit lane, then both
+            // formats split into channels the same way.
+            __m128i pixels;
+            if (format == UNCOMPRESSED_R8G8B8)
+            {
+                int32_t last = 0;
+                memcpy(&last, src + 8, sizeof(last));
+                pixels = _mm_insert_epi32(_mm_loadl_epi64(RS_CAST(__m128i const *)src), last, 2);
+                pixels = _mm_shuffle_epi8(pixels, _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+            }
+            else
+            {
+                pixels      = _mm_loadu_si128(RS_CAST(__m128i const *)src);
+                channels[3] = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(pixels, 24)), divisor_255);
+            }
+
+            channels[0] = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, mask_8)), divisor_255);
+            channels[1] = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), mask_8)), divisor_255);
+            channels[2] = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), mask_8)), divisor_255);
+        }
+        break;
+
+        case UNCOMPRESSED_R32:
+        {
+            channels[0] = _mm_loadu_ps(RS_CAST(float const *)src);
+        }
+        break;
+
+        case UNCOMPRESSED_R32G32B32:
+        {
+            float const *floats = RS_CAST(float const *)src;
+            __m128 pixel0       = _mm_loadu_ps(floats + 0);
+            __m128 pixel1       = _mm_loadu_ps(floats + 3);
+            __m128 pixel2       = _mm_loadu_ps(floats + 6);
+            __m128 pixel3       = _mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(RS_CAST(__m128i const *)(floats + 9))), _mm_load_ss(floats + 11));
+            _MM_TRANSPOSE4_PS(pixel0, pixel1, pixel2, pixel3);
+            channels[0] = pixel0;
+            channels[1] = pixel1;
+            channels[2] = pixel2;
+        }
+        break;
+
+        case UNCOMPRESSED_R32G32B32A32:
+        {
+            float const *floats = RS_CAST(float const *)src;
+            __m128 pixel0       = _mm_loadu_ps(floats + 0);
+            __m128 pixel1       = _mm_loadu_ps(floats + 4);
+            __m128 pixel2       = _mm_loadu_ps(floats + 8);
+            __m128 pixel3       = _mm_loadu_ps(floats + 12);
+            _MM_TRANSPOSE4_PS(pixel0, pixel1, pixel2, pixel3);
+            channels[0] = pixel0;
+            channels[1] = pixel1;
+            channels[2] = pixel2;
+            channels[3] = pixel3;
+        }
+        break;
+    }
+}
+
+// NOTE: SIMD versions of RaylibSIMD__EncodeTruncate/EncodeRound, 4 channels at a time
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128i RaylibSIMD__EncodeTruncate4x_SSE41(__m128 value, float scale)
+{
+    __m128 const scale_4x = _mm_set1_ps(scale);
+    __m128 scaled         = _mm_min_ps(_mm_max_ps(_mm_mul_ps(value, scale_4x), _mm_setzero_ps()), scale_4x);
+    __m128i result        = _mm_cvttps_epi32(scaled);
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128i RaylibSIMD__EncodeRound4x_SSE41(__m128 value, float scale)
+{
+    __m128 const scale_4x = _mm_set1_ps(scale);
+    __m128 scaled         = _mm_min_ps(_mm_max_ps(_mm_mul_ps(value, scale_4x), _mm_setzero_ps()), scale_4x);
+    __m128 truncated      = _mm_round_ps(scaled, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m128 round_up       = _mm_cmpge_ps(_mm_sub_ps(scaled, truncated), _mm_set1_ps(0.5f));
+    __m128i result        = _mm_sub_epi32(_mm_cvttps_epi32(truncated), _mm_castps_si128(round_up)); // round_up is -1 when set
+    return result;
+}
+
+// NOTE: Encode 4 pixels from channel vectors, writes exactly 4 pixels.
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__EncodePixels4x_SSE41(__m128 const channels[4], int format, unsigned char *dest)
+{
+    __m128 const gray = _mm_add_ps(_mm_add_ps(_mm_mul_ps(channels[0], _mm_set1_ps(0.299f)),
+                                              _mm_mul_ps(channels[1], _mm_set1_ps(0.587f))),
+                                   _mm_mul_ps(channels[2], _mm_set1_ps(0.114f)));
+    switch (format)
+    {
+        default: break;
+        case UNCOMPRESSED_GRAYSCALE:
+        {
+            __m128i pixels = RaylibSIMD__EncodeTruncate4x_SSE41(gray, 255.0f);
+            pixels         = _mm_shuffle_epi8(pixels, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+            int32_t packed = _mm_cvtsi128_si32(pixels);
+            memcpy(dest, &packed, sizeof(packed));
+        }
+        break;
+
+        case UNCOMPRESSED_GRAY_ALPHA:
+        {
+            __m128i pixels = _mm_or_si128(RaylibSIMD__EncodeTruncate4x_SSE41(gray, 255.0f),
+                                          _mm_slli_epi32(RaylibSIMD__EncodeTruncate4x_SSE41(channels[3], 255.0f), 8));
+            _mm_storel_epi64(RS_CAST(__m128i *)dest, _mm_packus_epi32(pixels, pixels));
+        }
+        break;
+
+        case UNCOMPRESSED_R5G6B5:
+        case UNCOMPRESSED_R5G5B5A1:
         case UNCOMPRESSED_R4G4B4A4:
         {
-            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
-                                           2, 3, 2, 3,
-                                           4, 5, 4, 5,
-                                           6, 7, 6, 7);
-            result.r_bit_mask = 0b1111;
-            result.g_bit_mask = 0b1111;
-            result.b_bit_mask = 0b1111;
-            result.a_bit_mask = 0b1111;
+            __m128i pixels;
+            if (format == UNCOMPRESSED_R5G6B5)
+            {
+                pixels = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[0], 31.0f), 11),
+                                                   _mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[1], 63.0f), 5)),
+                                      RaylibSIMD__EncodeRound4x_SSE41(channels[2], 31.0f));
+            }
+            else if (format == UNCOMPRESSED_R5G5B5A1)
+            {
+                __m128i alpha = _mm_srli_epi32(_mm_castps_si128(_mm_cmpgt_ps(channels[3], _mm_set1_ps(50.0f / 255.0f))), 31);
+                pixels = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[0], 31.0f), 11),
+                                                   _mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[1], 31.0f), 6)),
+                                      _mm_or_si128(_mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[2], 31.0f), 1), alpha));
+            }
+            else
+            {
+                pixels = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[0], 15.0f), 12),
+                                                   _mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[1], 15.0f), 8)),
+                                      _mm_or_si128(_mm_slli_epi32(RaylibSIMD__EncodeRound4x_SSE41(channels[2], 15.0f), 4),
+                                                   RaylibSIMD__EncodeRound4x_SSE41(channels[3], 15.0f)));
+            }
+            _mm_storel_epi64(RS_CAST(__m128i *)dest, _mm_packus_epi32(pixels, pixels));
+        }
+        break;
+
+        case UNCOMPRESSED_R8G8B8:
+        case UNCOMPRESSED_R8G8B8A8:
+        {
+            __m128i pixels = _mm_or_si128(_mm_or_si128(RaylibSIMD__EncodeTruncate4x_SSE41(channels[0], 255.0f),
+                                                       _mm_slli_epi32(RaylibSIMD__EncodeTruncate4x_SSE41(channels[1], 255.0f), 8)),
+                                          _mm_slli_epi32(RaylibSIMD__EncodeTruncate4x_SSE41(channels[2], 255.0f), 16));
+            if (format == UNCOMPRESSED_R8G8B8A8)
+            {
+                pixels = _mm_or_si128(pixels, _mm_slli_epi32(RaylibSIMD__EncodeTruncate4x_SSE41(channels[3], 255.0f), 24));
+                _mm_storeu_si128(RS_CAST(__m128i *)dest, pixels);
+            }
+            else
+            {
+                pixels         = _mm_shuffle_epi8(pixels, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+                int32_t last   = _mm_extract_epi32(pixels, 2);
+                _mm_storel_epi64(RS_CAST(__m128i *)dest, pixels);
+                memcpy(dest + 8, &last, sizeof(last));
+            }
+        }
+        break;
+
+        case UNCOMPRESSED_R32:
+        {
+            _mm_storeu_ps(RS_CAST(float *)dest, gray);
+        }
+        break;
+
+        case UNCOMPRESSED_R32G32B32:
+        case UNCOMPRESSED_R32G32B32A32:
+        {
+            __m128 pixel0 = channels[0];
+            __m128 pixel1 = channels[1];
+            __m128 pixel2 = channels[2];
+            __m128 pixel3 = channels[3];
+            _MM_TRANSPOSE4_PS(pixel0, pixel1, pixel2, pixel3);
+
+            float *floats = RS_CAST(float *)dest;
+            if (format == UNCOMPRESSED_R32G32B32A32)
+            {
+                _mm_storeu_ps(floats + 0,  pixel0);
+                _mm_storeu_ps(floats + 4,  pixel1);
+                _mm_storeu_ps(floats + 8,  pixel2);
+                _mm_storeu_ps(floats + 12, pixel3);
+            }
+            else
+            {
+                // NOTE: The 4th lane of each store is overwritten by the next pixel
+                _mm_storeu_ps(floats + 0, pixel0);
+                _mm_storeu_ps(floats + 3, pixel1);
+                _mm_storeu_ps(floats + 6, pixel2);
+                _mm_storel_pi(RS_CAST(__m64 *)(floats + 9), pixel3);
+                _mm_store_ss(floats + 11, _mm_movehl_ps(pixel3, pixel3));
+            }
+        }
+        break;
+    }
+}
+
+// NOTE: Float formats blend on the channels of the conversion kernels instead
+// of the lane layout, so HDR colors above 1 pass through the blend unclamped
+// and float destinations are stored without quantization. Alpha is clamped to
+// [0, 1] and integer destinations are encoded like RaylibSIMD_ImageFormat,
+// except 8 bit channels round (through encode_bias) like the other kernels.
+RS_FILE_SCOPE void RaylibSIMD__BlendPixelChannels(unsigned char const *src_ptr, unsigned char *dest_ptr, RaylibSIMD__BlendParams const *params)
+{
+    float src[4], dest[4], blend[4];
+    RaylibSIMD__DecodePixel(src_ptr, params->src_format, src);
+    RaylibSIMD__DecodePixel(dest_ptr, params->dest_format, dest);
+
+    float const tint01[3]   = {params->tint_r01, params->tint_g01, params->tint_b01};
+    float const src_a01     = RS_MIN(RS_MAX(src[3] * params->tint_a01, 0.f), 1.f);
+    float const dest_a01    = RS_MIN(RS_MAX(dest[3], 0.f), 1.f);
+    float const dest_weight = dest_a01 * (1.f - src_a01);
+    blend[3]                = src_a01 + dest_weight;
+
+    float const divisor = RS_MAX(blend[3], 1e-30f);
+    for (int channel = 0; channel < 3; channel++)
+        blend[channel] = (src[channel] * tint01[channel] * src_a01 + dest[channel] * dest_weight) / divisor + params->encode_bias;
+    blend[3] += params->encode_bias;
+
+    RaylibSIMD__EncodePixel(blend, params->dest_format, dest_ptr);
+}
+
+// NOTE: Decode and encode touch exactly 4 pixels so there is no over-read to
+// leave to the caller.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__BlendRowChannels_SSE41(unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels, RaylibSIMD__BlendParams const *params)
+{
+    __m128 const tint01_4x[3]  = {_mm_set1_ps(params->tint_r01), _mm_set1_ps(params->tint_g01), _mm_set1_ps(params->tint_b01)};
+    __m128 const tint_a01_4x   = _mm_set1_ps(params->tint_a01);
+    __m128 const zero_4x       = _mm_setzero_ps();
+    __m128 const one_4x        = _mm_set1_ps(1.f);
+    __m128 const min_divisor   = _mm_set1_ps(1e-30f);
+    __m128 const encode_bias   = _mm_set1_ps(params->encode_bias);
+
+    int const PIXELS_PER_SIMD_WRITE     = 4;
+    int const src_bytes_per_simd_write  = PIXELS_PER_SIMD_WRITE * params->src_bytes_per_pixel;
+    int const dest_bytes_per_simd_write = PIXELS_PER_SIMD_WRITE * params->dest_bytes_per_pixel;
+    int const simd_iterations           = pixels / PIXELS_PER_SIMD_WRITE;
+
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        __m128 src[4], dest[4], blend[4];
+        RaylibSIMD__DecodePixels4x_SSE41(src_ptr, params->src_format, src);
+        RaylibSIMD__DecodePixels4x_SSE41(dest_ptr, params->dest_format, dest);
+
+        // NOTE: Porter Duff Blend, see RaylibSIMD__BlendRow_SSE41
+        __m128 src_a01     = _mm_min_ps(_mm_max_ps(_mm_mul_ps(src[3], tint_a01_4x), zero_4x), one_4x);
+        __m128 dest_a01    = _mm_min_ps(_mm_max_ps(dest[3], zero_4x), one_4x);
+        __m128 dest_weight = _mm_mul_ps(dest_a01, _mm_sub_ps(one_4x, src_a01));
+        __m128 blend_a01   = _mm_add_ps(src_a01, dest_weight);
+        blend[3]           = _mm_add_ps(blend_a01, encode_bias);
+
+        __m128 divisor = _mm_max_ps(blend_a01, min_divisor);
+        for (int channel = 0; channel < 3; channel++)
+        {
+            __m128 src_weighted  = _mm_mul_ps(_mm_mul_ps(src[channel], tint01_4x[channel]), src_a01);
+            blend[channel]       = _mm_add_ps(_mm_div_ps(_mm_add_ps(src_weighted, _mm_mul_ps(dest[channel], dest_weight)), divisor), encode_bias);
+        }
+
+        RaylibSIMD__EncodePixels4x_SSE41(blend, params->dest_format, dest_ptr);
+        src_ptr += src_bytes_per_simd_write;
+        dest_ptr += dest_bytes_per_simd_write;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: Straight byte shuffles between R8G8B8 and R8G8B8A8, since an 8 bit
+// channel survives the trip through [0, 1] floats unchanged. 16 pixels per
+// iteration, returns the number of pixels converted.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__ConvertR8G8B8ToR8G8B8A8_SSE41(unsigned char const *src, unsigned char *dest, int pixels)
+{
+    __m128i const expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    __m128i const alpha  = _mm_set1_epi32(RS_CAST(int)0xFF000000);
+    int result           = 0;
+
+    // NOTE: The last load reads 4 bytes past the 16th pixel, so at least 2
+    // more pixels must follow it to stay inside the source.
+    for (; result + 16 + 2 <= pixels; result += 16, src += 48, dest += 64)
+    {
+        __m128i src0 = _mm_loadu_si128(RS_CAST(__m128i const *)(src + 0));
+        __m128i src1 = _mm_loadu_si128(RS_CAST(__m128i const *)(src + 12));
+        __m128i src2 = _mm_loadu_si128(RS_CAST(__m128i const *)(src + 24));
+        __m128i src3 = _mm_loadu_si128(RS_CAST(__m128i const *)(src + 36));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 0),  _mm_or_si128(_mm_shuffle_epi8(src0, expand), alpha));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 16), _mm_or_si128(_mm_shuffle_epi8(src1, expand), alpha));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 32), _mm_or_si128(_mm_shuffle_epi8(src2, expand), alpha));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 48), _mm_or_si128(_mm_shuffle_epi8(src3, expand), alpha));
+    }
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__ConvertR8G8B8A8ToR8G8B8_SSE41(unsigned char const *src, unsigned char *dest, int pixels)
+{
+    __m128i const compact = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    int result            = 0;
+
+    // NOTE: Each store writes 4 bytes past its 4 pixels which the next store
+    // overwrites, so at least 2 more pixels must follow the last one to stay
+    // inside dest.
+    for (; result + 16 + 2 <= pixels; result += 16, src += 64, dest += 48)
+    {
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 0),  _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(src + 0)), compact));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 12), _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(src + 16)), compact));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 24), _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(src + 32)), compact));
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + 36), _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(src + 48)), compact));
+    }
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__ConvertPixels_SSE41(unsigned char const *src, int src_format, unsigned char *dest, int dest_format, int pixels)
+{
+    int const src_bytes_per_pixel  = RaylibSIMD__FormatToBitsPerPixel(src_format) / 8;
+    int const dest_bytes_per_pixel = RaylibSIMD__FormatToBitsPerPixel(dest_format) / 8;
+
+    int converted = 0;
+    if (src_format == UNCOMPRESSED_R8G8B8 && dest_format == UNCOMPRESSED_R8G8B8A8)      converted = RaylibSIMD__ConvertR8G8B8ToR8G8B8A8_SSE41(src, dest, pixels);
+    else if (src_format == UNCOMPRESSED_R8G8B8A8 && dest_format == UNCOMPRESSED_R8G8B8) converted = RaylibSIMD__ConvertR8G8B8A8ToR8G8B8_SSE41(src, dest, pixels);
+    src  += converted * src_bytes_per_pixel;
+    dest += converted * dest_bytes_per_pixel;
+
+    __m128 channels[4];
+    for (; converted + 4 <= pixels; converted += 4)
+    {
+        RaylibSIMD__DecodePixels4x_SSE41(src, src_format, channels);
+        RaylibSIMD__EncodePixels4x_SSE41(channels, dest_format, dest);
+        src  += 4 * src_bytes_per_pixel;
+        dest += 4 * dest_bytes_per_pixel;
+    }
+
+    // NOTE: Convert the last pixels through a scratch buffer so that they get
+    // the exact same math without reading or writing past the image.
+    int const remaining = pixels - converted;
+    if (remaining)
+    {
+        unsigned char src_pixels[4 * 16]  = {0};
+        unsigned char dest_pixels[4 * 16] = {0};
+        memcpy(src_pixels, src, remaining * src_bytes_per_pixel);
+        RaylibSIMD__DecodePixels4x_SSE41(src_pixels, src_format, channels);
+        RaylibSIMD__EncodePixels4x_SSE41(channels, dest_format, dest_pixels);
+        memcpy(dest, dest_pixels, remaining * dest_bytes_per_pixel);
+    }
+}
+
+// NOTE: A whole image conversion, split into chunks of pixels_per_task for
+// RaylibSIMD__RunTasks.
+typedef struct
+{
+    unsigned char const *src;
+    int                  src_format;
+    unsigned char       *dest;
+    int                  dest_format;
+    int                  pixels;
+    int                  pixels_per_task;
+} RaylibSIMD__ConvertJob;
+
+RS_FILE_SCOPE void RaylibSIMD__ConvertTask(void *user_data, int task_index)
+{
+    RaylibSIMD__ConvertJob const *job = RS_CAST(RaylibSIMD__ConvertJob const *)user_data;
+    int const begin                   = task_index * job->pixels_per_task;
+    int const pixels                  = RS_MIN(job->pixels_per_task, job->pixels - begin);
+    unsigned char const *src          = job->src + begin * (RaylibSIMD__FormatToBitsPerPixel(job->src_format) / 8);
+    unsigned char *dest               = job->dest + begin * (RaylibSIMD__FormatToBitsPerPixel(job->dest_format) / 8);
+
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41) RaylibSIMD__ConvertPixels_SSE41(src, job->src_format, dest, job->dest_format, pixels);
+    else                                                                 RaylibSIMD__ConvertPixels(src, job->src_format, dest, job->dest_format, pixels);
+}
+
+RS_FILE_SCOPE RaylibSIMD_BlendPrecision RaylibSIMD__blend_precision = RaylibSIMD_BlendPrecision_Float;
+RS_FILE_SCOPE RaylibSIMD_ScaleFilter    RaylibSIMD__scale_filter    = RaylibSIMD_ScaleFilter_Bilinear;
+RS_FILE_SCOPE RaylibSIMD_ImageDrawMode  RaylibSIMD__image_draw_mode = RaylibSIMD_ImageDrawMode_Auto;
+RS_FILE_SCOPE RaylibSIMD_ShapeEdges     RaylibSIMD__shape_edges     = RaylibSIMD_ShapeEdges_Aliased;
+RS_FILE_SCOPE RaylibSIMD_MipmapFilter   RaylibSIMD__mipmap_filter   = RaylibSIMD_MipmapFilter_Box;
+
+void RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision precision)
+{
+    RaylibSIMD__blend_precision = precision;
+}
+
+void RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter filter)
+{
+    RaylibSIMD__scale_filter = filter;
+}
+
+void RaylibSIMD_SetImageDrawMode(RaylibSIMD_ImageDrawMode mode)
+{
+    RaylibSIMD__image_draw_mode = mode;
+}
+
+void RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges edges)
+{
+    RaylibSIMD__shape_edges = edges;
+}
+
+void RaylibSIMD_SetMipmapFilter(RaylibSIMD_MipmapFilter filter)
+{
+    RaylibSIMD__mipmap_filter = filter;
+}
+
+
+// NOTE: Everything required to blend a span of source pixels onto the
+// destination, resolved once per draw so that each span (a row, or part of a
+// row when the source is sampled) only has to run the loop.
+typedef struct
+{
+    RaylibSIMD_ImageDrawMode  draw_mode;
+    int                       src_format;
+    int                       dest_format;
+    int                       src_bytes_per_pixel;
+    int                       dest_bytes_per_pixel;
+    Color                     tint;
+    bool                      blend_required; // Original mode only, false when the source has no alpha to blend
+    bool                      fixed16;
+    bool                      premultiplied;
+    RaylibSIMD_BlendMode      blend_mode;
+    bool                      float_channels; // SIMD mode, a float format is involved, see RaylibSIMD__BlendPixelChannels
+    bool                      skip_all;       // SIMD mode, tint.a == 0 so nothing is drawn
+    bool                      copy_opaque;    // SIMD mode, tint is white so opaque source pixels are copied or converted
+    bool                      source_opaque;  // SIMD mode, the source format has no alpha
+    RaylibSIMD__BlendParams   params;
+    RaylibSIMD__BlendRowProc *blend_row;
+    RaylibSIMD__BlendRowProc *blend_row_sse;
+    int                       tail_pixels_per_iteration; // Of blend_row_sse
+    int                       tail_over_read;            // Pixels blend_row_sse reads past its last iteration
+} RaylibSIMD__DrawState;
+
+RS_FILE_SCOPE RaylibSIMD__DrawState RaylibSIMD__MakeDrawState(int src_format, int dest_format, Color tint, RaylibSIMD_BlendMode blend_mode)
+{
+    float const INV_255                             = 1.f / 255.f;
+    RaylibSIMD_InstructionSet const instruction_set = RaylibSIMD__InstructionSet();
+
+    RaylibSIMD__DrawState result = {0};
+    result.draw_mode             = RaylibSIMD_ImageDrawMode_Original;
+    result.src_format            = src_format;
+    result.dest_format           = dest_format;
+    result.src_bytes_per_pixel   = GetPixelDataSize(1, 1, src_format);
+    result.dest_bytes_per_pixel  = GetPixelDataSize(1, 1, dest_format);
+    result.tint                  = tint;
+    result.premultiplied         = (blend_mode == RaylibSIMD_BlendMode_AlphaPremultiplied);
+    result.blend_mode            = blend_mode;
+
+    // Fast path: Avoid blend if source has no alpha to blend
+    result.blend_required = true;
+    if ((tint.a == 255) && ((src_format == UNCOMPRESSED_GRAYSCALE) || (src_format == UNCOMPRESSED_R8G8B8) || (src_format == UNCOMPRESSED_R5G6B5))) result.blend_required = false;
+
+    // NOTE: Every SIMD format pair is checked against a golden blend by
+    // TestBlendAccuracy.
+    bool const src_float  = (src_format >= UNCOMPRESSED_R32) && (src_format <= UNCOMPRESSED_R32G32B32A32);
+    bool const dest_float = (dest_format >= UNCOMPRESSED_R32) && (dest_format <= UNCOMPRESSED_R32G32B32A32);
+    if (blend_mode != RaylibSIMD_BlendMode_Alpha)
+    {
+        // NOTE: The SIMD mode falls back to the scalar reference when the
+        // CPU has no SSE4.1.
+        result.draw_mode = RaylibSIMD_ImageDrawMode_SIMD;
+    }
+    else if ((src_float || dest_float) && (src_format <= UNCOMPRESSED_R32G32B32A32) && (dest_format <= UNCOMPRESSED_R32G32B32A32))
+    {
+        // NOTE: GetPixelColor and SetPixelColor have no float formats, so these
+        // always take the SIMD mode, which falls back to the scalar reference
+        // when the CPU has no SSE4.1.
+        result.draw_mode      = RaylibSIMD_ImageDrawMode_SIMD;
+        result.float_channels = true;
+    }
+    else if ((instruction_set >= RaylibSIMD_InstructionSet_SSE41) &&
+        (dest_format == UNCOMPRESSED_R8G8B8A8 ||
+         dest_format == UNCOMPRESSED_R8G8B8 ||
+         dest_format == UNCOMPRESSED_R5G6B5 ||
+         dest_format == UNCOMPRESSED_R5G5B5A1 ||
+         dest_format == UNCOMPRESSED_R4G4B4A4 ||
+         dest_format == UNCOMPRESSED_GRAYSCALE ||
+         dest_format == UNCOMPRESSED_GRAY_ALPHA)
+        &&
+        (src_format == UNCOMPRESSED_R8G8B8A8 ||
+         src_format == UNCOMPRESSED_R8G8B8 ||
+         src_format == UNCOMPRESSED_R5G6B5 ||
+         src_format == UNCOMPRESSED_R5G5B5A1 ||
+         src_format == UNCOMPRESSED_R4G4B4A4 ||
+         src_format == UNCOMPRESSED_GRAYSCALE ||
+         src_format == UNCOMPRESSED_GRAY_ALPHA))
+    {
+        result.draw_mode = RaylibSIMD_ImageDrawMode_SIMD;
+    }
+
+    // NOTE: Forced modes, blend modes other than Alpha only exist in the SIMD mode
+    RaylibSIMD_ImageDrawMode const forced_mode = RaylibSIMD__image_draw_mode;
+    if ((blend_mode == RaylibSIMD_BlendMode_Alpha) && !result.float_channels)
+    {
+        if (forced_mode == RaylibSIMD_ImageDrawMode_Original) result.draw_mode = RaylibSIMD_ImageDrawMode_Original;
+        if (forced_mode == RaylibSIMD_ImageDrawMode_Flattened && src_format == UNCOMPRESSED_R8G8B8A8 && dest_format == UNCOMPRESSED_R8G8B8A8)
+            result.draw_mode = RaylibSIMD_ImageDrawMode_Flattened;
+    }
+
+    if (result.draw_mode == RaylibSIMD_ImageDrawMode_SIMD)
+    {
+        RaylibSIMD__BlendParams *params = &result.params;
+        params->src_lanes               = RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(src_format);
+        params->dest_lanes              = RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(dest_format);
+        params->src_bytes_per_pixel     = RaylibSIMD__FormatToBitsPerPixel(src_format) / 8;
+        params->dest_bytes_per_pixel    = RaylibSIMD__FormatToBitsPerPixel(dest_format) / 8;
+        params->tint_r01                = tint.r * INV_255;
+        params->tint_g01                = tint.g * INV_255;
+        params->tint_b01                = tint.b * INV_255;
+        params->tint_a01                = tint.a * INV_255;
+        params->tint                    = tint;
+        params->src_format              = src_format;
+        params->dest_format             = dest_format;
+        params->dest_gray               = (dest_format == UNCOMPRESSED_GRAYSCALE) || (dest_format == UNCOMPRESSED_GRAY_ALPHA);
+        if (src_format == UNCOMPRESSED_R8G8B8 || src_format == UNCOMPRESSED_R5G6B5 || src_format == UNCOMPRESSED_GRAYSCALE)    params->src_alpha_min = 255.f;
+        if (dest_format == UNCOMPRESSED_R8G8B8 || dest_format == UNCOMPRESSED_R5G6B5 || dest_format == UNCOMPRESSED_GRAYSCALE) params->dest_alpha_min = 255.f;
+
+        // NOTE: The widest kernel runs first, the SSE4.1 kernel picks
+        // up any whole groups of pixels it leaves behind.
+        result.blend_row                 = RaylibSIMD__BlendRowKernel(instruction_set);
+        result.blend_row_sse             = RaylibSIMD__BlendRow_SSE41;
+        result.tail_pixels_per_iteration = 4;
+        result.tail_over_read            = RaylibSIMD__BlendRowOverRead(params);
+
+        result.fixed16 = (RaylibSIMD__blend_precision == RaylibSIMD_BlendPrecision_Fixed16) &&
+                         (src_format == UNCOMPRESSED_R8G8B8A8) &&
+                         (dest_format == UNCOMPRESSED_R8G8B8A8);
+        if (result.float_channels)
+        {
+            if (dest_format == UNCOMPRESSED_GRAYSCALE || dest_format == UNCOMPRESSED_GRAY_ALPHA || dest_format == UNCOMPRESSED_R8G8B8 || dest_format == UNCOMPRESSED_R8G8B8A8)
+                params->encode_bias = 0.5f / 255.f;
+            result.blend_row      = RaylibSIMD__BlendRowChannels_SSE41;
+            result.blend_row_sse  = RaylibSIMD__BlendRowChannels_SSE41;
+            result.tail_over_read = 0;
+        }
+        else if (result.premultiplied)
+        {
+            params->tint         = RaylibSIMD__PremultiplyColor(tint);
+            result.blend_row     = RaylibSIMD__BlendRowPremultipliedKernel(instruction_set);
+            result.blend_row_sse = RaylibSIMD__BlendRowPremultiplied_SSE41;
+            result.tail_pixels_per_iteration = 8;
+        }
+        else if (blend_mode != RaylibSIMD_BlendMode_Alpha)
+        {
+            RaylibSIMD__BlendRowModeKernels(blend_mode, instruction_set, &result.blend_row, &result.blend_row_sse);
+            result.tail_pixels_per_iteration = 8;
+        }
+        else if (result.fixed16)
+        {
+            result.blend_row     = RaylibSIMD__BlendRowFixed16Kernel(instruction_set);
+            result.blend_row_sse = RaylibSIMD__BlendRowFixed16_SSE41;
+            result.tail_pixels_per_iteration = 8;
+        }
+
+        if (instruction_set < RaylibSIMD_InstructionSet_SSE41)
+        {
+            result.blend_row     = NULL;
+            result.blend_row_sse = NULL;
+        }
+
+        // NOTE: Color modes leave the destination unchanged for transparent
+        // source pixels but don't replace it with opaque ones, Copy always
+        // replaces it
+        bool const white_tint = (tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255);
+        bool const over       = (blend_mode == RaylibSIMD_BlendMode_Alpha) || result.premultiplied;
+        result.skip_all       = (tint.a == 0) && (blend_mode != RaylibSIMD_BlendMode_Copy);
+        result.copy_opaque    = white_tint && (over || (blend_mode == RaylibSIMD_BlendMode_Copy));
+        result.source_opaque = (src_format == UNCOMPRESSED_R8G8B8) || (src_format == UNCOMPRESSED_R5G6B5) || (src_format == UNCOMPRESSED_GRAYSCALE) ||
+                               (src_format == UNCOMPRESSED_R32) || (src_format == UNCOMPRESSED_R32G32B32);
+    }
+
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BlendSpan(RaylibSIMD__DrawState const *state, unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels)
+{
+    RaylibSIMD__BlendParams const *params = &state->params;
+    int pixels_blended = state->blend_row ? state->blend_row(src_ptr, dest_ptr, pixels, params) : 0;
+    if (state->blend_row && state->blend_row != state->blend_row_sse && pixels_blended < pixels)
+    {
+        pixels_blended += state->blend_row_sse(src_ptr + (pixels_blended * params->src_bytes_per_pixel),
+                                               dest_ptr + (pixels_blended * params->dest_bytes_per_pixel),
+                                               pixels - pixels_blended,
+                                               params);
+    }
+
+    src_ptr += pixels_blended * state->src_bytes_per_pixel;
+    dest_ptr += pixels_blended * state->dest_bytes_per_pixel;
+
+    // NOTE: The pixels left over by the kernel, fewer than an iteration plus
+    // its over read, are blended by the SSE4.1 kernel through scratch buffers
+    // so that its full width loads and stores never leave the image.
+    // 32 pixels is enough for the worst case, GRAYSCALE sources with 12 pixels
+    // of over read and at most 15 pixels left over.
+    int const remaining = pixels - pixels_blended;
+    if (remaining && state->blend_row_sse)
+    {
+        int const tail_pixels = ((remaining + state->tail_pixels_per_iteration - 1) / state->tail_pixels_per_iteration) * state->tail_pixels_per_iteration + state->tail_over_read;
+        unsigned char src_pixels[32 * 4]  = {0};
+        unsigned char dest_pixels[32 * 4] = {0};
+        memcpy(src_pixels, src_ptr, remaining * state->src_bytes_per_pixel);
+        memcpy(dest_pixels, dest_ptr, remaining * state->dest_bytes_per_pixel);
+        state->blend_row_sse(src_pixels, dest_pixels, tail_pixels, params);
+        memcpy(dest_ptr, dest_pixels, remaining * state->dest_bytes_per_pixel);
+        return;
+    }
+
+    // NOTE: Without SSE4.1 every pixel is done serially.
+    for (int x = pixels_blended; x < pixels; x++)
+    {
+        if (state->premultiplied)                                RaylibSIMD__BlendPixelPremultiplied(src_ptr, dest_ptr, params->tint);
+        else if (state->blend_mode != RaylibSIMD_BlendMode_Alpha) RaylibSIMD__BlendPixelMode(src_ptr, dest_ptr, state->tint, state->blend_mode);
+        else if (state->fixed16)                                 RaylibSIMD__BlendPixelFixed16(src_ptr, dest_ptr, state->tint);
+        else if (state->float_channels)                          RaylibSIMD__BlendPixelChannels(src_ptr, dest_ptr, params);
+        else                                                     RaylibSIMD__BlendPixelLanes(src_ptr, dest_ptr, params);
+        src_ptr += state->src_bytes_per_pixel;
+        dest_ptr += state->dest_bytes_per_pixel;
+    }
+}
+
+// NOTE: Opaque pixels with a white tint replace the destination, which is the
+// same as SetPixelColor(GetPixelColor(src)) i.e. a format conversion.
+RS_FILE_SCOPE void RaylibSIMD__CopySpan(RaylibSIMD__DrawState const *state, unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels)
+{
+    if (state->src_format == state->dest_format)                                memcpy(dest_ptr, src_ptr, (size_t)pixels * state->src_bytes_per_pixel);
+    else if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41) RaylibSIMD__ConvertPixels_SSE41(src_ptr, state->src_format, dest_ptr, state->dest_format, pixels);
+    else                                                                        RaylibSIMD__ConvertPixels(src_ptr, state->src_format, dest_ptr, state->dest_format, pixels);
+}
+
+// NOTE: Spans are split into blocks of RS_ALPHA_BLOCK_PIXELS classified by
+// their source alpha. Consecutive blocks of the same class are handled as one
+// run so the blend kernels still see long spans.
+#define RS_ALPHA_BLOCK_PIXELS 16
+
+typedef enum
+{
+    RaylibSIMD__AlphaBlock_Translucent, // Blend
+    RaylibSIMD__AlphaBlock_Transparent, // Leaves the destination unchanged, skip
+    RaylibSIMD__AlphaBlock_Opaque,      // Replaces the destination, copy or convert
+} RaylibSIMD__AlphaBlock;
+
+// NOTE: Classify RS_ALPHA_BLOCK_PIXELS pixels by their alpha bits. A
+// premultiplied pixel only leaves the destination unchanged when every
+// component is 0, since its color is added to the destination.
+RS_FILE_SCOPE RS_TARGET_SSE41 RaylibSIMD__AlphaBlock RaylibSIMD__ClassifyAlphaBlock_SSE41(unsigned char const *src_ptr, int format, bool premultiplied)
+{
+    __m128i alpha_mask = _mm_setzero_si128();
+    __m128i all_and    = _mm_set1_epi32(-1);
+    __m128i all_or     = _mm_setzero_si128();
+    int const bytes    = RS_ALPHA_BLOCK_PIXELS * (RaylibSIMD__FormatToBitsPerPixel(format) / 8);
+    for (int offset = 0; offset < bytes; offset += sizeof(__m128i))
+    {
+        __m128i pixels = _mm_loadu_si128(RS_CAST(__m128i const *)(src_ptr + offset));
+        all_and        = _mm_and_si128(all_and, pixels);
+        all_or         = _mm_or_si128(all_or, pixels);
+    }
+
+    switch (format)
+    {
+        default: return RaylibSIMD__AlphaBlock_Translucent;
+        case UNCOMPRESSED_R8G8B8A8: alpha_mask = _mm_set1_epi32(RS_CAST(int)0xFF000000); break;
+        case UNCOMPRESSED_R5G5B5A1: alpha_mask = _mm_set1_epi16(0x0001); break;
+        case UNCOMPRESSED_R4G4B4A4: alpha_mask = _mm_set1_epi16(0x000F); break;
+        case UNCOMPRESSED_GRAY_ALPHA: alpha_mask = _mm_set1_epi16(RS_CAST(short)0xFF00); break;
+    }
+
+    if (premultiplied ? _mm_testz_si128(all_or, all_or) : _mm_testz_si128(all_or, alpha_mask)) return RaylibSIMD__AlphaBlock_Transparent;
+    if (_mm_testc_si128(all_and, alpha_mask))                                                 return RaylibSIMD__AlphaBlock_Opaque;
+    return RaylibSIMD__AlphaBlock_Translucent;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DrawAlphaRun(RaylibSIMD__DrawState const *state, RaylibSIMD__AlphaBlock block, unsigned char const *src_ptr, unsigned char *dest_ptr, int begin, int end)
+{
+    src_ptr  += begin * state->src_bytes_per_pixel;
+    dest_ptr += begin * state->dest_bytes_per_pixel;
+    switch (block)
+    {
+        case RaylibSIMD__AlphaBlock_Translucent: RaylibSIMD__BlendSpan(state, src_ptr, dest_ptr, end - begin); break;
+        case RaylibSIMD__AlphaBlock_Transparent: break;
+        case RaylibSIMD__AlphaBlock_Opaque:      RaylibSIMD__CopySpan(state, src_ptr, dest_ptr, end - begin); break;
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DrawSpanByAlpha(RaylibSIMD__DrawState const *state, unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels)
+{
+    if (RaylibSIMD__InstructionSet() < RaylibSIMD_InstructionSet_SSE41)
+    {
+        RaylibSIMD__BlendSpan(state, src_ptr, dest_ptr, pixels);
+        return;
+    }
+
+    // NOTE: A partial block at the end of the span is always blended
+    int const blocks_end              = pixels - (pixels % RS_ALPHA_BLOCK_PIXELS);
+    RaylibSIMD__AlphaBlock run_block  = RaylibSIMD__AlphaBlock_Translucent;
+    int run_begin                     = 0;
+    for (int x = 0; x < pixels; x += RS_ALPHA_BLOCK_PIXELS)
+    {
+        RaylibSIMD__AlphaBlock block = RaylibSIMD__AlphaBlock_Translucent;
+        if (x < blocks_end)
+        {
+            block = RaylibSIMD__ClassifyAlphaBlock_SSE41(src_ptr + x * state->src_bytes_per_pixel, state->src_format, state->premultiplied);
+            if (block == RaylibSIMD__AlphaBlock_Opaque && !state->copy_opaque) block = RaylibSIMD__AlphaBlock_Translucent;
+        }
+
+        if (block != run_block)
+        {
+            RaylibSIMD__DrawAlphaRun(state, run_block, src_ptr, dest_ptr, run_begin, x);
+            run_block = block;
+            run_begin = x;
+        }
+    }
+    RaylibSIMD__DrawAlphaRun(state, run_block, src_ptr, dest_ptr, run_begin, pixels);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DrawSpan(RaylibSIMD__DrawState const *state, unsigned char const *src_ptr, unsigned char *dest_ptr, int pixels)
+{
+    switch(state->draw_mode)
+    {
+        case RaylibSIMD_ImageDrawMode_Original:
+        {
+            // Fast path: Avoid moving pixel by pixel if no blend required and same format
+            if (!state->blend_required && (state->src_format == state->dest_format)) memcpy(dest_ptr, src_ptr, (size_t)pixels*state->src_bytes_per_pixel);
+            else
+            {
+                Color colSrc, colDst, blend;
+                for (int x = 0; x < pixels; x++)
+                {
+                    colSrc = GetPixelColor(RS_CAST(void *)src_ptr, state->src_format);
+                    colDst = GetPixelColor(dest_ptr, state->dest_format);
+
+                    // Fast path: Avoid blend if source has no alpha to blend
+                    if (state->blend_required) blend = ColorAlphaBlend(colDst, colSrc, state->tint);
+                    else blend = colSrc;
+
+                    SetPixelColor(dest_ptr, blend, state->dest_format);
+
+                    dest_ptr += state->dest_bytes_per_pixel;
+                    src_ptr += state->src_bytes_per_pixel;
+                }
+            }
+        }
+        break;
+
+        case RaylibSIMD_ImageDrawMode_Flattened:
+        {
+            float const src_alpha_min = (state->src_format == UNCOMPRESSED_R8G8B8) ? 255.f : 0.f;
+            for (int x = 0; x < pixels; x++)
+            {
+                RaylibSIMD__SoftwareBlendPixel(src_ptr, dest_ptr, state->tint, src_alpha_min);
+                src_ptr += state->src_bytes_per_pixel;
+                dest_ptr += state->dest_bytes_per_pixel;
+            }
+        }
+        break;
+
+        case RaylibSIMD_ImageDrawMode_SIMD:
+        {
+            // Fast path: Nothing to draw, or an opaque source that is a
+            // straight copy or format conversion
+            bool const copy = (state->blend_mode == RaylibSIMD_BlendMode_Copy);
+            if (state->skip_all) break;
+            if ((state->source_opaque || copy) && state->copy_opaque) RaylibSIMD__CopySpan(state, src_ptr, dest_ptr, pixels);
+            else if (!state->source_opaque && !copy)                  RaylibSIMD__DrawSpanByAlpha(state, src_ptr, dest_ptr, pixels);
+            else                                                      RaylibSIMD__BlendSpan(state, src_ptr, dest_ptr, pixels);
+        }
+        break;
+
+        case RaylibSIMD_ImageDrawMode_Auto: break; // NOTE: Resolved by RaylibSIMD__MakeDrawState
+    }
+}
+
+// NOTE: Samples the source rectangle stretched over a destination of
+// dest_width x dest_height pixels. Spans are sampled into a small buffer that
+// stays in L1 and is blended straight away, so scaled draws never allocate a
+// resized copy of the source.
+//
+// Nearest produces pixels in the source format, bilinear produces R8G8B8A8.
+// Both sample at pixel centers, i.e. destination pixel u maps to source
+// coordinate (u + 0.5) * (src_width / dest_width) - 0.5.
+#define RS_SAMPLE_SPAN_PIXELS 128
+#define RS_SAMPLE_SPAN_BYTES  (RS_SAMPLE_SPAN_PIXELS * 16 + 64) // Largest pixel (R32G32B32A32) + kernel over-read
+
+typedef struct
+{
+    unsigned char const   *src_data;
+    int                    src_format;
+    RaylibSIMD_ScaleFilter filter;
+    int                    src_bytes_per_pixel;
+    int                    src_stride;
+    int                    src_x;
+    int                    src_y;
+    int                    src_width;
+    int                    src_height;
+    int64_t                x_step_16_16; // Source pixels per destination pixel in 16.16 fixed point
+    int64_t                y_step_16_16;
+} RaylibSIMD__Sampler;
+
+RS_FILE_SCOPE RaylibSIMD__Sampler RaylibSIMD__MakeSampler(Image const *src, Rectangle src_rec, int dest_width, int dest_height, RaylibSIMD_ScaleFilter filter)
+{
+    RaylibSIMD__Sampler result = {0};
+    result.src_data            = RS_CAST(unsigned char const *)src->data;
+    result.src_format          = src->format;
+    result.filter              = filter;
+    result.src_bytes_per_pixel = GetPixelDataSize(1, 1, src->format);
+    result.src_stride          = GetPixelDataSize(src->width, 1, src->format);
+    result.src_x               = RS_CAST(int)src_rec.x;
+    result.src_y               = RS_CAST(int)src_rec.y;
+    result.src_width           = RS_CAST(int)src_rec.width;
+    result.src_height          = RS_CAST(int)src_rec.height;
+    result.x_step_16_16        = (RS_CAST(int64_t)result.src_width << 16) / dest_width;
+    result.y_step_16_16        = (RS_CAST(int64_t)result.src_height << 16) / dest_height;
+    return result;
+}
+
+// NOTE: Bilinear coordinate from 16.16 fixed point, clamped to the source edge.
+// Positions are computed in integers so a pixel samples the same texels no
+// matter which span it was drawn in.
+RS_FILE_SCOPE void RaylibSIMD__BilinearCoordinate(int64_t coordinate_16_16, int max, int *index0, int *index1, uint32_t *weight)
+{
+    coordinate_16_16 = RS_MIN(RS_MAX(coordinate_16_16, 0), RS_CAST(int64_t)max << 16);
+    int position     = RS_CAST(int)(coordinate_16_16 >> 8);
+    *index0      = position >> 8;
+    *index1      = RS_MIN(*index0 + 1, max);
+    *weight      = RS_CAST(uint32_t)(position & 0xFF);
+}
+
+// NOTE: Each output pixel interpolates its 2x2 texels with the 4 color
+// components of both horizontal neighbours in one register.
+//
+// Top, Bottom  | {R0 G0 B0 A0 R1 G1 B1 A1} (16 bit lanes)
+// Column       | Top * (256 - weight_y) + Bottom * weight_y
+// Result       | Column.lo * (256 - weight_x) + Column.hi * weight_x
+RS_FILE_SCOPE RS_TARGET_SSE41 uint32_t RaylibSIMD__BilinearTexelsR8G8B8A8_SSE41(unsigned char const *row0, unsigned char const *row1, int x0, int x1, uint32_t weight_x, uint32_t weight_y)
+{
+    __m128i const round_8x  = _mm_set1_epi16(128);
+    __m128i const weight_y0 = _mm_set1_epi16(RS_CAST(short)(256 - weight_y));
+    __m128i const weight_y1 = _mm_set1_epi16(RS_CAST(short)weight_y);
+
+    __m128i top      = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*RS_CAST(int const *)(row0 + x0 * 4)), _mm_cvtsi32_si128(*RS_CAST(int const *)(row0 + x1 * 4)));
+    __m128i bottom   = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*RS_CAST(int const *)(row1 + x0 * 4)), _mm_cvtsi32_si128(*RS_CAST(int const *)(row1 + x1 * 4)));
+    __m128i column   = _mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(top), weight_y0), _mm_mullo_epi16(_mm_cvtepu8_epi16(bottom), weight_y1));
+    column           = _mm_srli_epi16(_mm_add_epi16(column, round_8x), 8);
+
+    short const weight_x0 = RS_CAST(short)(256 - weight_x);
+    short const weight_x1 = RS_CAST(short)weight_x;
+    __m128i weighted = _mm_mullo_epi16(column, _mm_setr_epi16(weight_x0, weight_x0, weight_x0, weight_x0, weight_x1, weight_x1, weight_x1, weight_x1));
+    __m128i result   = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(weighted, _mm_srli_si128(weighted, 8)), round_8x), 8);
+    return RS_CAST(uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(result, result));
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__SampleBilinearR8G8B8A8_SSE41(unsigned char const *row0, unsigned char const *row1, uint32_t weight_y, int64_t x_16_16, int64_t x_step_16_16, int max_x, int pixels, unsigned char *out)
+{
+    for (int index = 0; index < pixels; index++, x_16_16 += x_step_16_16)
+    {
+        int x0, x1;
+        uint32_t weight_x;
+        RaylibSIMD__BilinearCoordinate(x_16_16, max_x, &x0, &x1, &weight_x);
+        *RS_CAST(uint32_t *)(out + index * 4) = RaylibSIMD__BilinearTexelsR8G8B8A8_SSE41(row0, row1, x0, x1, weight_x, weight_y);
+    }
+}
+
+// NOTE: Scalar bilinear for sources that are not R8G8B8A8, same math as the
+// SSE4.1 version on colors decoded with GetPixelColor.
+RS_FILE_SCOPE void RaylibSIMD__BilinearTexels(unsigned char const *row0, unsigned char const *row1, int format, int bytes_per_pixel, int x0, int x1, uint32_t weight_x, uint32_t weight_y, unsigned char *out)
+{
+    Color texels[4] = {0};
+    texels[0]       = GetPixelColor(RS_CAST(void *)(row0 + x0 * bytes_per_pixel), format);
+    texels[1]       = GetPixelColor(RS_CAST(void *)(row0 + x1 * bytes_per_pixel), format);
+    texels[2]       = GetPixelColor(RS_CAST(void *)(row1 + x0 * bytes_per_pixel), format);
+    texels[3]       = GetPixelColor(RS_CAST(void *)(row1 + x1 * bytes_per_pixel), format);
+
+    unsigned char const *components[4] = {&texels[0].r, &texels[1].r, &texels[2].r, &texels[3].r};
+    for (int component = 0; component < 4; component++)
+    {
+        uint32_t left  = (components[0][component] * (256 - weight_y) + components[2][component] * weight_y + 128) >> 8;
+        uint32_t right = (components[1][component] * (256 - weight_y) + components[3][component] * weight_y + 128) >> 8;
+        out[component] = RS_CAST(unsigned char)((left * (256 - weight_x) + right * weight_x + 128) >> 8);
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__SampleBilinear(unsigned char const *row0, unsigned char const *row1, int format, int bytes_per_pixel, uint32_t weight_y, int64_t x_16_16, int64_t x_step_16_16, int max_x, int pixels, unsigned char *out)
+{
+    for (int index = 0; index < pixels; index++, x_16_16 += x_step_16_16)
+    {
+        int x0, x1;
+        uint32_t weight_x;
+        RaylibSIMD__BilinearCoordinate(x_16_16, max_x, &x0, &x1, &weight_x);
+        RaylibSIMD__BilinearTexels(row0, row1, format, bytes_per_pixel, x0, x1, weight_x, weight_y, out + index * 4);
+    }
+}
+
+// NOTE: Sample pixels [u, u + pixels) of row v of the stretched source rectangle.
+RS_FILE_SCOPE void RaylibSIMD__SampleSpan(RaylibSIMD__Sampler const *sampler, int u, int v, int pixels, unsigned char *out)
+{
+    unsigned char const *src_data = sampler->src_data;
+    if (sampler->filter == RaylibSIMD_ScaleFilter_Nearest)
+    {
+        int const bytes_per_pixel   = sampler->src_bytes_per_pixel;
+        int64_t const src_y         = (v * sampler->y_step_16_16 + (sampler->y_step_16_16 >> 1)) >> 16;
+        unsigned char const *row    = src_data + (sampler->src_y + RS_MIN(src_y, sampler->src_height - 1)) * sampler->src_stride + sampler->src_x * bytes_per_pixel;
+        int64_t x_16_16             = u * sampler->x_step_16_16 + (sampler->x_step_16_16 >> 1);
+        int const max_x             = sampler->src_width - 1;
+
+        if (bytes_per_pixel == 4)
+        {
+            for (int index = 0; index < pixels; index++, x_16_16 += sampler->x_step_16_16)
+            {
+                int src_x = RS_MIN(RS_CAST(int)(x_16_16 >> 16), max_x);
+                memcpy(out + index * 4, row + src_x * 4, 4);
+            }
+        }
+        else
+        {
+            for (int index = 0; index < pixels; index++, x_16_16 += sampler->x_step_16_16)
+            {
+                int src_x = RS_MIN(RS_CAST(int)(x_16_16 >> 16), max_x);
+                memcpy(out + index * bytes_per_pixel, row + src_x * bytes_per_pixel, bytes_per_pixel);
+            }
+        }
+    }
+    else
+    {
+        int y0, y1;
+        uint32_t weight_y;
+        RaylibSIMD__BilinearCoordinate(v * sampler->y_step_16_16 + (sampler->y_step_16_16 >> 1) - 0x8000, sampler->src_height - 1, &y0, &y1, &weight_y);
+
+        int const bytes_per_pixel = sampler->src_bytes_per_pixel;
+        unsigned char const *row0 = src_data + (sampler->src_y + y0) * sampler->src_stride + sampler->src_x * bytes_per_pixel;
+        unsigned char const *row1 = src_data + (sampler->src_y + y1) * sampler->src_stride + sampler->src_x * bytes_per_pixel;
+        int64_t const x_16_16     = u * sampler->x_step_16_16 + (sampler->x_step_16_16 >> 1) - 0x8000;
+
+        if (sampler->src_format == UNCOMPRESSED_R8G8B8A8 && RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41)
+            RaylibSIMD__SampleBilinearR8G8B8A8_SSE41(row0, row1, weight_y, x_16_16, sampler->x_step_16_16, sampler->src_width - 1, pixels, out);
+        else
+            RaylibSIMD__SampleBilinear(row0, row1, sampler->src_format, bytes_per_pixel, weight_y, x_16_16, sampler->x_step_16_16, sampler->src_width - 1, pixels, out);
+    }
+}
+
+// NOTE: Samples the source rectangle under an affine map, for rotated draws.
+// The source coordinate of destination pixel (x, y) is
+// uv + x * uv_step_x + y * uv_step_y, in 16.16 fixed point relative to the
+// source rectangle, at pixel centers like RaylibSIMD__Sampler. Each row only
+// samples the span of pixels that land inside the source rectangle, see
+// RaylibSIMD__AffineSpan.
+typedef struct
+{
+    unsigned char const   *src_data;
+    int                    src_format;
+    RaylibSIMD_ScaleFilter filter;
+    int                    src_bytes_per_pixel;
+    int                    src_stride;
+    int                    src_x;
+    int                    src_y;
+    int                    src_width;
+    int                    src_height;
+    int64_t                u_16_16; // Source coordinate of destination pixel (0, 0)
+    int64_t                v_16_16;
+    int64_t                u_step_x_16_16;
+    int64_t                v_step_x_16_16;
+    int64_t                u_step_y_16_16;
+    int64_t                v_step_y_16_16;
+} RaylibSIMD__AffineSampler;
+
+RS_FILE_SCOPE int64_t RaylibSIMD__FloorDiv(int64_t numerator, int64_t denominator)
+{
+    int64_t result = numerator / denominator;
+    if ((numerator % denominator != 0) && ((numerator < 0) != (denominator < 0))) result--;
+    return result;
+}
+
+// NOTE: Narrows [*x0, *x1) to the x where 0 <= start + x * step < limit
+RS_FILE_SCOPE void RaylibSIMD__ClipAffineAxis(int64_t start, int64_t step, int64_t limit, int *x0, int *x1)
+{
+    int64_t begin = *x0, end = *x1;
+    if (step == 0)
+    {
+        if (start < 0 || start >= limit) end = begin;
+    }
+    else if (step > 0)
+    {
+        begin = RS_MAX(begin, -RaylibSIMD__FloorDiv(start, step));
+        end   = RS_MIN(end, -RaylibSIMD__FloorDiv(start - limit, step));
+    }
+    else
+    {
+        begin = RS_MAX(begin, RaylibSIMD__FloorDiv(start - limit, -step) + 1);
+        end   = RS_MIN(end, RaylibSIMD__FloorDiv(start, -step) + 1);
+    }
+    *x0 = RS_CAST(int)begin;
+    *x1 = RS_CAST(int)RS_MAX(begin, end);
+}
+
+// NOTE: Narrows [*x0, *x1) to the pixels of row y that sample the source
+// rectangle. The test is exact in fixed point, so the sprite's edges don't
+// depend on how its rows are split into spans.
+RS_FILE_SCOPE void RaylibSIMD__AffineSpan(RaylibSIMD__AffineSampler const *sampler, int y, int *x0, int *x1)
+{
+    int64_t const u_16_16 = sampler->u_16_16 + y * sampler->u_step_y_16_16;
+    int64_t const v_16_16 = sampler->v_16_16 + y * sampler->v_step_y_16_16;
+    RaylibSIMD__ClipAffineAxis(u_16_16, sampler->u_step_x_16_16, RS_CAST(int64_t)sampler->src_width << 16, x0, x1);
+    RaylibSIMD__ClipAffineAxis(v_16_16, sampler->v_step_x_16_16, RS_CAST(int64_t)sampler->src_height << 16, x0, x1);
+}
+
+// NOTE: RaylibSIMD__BilinearTexelsR8G8B8A8_SSE41 on 16 bit components, for 4
+// pixels at a time with their weights in the lanes of their components.
+RS_FILE_SCOPE RS_TARGET_AVX2 __m256i RaylibSIMD__BilinearTexels16_AVX2(__m256i texel_00, __m256i texel_10, __m256i texel_01, __m256i texel_11, __m256i weight_x, __m256i weight_y)
+{
+    __m256i const full_16x  = _mm256_set1_epi16(256);
+    __m256i const round_16x = _mm256_set1_epi16(128);
+    __m256i const weight_y0 = _mm256_sub_epi16(full_16x, weight_y);
+    __m256i left            = _mm256_add_epi16(_mm256_mullo_epi16(texel_00, weight_y0), _mm256_mullo_epi16(texel_01, weight_y));
+    __m256i right           = _mm256_add_epi16(_mm256_mullo_epi16(texel_10, weight_y0), _mm256_mullo_epi16(texel_11, weight_y));
+    left                    = _mm256_srli_epi16(_mm256_add_epi16(left, round_16x), 8);
+    right                   = _mm256_srli_epi16(_mm256_add_epi16(right, round_16x), 8);
+    __m256i result          = _mm256_add_epi16(_mm256_mullo_epi16(left, _mm256_sub_epi16(full_16x, weight_x)), _mm256_mullo_epi16(right, weight_x));
+    result                  = _mm256_srli_epi16(_mm256_add_epi16(result, round_16x), 8);
+    return result;
+}
+
+// NOTE: 8 pixels per iteration, the texels are fetched with gathers and the
+// 2x2 blocks interpolated with the same 16 bit math as
+// RaylibSIMD__BilinearTexelsR8G8B8A8_SSE41. Coordinates are 32 bit, which
+// holds sources up to 32767 pixels wide and high.
+//
+// Texels       | {P0 P1 P2 P3 | P4 P5 P6 P7} (gathered R8G8B8A8)
+// Lo, Hi       | {P0 P1 | P4 P5}, {P2 P3 | P6 P7} (16 bit lanes)
+RS_FILE_SCOPE RS_TARGET_AVX2 int RaylibSIMD__SampleAffineR8G8B8A8_AVX2(RaylibSIMD__AffineSampler const *sampler, int64_t u_16_16, int64_t v_16_16, int pixels, unsigned char *out)
+{
+    __m256i const lane_8x     = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i const u_step_8x   = _mm256_set1_epi32(RS_CAST(int)sampler->u_step_x_16_16);
+    __m256i const v_step_8x   = _mm256_set1_epi32(RS_CAST(int)sampler->v_step_x_16_16);
+    __m256i const u_advance   = _mm256_set1_epi32(RS_CAST(int)(sampler->u_step_x_16_16 * 8));
+    __m256i const v_advance   = _mm256_set1_epi32(RS_CAST(int)(sampler->v_step_x_16_16 * 8));
+    __m256i const pitch_8x    = _mm256_set1_epi32(sampler->src_stride / 4);
+    __m256i const origin_8x   = _mm256_set1_epi32(sampler->src_y * (sampler->src_stride / 4) + sampler->src_x);
+    __m256i const max_u_8x    = _mm256_set1_epi32((sampler->src_width - 1) << 16);
+    __m256i const max_v_8x    = _mm256_set1_epi32((sampler->src_height - 1) << 16);
+    __m256i const max_x_8x    = _mm256_set1_epi32(sampler->src_width - 1);
+    __m256i const max_y_8x    = _mm256_set1_epi32(sampler->src_height - 1);
+    __m256i const one_8x      = _mm256_set1_epi32(1);
+    __m256i const half_8x     = _mm256_set1_epi32(0x8000);
+    __m256i const byte_8x     = _mm256_set1_epi32(0xFF);
+    __m256i const zero        = _mm256_setzero_si256();
+    int const *texels         = RS_CAST(int const *)sampler->src_data;
+
+    __m256i u_8x = _mm256_add_epi32(_mm256_set1_epi32(RS_CAST(int)u_16_16), _mm256_mullo_epi32(lane_8x, u_step_8x));
+    __m256i v_8x = _mm256_add_epi32(_mm256_set1_epi32(RS_CAST(int)v_16_16), _mm256_mullo_epi32(lane_8x, v_step_8x));
+
+    int const iterations = pixels / 8;
+    for (int iteration = 0; iteration < iterations; iteration++)
+    {
+        __m256i texel_00, texel_10, texel_01, texel_11;
+        __m256i weight_x_8x = zero, weight_y_8x = zero;
+        if (sampler->filter == RaylibSIMD_ScaleFilter_Nearest)
+        {
+            __m256i index = _mm256_add_epi32(_mm256_add_epi32(origin_8x, _mm256_mullo_epi32(_mm256_srai_epi32(v_8x, 16), pitch_8x)), _mm256_srai_epi32(u_8x, 16));
+            texel_00 = texel_10 = texel_01 = texel_11 = _mm256_i32gather_epi32(texels, index, 4);
+        }
+        else
+        {
+            // NOTE: See RaylibSIMD__BilinearCoordinate
+            __m256i u = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(u_8x, half_8x), zero), max_u_8x);
+            __m256i v = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(v_8x, half_8x), zero), max_v_8x);
+            __m256i x0 = _mm256_srai_epi32(u, 16);
+            __m256i y0 = _mm256_srai_epi32(v, 16);
+            __m256i x1 = _mm256_min_epi32(_mm256_add_epi32(x0, one_8x), max_x_8x);
+            __m256i y1 = _mm256_min_epi32(_mm256_add_epi32(y0, one_8x), max_y_8x);
+            weight_x_8x = _mm256_and_si256(_mm256_srai_epi32(u, 8), byte_8x);
+            weight_y_8x = _mm256_and_si256(_mm256_srai_epi32(v, 8), byte_8x);
+
+            __m256i row0 = _mm256_add_epi32(origin_8x, _mm256_mullo_epi32(y0, pitch_8x));
+            __m256i row1 = _mm256_add_epi32(origin_8x, _mm256_mullo_epi32(y1, pitch_8x));
+            texel_00 = _mm256_i32gather_epi32(texels, _mm256_add_epi32(row0, x0), 4);
+            texel_10 = _mm256_i32gather_epi32(texels, _mm256_add_epi32(row0, x1), 4);
+            texel_01 = _mm256_i32gather_epi32(texels, _mm256_add_epi32(row1, x0), 4);
+            texel_11 = _mm256_i32gather_epi32(texels, _mm256_add_epi32(row1, x1), 4);
+        }
+        u_8x = _mm256_add_epi32(u_8x, u_advance);
+        v_8x = _mm256_add_epi32(v_8x, v_advance);
+
+        if (sampler->filter == RaylibSIMD_ScaleFilter_Nearest)
+        {
+            _mm256_storeu_si256(RS_CAST(__m256i *)out, texel_00);
+        }
+        else
+        {
+            // NOTE: Each pixel's weight in the 4 16 bit lanes of its components
+            __m256i weight_x_16x = _mm256_or_si256(weight_x_8x, _mm256_slli_epi32(weight_x_8x, 16));
+            __m256i weight_y_16x = _mm256_or_si256(weight_y_8x, _mm256_slli_epi32(weight_y_8x, 16));
+            __m256i weight_x_lo  = _mm256_unpacklo_epi32(weight_x_16x, weight_x_16x);
+            __m256i weight_x_hi  = _mm256_unpackhi_epi32(weight_x_16x, weight_x_16x);
+            __m256i weight_y_lo  = _mm256_unpacklo_epi32(weight_y_16x, weight_y_16x);
+            __m256i weight_y_hi  = _mm256_unpackhi_epi32(weight_y_16x, weight_y_16x);
+
+            __m256i lo = RaylibSIMD__BilinearTexels16_AVX2(_mm256_unpacklo_epi8(texel_00, zero), _mm256_unpacklo_epi8(texel_10, zero),
+                                                           _mm256_unpacklo_epi8(texel_01, zero), _mm256_unpacklo_epi8(texel_11, zero), weight_x_lo, weight_y_lo);
+            __m256i hi = RaylibSIMD__BilinearTexels16_AVX2(_mm256_unpackhi_epi8(texel_00, zero), _mm256_unpackhi_epi8(texel_10, zero),
+                                                           _mm256_unpackhi_epi8(texel_01, zero), _mm256_unpackhi_epi8(texel_11, zero), weight_x_hi, weight_y_hi);
+            _mm256_storeu_si256(RS_CAST(__m256i *)out, _mm256_packus_epi16(lo, hi));
+        }
+        out += 8 * 4;
+    }
+
+    int result = iterations * 8;
+    return result;
+}
+
+// NOTE: Sample pixels [x, x + pixels) of destination row y, which must lie
+// within the row's RaylibSIMD__AffineSpan. Produces the same formats as
+// RaylibSIMD__SampleSpan.
+RS_FILE_SCOPE void RaylibSIMD__SampleAffineSpan(RaylibSIMD__AffineSampler const *sampler, int x, int y, int pixels, unsigned char *out)
+{
+    int64_t u_16_16                     = sampler->u_16_16 + x * sampler->u_step_x_16_16 + y * sampler->u_step_y_16_16;
+    int64_t v_16_16                     = sampler->v_16_16 + x * sampler->v_step_x_16_16 + y * sampler->v_step_y_16_16;
+    int const bytes_per_pixel           = sampler->src_bytes_per_pixel;
+    bool const bilinear                 = (sampler->filter == RaylibSIMD_ScaleFilter_Bilinear);
+    int const out_bytes_per_pixel       = bilinear ? 4 : bytes_per_pixel;
+    RaylibSIMD_InstructionSet const isa = RaylibSIMD__InstructionSet();
+
+    int sampled = 0;
+    if ((isa >= RaylibSIMD_InstructionSet_AVX2) && (sampler->src_width < 32768) && (sampler->src_height < 32768) &&
+        (bilinear ? (sampler->src_format == UNCOMPRESSED_R8G8B8A8) : (bytes_per_pixel == 4)))
+    {
+        sampled  = RaylibSIMD__SampleAffineR8G8B8A8_AVX2(sampler, u_16_16, v_16_16, pixels, out);
+        u_16_16 += sampled * sampler->u_step_x_16_16;
+        v_16_16 += sampled * sampler->v_step_x_16_16;
+        out     += sampled * out_bytes_per_pixel;
+    }
+
+    unsigned char const *src_data = sampler->src_data + sampler->src_y * sampler->src_stride + sampler->src_x * bytes_per_pixel;
+    for (int index = sampled; index < pixels; index++)
+    {
+        if (bilinear)
+        {
+            int x0, x1, y0, y1;
+            uint32_t weight_x, weight_y;
+            RaylibSIMD__BilinearCoordinate(u_16_16 - 0x8000, sampler->src_width - 1, &x0, &x1, &weight_x);
+            RaylibSIMD__BilinearCoordinate(v_16_16 - 0x8000, sampler->src_height - 1, &y0, &y1, &weight_y);
+            unsigned char const *row0 = src_data + y0 * sampler->src_stride;
+            unsigned char const *row1 = src_data + y1 * sampler->src_stride;
+            if (sampler->src_format == UNCOMPRESSED_R8G8B8A8 && isa >= RaylibSIMD_InstructionSet_SSE41)
+                *RS_CAST(uint32_t *)out = RaylibSIMD__BilinearTexelsR8G8B8A8_SSE41(row0, row1, x0, x1, weight_x, weight_y);
+            else
+                RaylibSIMD__BilinearTexels(row0, row1, sampler->src_format, bytes_per_pixel, x0, x1, weight_x, weight_y, out);
+        }
+        else
+        {
+            int const src_x = RS_CAST(int)(u_16_16 >> 16);
+            int const src_y = RS_CAST(int)(v_16_16 >> 16);
+            memcpy(out, src_data + src_y * sampler->src_stride + src_x * bytes_per_pixel, bytes_per_pixel);
+        }
+        u_16_16 += sampler->u_step_x_16_16;
+        v_16_16 += sampler->v_step_x_16_16;
+        out     += out_bytes_per_pixel;
+    }
+}
+
+// NOTE: Coverage mask of RaylibSIMD_ImageDrawMasked. Masked draws blend spans
+// of R8G8B8A8 pixels built in a small buffer, the source converted to R8G8B8A8
+// (or the color of RaylibSIMD_ImageDrawColorMasked) with the coverage
+// multiplied into alpha, so no masked copy of the source is ever made.
+// Coverage is the gray of GRAYSCALE masks and the alpha of GRAY_ALPHA and
+// R8G8B8A8 masks. Scaled masks are sampled by the job's sampler first.
+typedef struct
+{
+    unsigned char const *data;                // !scaled only
+    int                  stride;
+    int                  bytes_per_pixel;     // Of the mask, or of the sampled span when scaled
+    int                  coverage_offset;     // Byte of each pixel holding the coverage
+    int                  x;                   // !scaled only, mask pixel drawn at (draw_x, draw_y)
+    int                  y;
+    int                  src_format;          // Of the job's source, the draw state blends R8G8B8A8 spans
+    int                  src_bytes_per_pixel;
+    Color                color;               // Drawn through the mask when the job has no source
+} RaylibSIMD__Mask;
+
+RS_FILE_SCOPE int RaylibSIMD__MaskCoverageOffset(int format)
+{
+    int result = 0;
+    if (format == UNCOMPRESSED_GRAY_ALPHA) result = 1;
+    if (format == UNCOMPRESSED_R8G8B8A8)   result = 3;
+    return result;
+}
+
+// NOTE: 4 pixels per iteration. The coverage of each pixel is shuffled into
+// the low byte of its 32 bit lane and multiplied into the alpha byte, like the
+// 16 bit products of RaylibSIMD__BlendRowFixed16_SSE41 with the high half of
+// every lane zero. src is R8G8B8A8, or NULL to mask color_4x instead. Loads
+// never read past the last pixel.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__MaskPixels_SSE41(unsigned char const *src, unsigned char const *mask_ptr, int mask_bytes_per_pixel, int coverage_offset, __m128i color_4x, unsigned char *out, int pixels)
+{
+    __m128i const rgb_mask         = _mm_set1_epi32(0x00FFFFFF);
+    __m128i const round_4x         = _mm_set1_epi32(128);
+    __m128i const div255_8x        = _mm_set1_epi16(257);
+    char const c0                  = RS_CAST(char)(coverage_offset);
+    char const c1                  = RS_CAST(char)(coverage_offset + mask_bytes_per_pixel);
+    char const c2                  = RS_CAST(char)(coverage_offset + mask_bytes_per_pixel * 2);
+    char const c3                  = RS_CAST(char)(coverage_offset + mask_bytes_per_pixel * 3);
+    __m128i const coverage_shuffle = _mm_setr_epi8(c0, -1, -1, -1, c1, -1, -1, -1, c2, -1, -1, -1, c3, -1, -1, -1);
+
+    int const PIXELS_PER_SIMD_WRITE = 4;
+    int const simd_iterations       = pixels / PIXELS_PER_SIMD_WRITE;
+    for (int x = 0; x < simd_iterations; x++)
+    {
+        __m128i mask_4x = _mm_setzero_si128();
+        switch (mask_bytes_per_pixel)
+        {
+            case 1: { int bits = 0; memcpy(&bits, mask_ptr, sizeof(bits)); mask_4x = _mm_cvtsi32_si128(bits); } break;
+            case 2: mask_4x = _mm_loadl_epi64(RS_CAST(__m128i const *)mask_ptr); break;
+            case 4: mask_4x = _mm_loadu_si128(RS_CAST(__m128i const *)mask_ptr); break;
+        }
+        __m128i coverage_4x = _mm_shuffle_epi8(mask_4x, coverage_shuffle);
+
+        __m128i pixels_4x = src ? _mm_loadu_si128(RS_CAST(__m128i const *)src) : color_4x;
+        __m128i alpha_4x  = _mm_mulhi_epu16(_mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi32(pixels_4x, 24), coverage_4x), round_4x), div255_8x);
+        _mm_storeu_si128(RS_CAST(__m128i *)out, _mm_or_si128(_mm_and_si128(pixels_4x, rgb_mask), _mm_slli_epi32(alpha_4x, 24)));
+
+        if (src) src += PIXELS_PER_SIMD_WRITE * 4;
+        mask_ptr += PIXELS_PER_SIMD_WRITE * mask_bytes_per_pixel;
+        out      += PIXELS_PER_SIMD_WRITE * 4;
+    }
+
+    int result = simd_iterations * PIXELS_PER_SIMD_WRITE;
+    return result;
+}
+
+// NOTE: Builds pixels (at most RS_SAMPLE_SPAN_PIXELS) masked R8G8B8A8 pixels in
+// out. src_ptr is NULL for RaylibSIMD_ImageDrawColorMasked, sources in other
+// formats are converted in out first and masked in place.
+RS_FILE_SCOPE void RaylibSIMD__MaskSpan(RaylibSIMD__Mask const *mask, unsigned char const *src_ptr, unsigned char const *mask_ptr, int pixels, unsigned char *out)
+{
+    bool const sse41 = (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41);
+    if (src_ptr && mask->src_format != UNCOMPRESSED_R8G8B8A8)
+    {
+        if (sse41) RaylibSIMD__ConvertPixels_SSE41(src_ptr, mask->src_format, out, UNCOMPRESSED_R8G8B8A8, pixels);
+        else       RaylibSIMD__ConvertPixels(src_ptr, mask->src_format, out, UNCOMPRESSED_R8G8B8A8, pixels);
+        src_ptr = out;
+    }
+
+    uint32_t color = 0;
+    memcpy(&color, &mask->color, sizeof(color));
+
+    int masked = 0;
+    if (sse41) masked = RaylibSIMD__MaskPixels_SSE41(src_ptr, mask_ptr, mask->bytes_per_pixel, mask->coverage_offset, _mm_set1_epi32(RS_CAST(int)color), out, pixels);
+
+    unsigned char const *color_ptr = RS_CAST(unsigned char const *)&mask->color;
+    for (int x = masked; x < pixels; x++)
+    {
+        unsigned char const *pixel = src_ptr ? src_ptr + x * 4 : color_ptr;
+        uint32_t const coverage    = mask_ptr[x * mask->bytes_per_pixel + mask->coverage_offset];
+        out[x * 4 + 0]             = pixel[0];
+        out[x * 4 + 1]             = pixel[1];
+        out[x * 4 + 2]             = pixel[2];
+        out[x * 4 + 3]             = RS_CAST(unsigned char)RaylibSIMD__Div255(pixel[3] * coverage);
+    }
+}
+
+// NOTE: Half open pixel rectangle [x0, x1) x [y0, y1)
+typedef struct
+{
+    int x0, y0;
+    int x1, y1;
+} RaylibSIMD__Rect;
+
+RS_FILE_SCOPE RaylibSIMD__Rect RaylibSIMD__RectIntersection(RaylibSIMD__Rect a, RaylibSIMD__Rect b)
+{
+    RaylibSIMD__Rect result = {0};
+    result.x0               = RS_MAX(a.x0, b.x0);
+    result.y0               = RS_MAX(a.y0, b.y0);
+    result.x1               = RS_MIN(a.x1, b.x1);
+    result.y1               = RS_MIN(a.y1, b.y1);
+    return result;
+}
+
+// NOTE: A draw clipped to the destination. Any part of the clip rectangle can
+// be drawn on its own with RaylibSIMD__DrawRect, the immediate path splits it
+// into bands of rows_per_task rows for RaylibSIMD__RunTasks and batches split
+// it into tiles. Parts never share destination pixels so they can be blended
+// in parallel.
+typedef struct
+{
+    RaylibSIMD__DrawState     state;
+    RaylibSIMD__Rect          clip;
+    bool                      scaled;
+    RaylibSIMD__Sampler       sampler;        // scaled only
+    bool                      affine;         // Rotated, see RaylibSIMD_ImageDrawPro
+    RaylibSIMD__AffineSampler affine_sampler; // affine only
+    bool                      masked;         // See RaylibSIMD_ImageDrawMasked
+    RaylibSIMD__Mask          mask;           // masked only
+    unsigned char const      *src_data;       // !scaled only, NULL when masked draws mask.color
+    int                       src_stride;
+    int                       src_x;          // !scaled only, source pixel drawn at (draw_x, draw_y)
+    int                       src_y;
+    unsigned char            *dest_data;
+    int                       dest_stride;
+    int                       draw_x;         // Unclipped top left of the drawn rectangle
+    int                       draw_y;
+    int                       rows_per_task;
+} RaylibSIMD__DrawJob;
+
+// NOTE: rect must lie within job->clip
+RS_FILE_SCOPE void RaylibSIMD__DrawRect(RaylibSIMD__DrawJob const *job, RaylibSIMD__Rect rect)
+{
+    int const width            = rect.x1 - rect.x0;
+    int const dest_bytes       = job->state.dest_bytes_per_pixel;
+    unsigned char *dest_row    = job->dest_data + rect.y0 * job->dest_stride + rect.x0 * dest_bytes;
+
+    if (job->affine)
+    {
+        unsigned char span[RS_SAMPLE_SPAN_BYTES];
+        unsigned char *dest_row_start = job->dest_data + rect.y0 * job->dest_stride;
+        for (int y = rect.y0; y < rect.y1; y++)
+        {
+            int x0 = rect.x0, x1 = rect.x1;
+            RaylibSIMD__AffineSpan(&job->affine_sampler, y, &x0, &x1);
+            for (int x = x0; x < x1; x += RS_SAMPLE_SPAN_PIXELS)
+            {
+                int const pixels = RS_MIN(RS_SAMPLE_SPAN_PIXELS, x1 - x);
+                RaylibSIMD__SampleAffineSpan(&job->affine_sampler, x, y, pixels, span);
+                RaylibSIMD__DrawSpan(&job->state, span, dest_row_start + x * dest_bytes, pixels);
+            }
+            dest_row_start += job->dest_stride;
+        }
+    }
+    else if (job->masked)
+    {
+        unsigned char span[RS_SAMPLE_SPAN_BYTES];
+        unsigned char mask_span[RS_SAMPLE_SPAN_BYTES];
+        RaylibSIMD__Mask const *mask  = &job->mask;
+        int const src_bytes           = mask->src_bytes_per_pixel;
+        int const mask_bytes          = mask->bytes_per_pixel;
+        int const u0                  = rect.x0 - job->draw_x;
+        unsigned char const *src_row  = NULL;
+        unsigned char const *mask_row = NULL;
+        if (job->src_data) src_row    = job->src_data + (job->src_y + rect.y0 - job->draw_y) * job->src_stride + (job->src_x + u0) * src_bytes;
+        if (!job->scaled) mask_row    = mask->data + (mask->y + rect.y0 - job->draw_y) * mask->stride + (mask->x + u0) * mask_bytes;
+        for (int y = rect.y0; y < rect.y1; y++)
+        {
+            for (int x = 0; x < width; x += RS_SAMPLE_SPAN_PIXELS)
+            {
+                int const pixels = RS_MIN(RS_SAMPLE_SPAN_PIXELS, width - x);
+                if (job->scaled) RaylibSIMD__SampleSpan(&job->sampler, u0 + x, y - job->draw_y, pixels, mask_span);
+                RaylibSIMD__MaskSpan(mask, src_row ? src_row + x * src_bytes : NULL, job->scaled ? mask_span : mask_row + x * mask_bytes, pixels, span);
+                RaylibSIMD__DrawSpan(&job->state, span, dest_row + x * dest_bytes, pixels);
+            }
+            if (src_row) src_row += job->src_stride;
+            if (mask_row) mask_row += mask->stride;
+            dest_row += job->dest_stride;
+        }
+    }
+    else if (!job->scaled)
+    {
+        int const src_bytes          = job->state.src_bytes_per_pixel;
+        unsigned char const *src_row = job->src_data + (job->src_y + rect.y0 - job->draw_y) * job->src_stride + (job->src_x + rect.x0 - job->draw_x) * src_bytes;
+        for (int y = rect.y0; y < rect.y1; y++)
+        {
+            RaylibSIMD__DrawSpan(&job->state, src_row, dest_row, width);
+            src_row += job->src_stride;
+            dest_row += job->dest_stride;
+        }
+    }
+    else
+    {
+        unsigned char span[RS_SAMPLE_SPAN_BYTES];
+        int const u0 = rect.x0 - job->draw_x;
+        for (int y = rect.y0; y < rect.y1; y++)
+        {
+            for (int x = 0; x < width; x += RS_SAMPLE_SPAN_PIXELS)
+            {
+                int const pixels = RS_MIN(RS_SAMPLE_SPAN_PIXELS, width - x);
+                RaylibSIMD__SampleSpan(&job->sampler, u0 + x, y - job->draw_y, pixels, span);
+                RaylibSIMD__DrawSpan(&job->state, span, dest_row + x * dest_bytes, pixels);
+            }
+            dest_row += job->dest_stride;
+        }
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DrawTask(void *user_data, int task_index)
+{
+    RaylibSIMD__DrawJob const *job = RS_CAST(RaylibSIMD__DrawJob const *)user_data;
+    RaylibSIMD__Rect band          = job->clip;
+    band.y0                        = job->clip.y0 + task_index * job->rows_per_task;
+    band.y1                        = RS_MIN(band.y0 + job->rows_per_task, job->clip.y1);
+    RaylibSIMD__DrawRect(job, band);
+}
+
+// NOTE: A rectangle fill clipped to the destination, split into parts the same
+// way as RaylibSIMD__DrawJob.
+typedef struct
+{
+    __m128i          color_4x;      // Pattern of whole pixels starting at a pixel boundary
+    int              bytes_per_pixel;
+    bool             stream;        // Bypass the cache, see RaylibSIMD__FillSpanStream
+    RaylibSIMD__Rect clip;
+    unsigned char   *dest_data;
+    int              dest_stride;
+    int              rows_per_task;
+} RaylibSIMD__FillJob;
+
+// NOTE: Fills at least this large are streamed past the cache with
+// non-temporal stores, since they would evict everything else and are rarely
+// read back before being drawn over.
+#define RS_STREAM_FILL_BYTES (4 * 1024 * 1024)
+
+// NOTE: Fill bytes [dest, dest + bytes) which start at a pixel boundary.
+// Stores advance by whole pixels, which is less than 16 bytes for R8G8B8 and
+// R32G32B32, so the last store must still end inside the span.
+RS_FILE_SCOPE void RaylibSIMD__FillSpan(RaylibSIMD__FillJob const *job, unsigned char *dest, size_t bytes)
+{
+    size_t const pixels_per_simd_write = sizeof(__m128i) / job->bytes_per_pixel;
+    size_t const bytes_per_simd_write  = pixels_per_simd_write * job->bytes_per_pixel;
+    size_t const simd_iterations       = (bytes >= sizeof(__m128i)) ? ((bytes - sizeof(__m128i)) / bytes_per_simd_write + 1) : 0;
+    for (size_t iteration = 0; iteration < simd_iterations; iteration++)
+    {
+        _mm_storeu_si128(RS_CAST(__m128i *)dest, job->color_4x);
+        dest += bytes_per_simd_write;
+    }
+
+    // NOTE: Fewer than 16 bytes of whole pixels are left, written with one
+    // partial store of the pattern.
+    unsigned char pattern[sizeof(__m128i)];
+    _mm_storeu_si128(RS_CAST(__m128i *)pattern, job->color_4x);
+    memcpy(dest, pattern, bytes - simd_iterations * bytes_per_simd_write);
+}
+
+// NOTE: RaylibSIMD__FillSpan with the body written by aligned non-temporal
+// stores, and the unaligned head and tail by masked (also non-temporal)
+// stores. Aligned blocks don't start on a pixel boundary for R8G8B8 and
+// R32G32B32, whose pattern repeats every 48 bytes, so the body cycles through
+// the 3 phases of the pattern (which are equal for the other formats).
+//
+// Pattern  | {P0 P1 P2 P3 P4 P5 ..} bytes of whole pixels from the span start
+// Block n  | Pattern[(n * 16 + head) % bytes_per_pixel ..] for 16 bytes
+RS_FILE_SCOPE void RaylibSIMD__FillSpanStream(RaylibSIMD__FillJob const *job, unsigned char *dest, size_t bytes)
+{
+    int const bytes_per_pixel = job->bytes_per_pixel;
+    unsigned char pattern[sizeof(__m128i) * 2];
+    _mm_storeu_si128(RS_CAST(__m128i *)pattern, job->color_4x);
+    for (int offset = bytes_per_pixel; offset < RS_CAST(int)sizeof(pattern); offset += bytes_per_pixel)
+        memcpy(pattern + offset, pattern, RS_MIN(bytes_per_pixel, RS_CAST(int)sizeof(pattern) - offset));
+
+    __m128i const byte_index = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    size_t const head        = RS_MIN((sizeof(__m128i) - (RS_CAST(uintptr_t)dest % sizeof(__m128i))) % sizeof(__m128i), bytes);
+    if (head)
+    {
+        __m128i const mask = _mm_cmplt_epi8(byte_index, _mm_set1_epi8(RS_CAST(char)head));
+        _mm_maskmoveu_si128(_mm_loadu_si128(RS_CAST(__m128i const *)pattern), mask, RS_CAST(char *)dest);
+    }
+
+    __m128i phases[3];
+    for (int phase = 0; phase < 3; phase++)
+        phases[phase] = _mm_loadu_si128(RS_CAST(__m128i const *)(pattern + (head + phase * sizeof(__m128i)) % bytes_per_pixel));
+
+    unsigned char *body   = dest + head;
+    size_t const blocks   = (bytes - head) / sizeof(__m128i);
+    size_t block          = 0;
+    for (; block + 3 <= blocks; block += 3)
+    {
+        _mm_stream_si128(RS_CAST(__m128i *)(body + (block + 0) * sizeof(__m128i)), phases[0]);
+        _mm_stream_si128(RS_CAST(__m128i *)(body + (block + 1) * sizeof(__m128i)), phases[1]);
+        _mm_stream_si128(RS_CAST(__m128i *)(body + (block + 2) * sizeof(__m128i)), phases[2]);
+    }
+    for (int phase = 0; block < blocks; block++, phase++)
+        _mm_stream_si128(RS_CAST(__m128i *)(body + block * sizeof(__m128i)), phases[phase]);
+
+    size_t const tail = bytes - head - blocks * sizeof(__m128i);
+    if (tail)
+    {
+        __m128i const mask = _mm_cmplt_epi8(byte_index, _mm_set1_epi8(RS_CAST(char)tail));
+        _mm_maskmoveu_si128(phases[blocks % 3], mask, RS_CAST(char *)(body + blocks * sizeof(__m128i)));
+    }
+}
+
+// NOTE: rect must lie within job->clip. Rows that span the whole image are
+// contiguous and filled as one span.
+RS_FILE_SCOPE void RaylibSIMD__FillRect(RaylibSIMD__FillJob const *job, RaylibSIMD__Rect rect)
+{
+    int const row_bytes       = (rect.x1 - rect.x0) * job->bytes_per_pixel;
+    bool const contiguous     = (row_bytes == job->dest_stride);
+    int const spans           = contiguous ? 1 : (rect.y1 - rect.y0);
+    size_t const span_bytes   = contiguous ? RS_CAST(size_t)row_bytes * (rect.y1 - rect.y0) : RS_CAST(size_t)row_bytes;
+    size_t const span_stride  = contiguous ? 0 : RS_CAST(size_t)job->dest_stride;
+
+    unsigned char *dest = job->dest_data + (RS_CAST(size_t)job->dest_stride * rect.y0) + rect.x0 * job->bytes_per_pixel;
+    for (int span = 0; span < spans; span++, dest += span_stride)
+    {
+        if (job->stream) RaylibSIMD__FillSpanStream(job, dest, span_bytes);
+        else             RaylibSIMD__FillSpan(job, dest, span_bytes);
+    }
+
+    // NOTE: Non-temporal stores are weakly ordered, make them visible before
+    // the fill is reported done
+    if (job->stream) _mm_sfence();
+}
+
+RS_FILE_SCOPE void RaylibSIMD__FillTask(void *user_data, int task_index)
+{
+    RaylibSIMD__FillJob const *job = RS_CAST(RaylibSIMD__FillJob const *)user_data;
+    RaylibSIMD__Rect band          = job->clip;
+    band.y0                        = job->clip.y0 + task_index * job->rows_per_task;
+    band.y1                        = RS_MIN(band.y0 + job->rows_per_task, job->clip.y1);
+    RaylibSIMD__FillRect(job, band);
+}
+
+// NOTE: Primitives are either a rounded box (circles, rounded rectangles and,
+// minus a hole, their outlines) or a convex polygon (triangles and lines).
+// Both are measured by a signed distance, negative inside. Aliased edges cover
+// the pixels whose center is inside, antialiased ones cover a pixel by
+// clamp(0.5 - distance, 0, 1) so that edges on pixel boundaries come out the
+// same either way.
+//
+// The polygon distance is the largest distance to an edge's line, exact along
+// the edges but growing past sharp vertices, so the bounding box of the
+// vertices is added as 4 more edges to keep antialiased corners from spiking.
+#define RS_SHAPE_MAX_EDGES 8
+
+typedef enum
+{
+    RaylibSIMD__ShapeType_RoundedBox,
+    RaylibSIMD__ShapeType_Polygon,
+} RaylibSIMD__ShapeType;
+
+typedef struct
+{
+    float center_x, center_y;
+    float half_width, half_height;
+    float radius;                               // At most the smaller half size
+} RaylibSIMD__RoundedBox;
+
+typedef struct
+{
+    RaylibSIMD__ShapeType  type;
+    RaylibSIMD__RoundedBox box;                 // RoundedBox only
+    bool                   hollow;              // RoundedBox only, hole is cut out of box
+    RaylibSIMD__RoundedBox hole;
+    int                    edge_count;          // Polygon only, inside where a * x + b * y + c < 0 for every edge
+    float                  edges[RS_SHAPE_MAX_EDGES][3];
+} RaylibSIMD__Shape;
+
+RS_FILE_SCOPE float RaylibSIMD__RoundedBoxDistance(RaylibSIMD__RoundedBox const *box, float x, float y)
+{
+    float const qx     = fabsf(x - box->center_x) - box->half_width + box->radius;
+    float const qy     = fabsf(y - box->center_y) - box->half_height + box->radius;
+    float const out_x  = RS_MAX(qx, 0.0f);
+    float const out_y  = RS_MAX(qy, 0.0f);
+    float const result = sqrtf(out_x * out_x + out_y * out_y) + RS_MIN(RS_MAX(qx, qy), 0.0f) - box->radius;
+    return result;
+}
+
+RS_FILE_SCOPE float RaylibSIMD__ShapeDistance(RaylibSIMD__Shape const *shape, float x, float y)
+{
+    float result = 0;
+    if (shape->type == RaylibSIMD__ShapeType_RoundedBox)
+    {
+        result = RaylibSIMD__RoundedBoxDistance(&shape->box, x, y);
+        if (shape->hollow) result = RS_MAX(result, -RaylibSIMD__RoundedBoxDistance(&shape->hole, x, y));
+    }
+    else
+    {
+        result = -INFINITY;
+        for (int edge = 0; edge < shape->edge_count; edge++)
+        {
+            float const *line = shape->edges[edge];
+            result            = RS_MAX(result, line[0] * x + line[1] * y + line[2]);
+        }
+    }
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128 RaylibSIMD__RoundedBoxDistance4x_SSE41(RaylibSIMD__RoundedBox const *box, __m128 x, __m128 y)
+{
+    __m128 const abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 const zero     = _mm_setzero_ps();
+    __m128 const radius   = _mm_set1_ps(box->radius);
+    __m128 const qx       = _mm_add_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(x, _mm_set1_ps(box->center_x)), abs_mask), _mm_set1_ps(box->half_width)), radius);
+    __m128 const qy       = _mm_add_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(y, _mm_set1_ps(box->center_y)), abs_mask), _mm_set1_ps(box->half_height)), radius);
+    __m128 const out_x    = _mm_max_ps(qx, zero);
+    __m128 const out_y    = _mm_max_ps(qy, zero);
+    __m128 const outside  = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(out_x, out_x), _mm_mul_ps(out_y, out_y)));
+    __m128 const result   = _mm_sub_ps(_mm_add_ps(outside, _mm_min_ps(_mm_max_ps(qx, qy), zero)), radius);
+    return result;
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 __m128 RaylibSIMD__ShapeDistance4x_SSE41(RaylibSIMD__Shape const *shape, __m128 x, __m128 y)
+{
+    __m128 result = _mm_setzero_ps();
+    if (shape->type == RaylibSIMD__ShapeType_RoundedBox)
+    {
+        result = RaylibSIMD__RoundedBoxDistance4x_SSE41(&shape->box, x, y);
+        if (shape->hollow)
+        {
+            __m128 const hole = RaylibSIMD__RoundedBoxDistance4x_SSE41(&shape->hole, x, y);
+            result            = _mm_max_ps(result, _mm_sub_ps(_mm_setzero_ps(), hole));
+        }
+    }
+    else
+    {
+        result = _mm_set1_ps(-INFINITY);
+        for (int edge = 0; edge < shape->edge_count; edge++)
+        {
+            float const *line     = shape->edges[edge];
+            __m128 const distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(line[0]), x), _mm_mul_ps(_mm_set1_ps(line[1]), y)), _mm_set1_ps(line[2]));
+            result                = _mm_max_ps(result, distance);
+        }
+    }
+    return result;
+}
+
+// NOTE: Pixels [x, x + pixels) of the row whose centers are at y, in color with
+// the alpha scaled by the coverage, as R8G8B8A8. Returns the pixels done.
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__ShapeSpan_SSE41(RaylibSIMD__Shape const *shape, Color color, int x, float y, int pixels, unsigned char *out)
+{
+    __m128 const center_offset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128 const y_4x          = _mm_set1_ps(y);
+    __m128 const half          = _mm_set1_ps(0.5f);
+    __m128 const one           = _mm_set1_ps(1.0f);
+    __m128 const alpha         = _mm_set1_ps(RS_CAST(float)color.a);
+    __m128i const rgb          = _mm_set1_epi32(RS_CAST(int)(RaylibSIMD__ColorToU32(color) & 0x00FFFFFF));
+
+    int index = 0;
+    for (; index + 4 <= pixels; index += 4)
+    {
+        __m128 const x_4x        = _mm_add_ps(_mm_set1_ps(RS_CAST(float)(x + index)), center_offset);
+        __m128 const distance    = RaylibSIMD__ShapeDistance4x_SSE41(shape, x_4x, y_4x);
+        __m128 const coverage    = _mm_min_ps(_mm_max_ps(_mm_sub_ps(half, distance), _mm_setzero_ps()), one);
+        __m128i const alpha_4x   = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(coverage, alpha), half));
+        _mm_storeu_si128(RS_CAST(__m128i *)(out + index * 4), _mm_or_si128(rgb, _mm_slli_epi32(alpha_4x, 24)));
+    }
+    return index;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ShapeSpan(RaylibSIMD__Shape const *shape, Color color, int x, float y, int pixels, unsigned char *out)
+{
+    int index = 0;
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41) index = RaylibSIMD__ShapeSpan_SSE41(shape, color, x, y, pixels, out);
+
+    for (; index < pixels; index++)
+    {
+        float const distance = RaylibSIMD__ShapeDistance(shape, RS_CAST(float)(x + index) + 0.5f, y);
+        float const coverage = RS_MIN(RS_MAX(0.5f - distance, 0.0f), 1.0f);
+        out[index * 4 + 0]   = color.r;
+        out[index * 4 + 1]   = color.g;
+        out[index * 4 + 2]   = color.b;
+        out[index * 4 + 3]   = RS_CAST(unsigned char)(coverage * color.a + 0.5f);
+    }
+}
+
+// NOTE: Where the distance to box is below level along the row at y, as an
+// interval of x. The level set is the box grown by level with its radius
+// grown too, but never below 0 since shrinking past the radius leaves sharp
+// corners. Empty rows give an empty interval at 0.
+RS_FILE_SCOPE void RaylibSIMD__RoundedBoxRow(RaylibSIMD__RoundedBox const *box, float y, float level, float *x0, float *x1)
+{
+    float const half_width  = box->half_width + level;
+    float const half_height = box->half_height + level;
+    float const radius      = RS_MAX(box->radius + level, 0.0f);
+    float const dy          = fabsf(y - box->center_y);
+    float const corner_dy   = dy - (half_height - radius);
+
+    *x0 = *x1 = 0;
+    if ((half_width <= 0) || (dy >= half_height)) return;
+
+    float dx = half_width;
+    if (corner_dy > 0) dx = half_width - radius + sqrtf(radius * radius - corner_dy * corner_dy);
+    *x0 = box->center_x - dx;
+    *x1 = box->center_x + dx;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__PolygonRow(RaylibSIMD__Shape const *shape, float y, float level, float *x0, float *x1)
+{
+    *x0 = -INFINITY;
+    *x1 = INFINITY;
+    for (int edge = 0; edge < shape->edge_count; edge++)
+    {
+        float const *line = shape->edges[edge];
+        float const rest  = level - (line[1] * y + line[2]); // Inside where line[0] * x < rest
+        if (line[0] > 0)       *x1 = RS_MIN(*x1, rest / line[0]);
+        else if (line[0] < 0)  *x0 = RS_MAX(*x0, rest / line[0]);
+        else if (rest <= 0)    { *x0 = *x1 = 0; return; }
+    }
+}
+
+// NOTE: Pixels of rect's row whose centers are in [x0, x1), as [*pixel_x0, *pixel_x1)
+RS_FILE_SCOPE void RaylibSIMD__RowPixels(float x0, float x1, RaylibSIMD__Rect rect, int *pixel_x0, int *pixel_x1)
+{
+    x0        = RS_MAX(x0, RS_CAST(float)rect.x0);
+    x1        = RS_MIN(x1, RS_CAST(float)rect.x1);
+    *pixel_x0 = RS_CAST(int)ceilf(x0 - 0.5f);
+    *pixel_x1 = RS_MAX(RS_CAST(int)ceilf(x1 - 0.5f), *pixel_x0);
+}
+
+// NOTE: Pixels of rect's row at y inside the shape grown by level, without
+// the hole
+RS_FILE_SCOPE void RaylibSIMD__ShapeRow(RaylibSIMD__Shape const *shape, float y, float level, RaylibSIMD__Rect rect, int *x0, int *x1)
+{
+    float row_x0 = 0, row_x1 = 0;
+    if (shape->type == RaylibSIMD__ShapeType_RoundedBox) RaylibSIMD__RoundedBoxRow(&shape->box, y, level, &row_x0, &row_x1);
+    else                                                 RaylibSIMD__PolygonRow(shape, y, level, &row_x0, &row_x1);
+    RaylibSIMD__RowPixels(row_x0, row_x1, rect, x0, x1);
+}
+
+// NOTE: A primitive clipped to the destination, split into parts the same way
+// as RaylibSIMD__DrawJob. Fully covered runs of pixels are filled like
+// RaylibSIMD__FillJob when the edges are aliased or the color is opaque, the
+// rest are built span by span with the coverage in the alpha and blended.
+typedef struct
+{
+    RaylibSIMD__Shape     shape;
+    Color                 color;
+    bool                  antialiased;
+    RaylibSIMD__FillJob   fill;  // Pattern, clip, destination and rows_per_task of the job
+    RaylibSIMD__DrawState state; // R8G8B8A8 spans onto the destination, antialiased only
+} RaylibSIMD__ShapeJob;
+
+// NOTE: rect must lie within job->fill.clip
+RS_FILE_SCOPE void RaylibSIMD__ShapeRect(RaylibSIMD__ShapeJob const *job, RaylibSIMD__Rect rect)
+{
+    unsigned char span[RS_SAMPLE_SPAN_BYTES];
+    unsigned char color_span[RS_SAMPLE_SPAN_BYTES];
+    RaylibSIMD__Shape const *shape = &job->shape;
+    int const bytes_per_pixel      = job->fill.bytes_per_pixel;
+    bool const fill_covered        = !job->antialiased || (job->color.a == 255);
+    float const level              = job->antialiased ? 0.5f : 0.0f;
+    if (!fill_covered)
+    {
+        for (int index = 0; index < RS_SAMPLE_SPAN_PIXELS; index++) memcpy(color_span + index * 4, &job->color, 4);
+    }
+
+    unsigned char *dest_row = job->fill.dest_data + rect.y0 * job->fill.dest_stride;
+    for (int y = rect.y0; y < rect.y1; y++, dest_row += job->fill.dest_stride)
+    {
+        // NOTE: Pixels in [edge) may be covered and those in [covered) are,
+        // except for the ones in [hole_edge) which may be cut out and the ones
+        // in [hole) which are. Aliased edges have no partly covered pixels,
+        // [edge) = [covered) and [hole_edge) = [hole).
+        float const center_y = RS_CAST(float)y + 0.5f;
+        int edge_x0 = 0, edge_x1 = 0, covered_x0 = 0, covered_x1 = 0;
+        int hole_x0 = 0, hole_x1 = 0, hole_edge_x0 = 0, hole_edge_x1 = 0;
+        RaylibSIMD__ShapeRow(shape, center_y, level, rect, &edge_x0, &edge_x1);
+        RaylibSIMD__ShapeRow(shape, center_y, -level, rect, &covered_x0, &covered_x1);
+        if (shape->hollow)
+        {
+            float row_x0 = 0, row_x1 = 0;
+            RaylibSIMD__RoundedBoxRow(&shape->hole, center_y, -level, &row_x0, &row_x1);
+            RaylibSIMD__RowPixels(row_x0, row_x1, rect, &hole_x0, &hole_x1);
+            RaylibSIMD__RoundedBoxRow(&shape->hole, center_y, level, &row_x0, &row_x1);
+            RaylibSIMD__RowPixels(row_x0, row_x1, rect, &hole_edge_x0, &hole_edge_x1);
+        }
+
+        int const bounds[6] = {covered_x0, covered_x1, hole_x0, hole_x1, hole_edge_x0, hole_edge_x1};
+        for (int x = edge_x0; x < edge_x1;)
+        {
+            if ((x >= hole_x0) && (x < hole_x1))
+            {
+                x = hole_x1;
+                continue;
+            }
+
+            bool const covered = (x >= covered_x0) && (x < covered_x1) && !((x >= hole_edge_x0) && (x < hole_edge_x1));
+            int run_x1         = edge_x1;
+            for (int index = 0; index < 6; index++)
+                if (bounds[index] > x) run_x1 = RS_MIN(run_x1, bounds[index]);
+
+            if (covered && fill_covered)
+            {
+                RaylibSIMD__FillSpan(&job->fill, dest_row + x * bytes_per_pixel, RS_CAST(size_t)(run_x1 - x) * bytes_per_pixel);
+            }
+            else
+            {
+                for (int span_x = x; span_x < run_x1; span_x += RS_SAMPLE_SPAN_PIXELS)
+                {
+                    int const pixels = RS_MIN(RS_SAMPLE_SPAN_PIXELS, run_x1 - span_x);
+                    if (!covered) RaylibSIMD__ShapeSpan(shape, job->color, span_x, center_y, pixels, span);
+                    RaylibSIMD__DrawSpan(&job->state, covered ? color_span : span, dest_row + span_x * bytes_per_pixel, pixels);
+                }
+            }
+            x = run_x1;
+        }
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ShapeTask(void *user_data, int task_index)
+{
+    RaylibSIMD__ShapeJob const *job = RS_CAST(RaylibSIMD__ShapeJob const *)user_data;
+    RaylibSIMD__Rect band           = job->fill.clip;
+    band.y0                         = job->fill.clip.y0 + task_index * job->fill.rows_per_task;
+    band.y1                         = RS_MIN(band.y0 + job->fill.rows_per_task, job->fill.clip.y1);
+    RaylibSIMD__ShapeRect(job, band);
+}
+
+// NOTE: raylib's ImageColor* adjustments of R8G8B8A8 pixels, with the same
+// float math so that results match raylib's bit for bit. Each adjustment
+// truncates to 8 bits like raylib's Color loop before the next one runs.
+//
+// Tint, Brightness, Contrast and Invert map every channel on its own, so a
+// run of them is folded into one 256 entry Lookup per channel, built with the
+// scalar math, and costs one table read per channel whatever its length.
+typedef enum
+{
+    RaylibSIMD__ColorFilterType_Tint,
+    RaylibSIMD__ColorFilterType_Brightness,
+    RaylibSIMD__ColorFilterType_Contrast,
+    RaylibSIMD__ColorFilterType_Invert,
+    RaylibSIMD__ColorFilterType_Grayscale,
+    RaylibSIMD__ColorFilterType_Replace,
+    RaylibSIMD__ColorFilterType_Lookup,
+} RaylibSIMD__ColorFilterType;
+
+typedef struct
+{
+    RaylibSIMD__ColorFilterType type;
+    Color                       color;   // Tint, and the color Replace replaces
+    Color                       replace; // Replace only
+    float                       amount;  // Brightness offset, or Contrast factor
+    int                         table;   // Lookup only, index of its RaylibSIMD__ColorTable
+} RaylibSIMD__ColorFilter;
+
+typedef struct
+{
+    unsigned char channels[4][256];
+} RaylibSIMD__ColorTable;
+
+#define RS_COLOR_FILTERS_MAX 8
+
+// NOTE: Every type but Lookup
+RS_FILE_SCOPE void RaylibSIMD__ColorFilterPixel(RaylibSIMD__ColorFilter const *filter, unsigned char *pixel)
+{
+    unsigned char const *color = &filter->color.r;
+    switch (filter->type)
+    {
+        case RaylibSIMD__ColorFilterType_Tint:
+        {
+            for (int channel = 0; channel < 4; channel++)
+                pixel[channel] = RS_CAST(unsigned char)(255 * (RS_CAST(float)pixel[channel] / 255 * (RS_CAST(float)color[channel] / 255)));
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Brightness:
+        {
+            for (int channel = 0; channel < 3; channel++)
+                pixel[channel] = RS_CAST(unsigned char)RS_MIN(RS_MAX(pixel[channel] + RS_CAST(int)filter->amount, 0), 255);
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Contrast:
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                float value    = RS_CAST(float)pixel[channel] / 255.0f;
+                value          = (value - 0.5f) * filter->amount + 0.5f;
+                pixel[channel] = RS_CAST(unsigned char)RS_MIN(RS_MAX(value * 255, 0.0f), 255.0f);
+            }
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Invert:
+        {
+            for (int channel = 0; channel < 3; channel++) pixel[channel] = RS_CAST(unsigned char)(255 - pixel[channel]);
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Grayscale:
+        {
+            // NOTE: Same luminance as raylib's UNCOMPRESSED_GRAYSCALE encoding
+            float const r01    = RS_CAST(float)pixel[0] / 255.0f;
+            float const g01    = RS_CAST(float)pixel[1] / 255.0f;
+            float const b01    = RS_CAST(float)pixel[2] / 255.0f;
+            unsigned char gray = RS_CAST(unsigned char)((r01 * 0.299f + g01 * 0.587f + b01 * 0.114f) * 255.0f);
+            pixel[0] = pixel[1] = pixel[2] = gray;
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Replace:
+        {
+            if (memcmp(pixel, color, 4) == 0) memcpy(pixel, &filter->replace, 4);
+        }
+        break;
+
+        case RaylibSIMD__ColorFilterType_Lookup: break;
+    }
+}
+
+// NOTE: Runs every entry of the table through a channel by channel filter
+RS_FILE_SCOPE void RaylibSIMD__ColorTableFilter(RaylibSIMD__ColorTable *table, RaylibSIMD__ColorFilter const *filter)
+{
+    for (int index = 0; index < 256; index++)
+    {
+        unsigned char pixel[4] = {table->channels[0][index], table->channels[1][index], table->channels[2][index], table->channels[3][index]};
+        RaylibSIMD__ColorFilterPixel(filter, pixel);
+        for (int channel = 0; channel < 4; channel++) table->channels[channel][index] = pixel[channel];
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ColorLookupSpan(RaylibSIMD__ColorTable const *table, unsigned char *pixels, int count)
+{
+    for (int index = 0; index < count; index++, pixels += 4)
+    {
+        pixels[0] = table->channels[0][pixels[0]];
+        pixels[1] = table->channels[1][pixels[1]];
+        pixels[2] = table->channels[2][pixels[2]];
+        pixels[3] = table->channels[3][pixels[3]];
+    }
+}
+
+// NOTE: Returns the pixels done, a multiple of 4
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__GrayscaleSpan_SSE41(unsigned char *pixels, int count)
+{
+    __m128i const mask_8  = _mm_set1_epi32(0xFF);
+    __m128i const alpha   = _mm_set1_epi32(RS_CAST(int)0xFF000000);
+    __m128 const max_8    = _mm_set1_ps(255.0f);
+    __m128 const weight_r = _mm_set1_ps(0.299f);
+    __m128 const weight_g = _mm_set1_ps(0.587f);
+    __m128 const weight_b = _mm_set1_ps(0.114f);
+    int const pixels_done = count & ~3;
+    for (int index = 0; index < pixels_done; index += 4)
+    {
+        __m128i *ptr         = RS_CAST(__m128i *)(pixels + index * 4);
+        __m128i const rgba   = _mm_loadu_si128(ptr);
+        __m128 const r01     = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(rgba, mask_8)), max_8);
+        __m128 const g01     = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), mask_8)), max_8);
+        __m128 const b01     = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), mask_8)), max_8);
+        __m128 const gray    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r01, weight_r), _mm_mul_ps(g01, weight_g)), _mm_mul_ps(b01, weight_b));
+        __m128i const gray_8 = _mm_cvttps_epi32(_mm_mul_ps(gray, max_8));
+        __m128i const rgb    = _mm_or_si128(gray_8, _mm_or_si128(_mm_slli_epi32(gray_8, 8), _mm_slli_epi32(gray_8, 16)));
+        _mm_storeu_si128(ptr, _mm_or_si128(rgb, _mm_and_si128(rgba, alpha)));
+    }
+    return pixels_done;
+}
+
+// NOTE: Returns the pixels done, a multiple of 4
+RS_FILE_SCOPE RS_TARGET_SSE41 int RaylibSIMD__ReplaceSpan_SSE41(Color color, Color replace, unsigned char *pixels, int count)
+{
+    uint32_t color_32 = 0, replace_32 = 0;
+    memcpy(&color_32, &color, 4);
+    memcpy(&replace_32, &replace, 4);
+
+    __m128i const color_4x   = _mm_set1_epi32(RS_CAST(int)color_32);
+    __m128i const replace_4x = _mm_set1_epi32(RS_CAST(int)replace_32);
+    int const pixels_done    = count & ~3;
+    for (int index = 0; index < pixels_done; index += 4)
+    {
+        __m128i *ptr       = RS_CAST(__m128i *)(pixels + index * 4);
+        __m128i const rgba = _mm_loadu_si128(ptr);
+        _mm_storeu_si128(ptr, _mm_blendv_epi8(rgba, replace_4x, _mm_cmpeq_epi32(rgba, color_4x)));
+    }
+    return pixels_done;
+}
+
+// NOTE: ImageColor* adjustments of a whole image, split into parts the same
+// way as RaylibSIMD__DrawJob. Adjustments recorded one after another in a
+// batch are merged into one job, which applies them in a single pass.
+typedef struct
+{
+    RaylibSIMD__ColorFilter       filters[RS_COLOR_FILTERS_MAX]; // Lookup, Grayscale and Replace only
+    int                           filter_count;
+    RaylibSIMD__ColorTable const *tables;
+    int                           format;
+    int                           bytes_per_pixel;
+    RaylibSIMD__Rect              clip;
+    unsigned char                *data;
+    int                           stride;
+    int                           rows_per_task;
+} RaylibSIMD__FilterJob;
+
+// NOTE: Appends filter to the job, folding a channel by channel filter into
+// the Lookup it follows. A new Lookup takes tables[*table_count], which the
+// caller makes room for. Returns false when the job is full.
+RS_FILE_SCOPE bool RaylibSIMD__FilterJobAppend(RaylibSIMD__FilterJob *job, RaylibSIMD__ColorTable *tables, int *table_count, RaylibSIMD__ColorFilter filter)
+{
+    bool const channelwise        = (filter.type <= RaylibSIMD__ColorFilterType_Invert);
+    RaylibSIMD__ColorFilter *last = job->filter_count ? job->filters + job->filter_count - 1 : NULL;
+    if (channelwise && last && (last->type == RaylibSIMD__ColorFilterType_Lookup))
+    {
+        RaylibSIMD__ColorTableFilter(tables + last->table, &filter);
+        return true;
+    }
+    if (job->filter_count == RS_COLOR_FILTERS_MAX) return false;
+
+    if (channelwise)
+    {
+        RaylibSIMD__ColorTable *table = tables + *table_count;
+        for (int index = 0; index < 256; index++)
+            for (int channel = 0; channel < 4; channel++) table->channels[channel][index] = RS_CAST(unsigned char)index;
+        RaylibSIMD__ColorTableFilter(table, &filter);
+
+        filter.type  = RaylibSIMD__ColorFilterType_Lookup;
+        filter.table = (*table_count)++;
+    }
+    job->filters[job->filter_count++] = filter;
+    return true;
+}
+
+// NOTE: rect must lie within job->clip. Formats other than R8G8B8A8 are
+// converted to it and back 128 pixels at a time, like raylib's GetImageData
+// and ImageFormat.
+RS_FILE_SCOPE void RaylibSIMD__FilterRect(RaylibSIMD__FilterJob const *job, RaylibSIMD__Rect rect)
+{
+    unsigned char span[RS_SAMPLE_SPAN_BYTES];
+    bool const sse41   = (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41);
+    bool const rgba    = (job->format == UNCOMPRESSED_R8G8B8A8);
+    int const width    = rect.x1 - rect.x0;
+    unsigned char *row = job->data + rect.y0 * job->stride + rect.x0 * job->bytes_per_pixel;
+    for (int y = rect.y0; y < rect.y1; y++, row += job->stride)
+    {
+        for (int x = 0; x < width; x += RS_SAMPLE_SPAN_PIXELS)
+        {
+            int const pixels      = RS_MIN(RS_SAMPLE_SPAN_PIXELS, width - x);
+            unsigned char *source = row + x * job->bytes_per_pixel;
+            unsigned char *rgba8  = rgba ? source : span;
+            if (!rgba && sse41) RaylibSIMD__ConvertPixels_SSE41(source, job->format, span, UNCOMPRESSED_R8G8B8A8, pixels);
+            else if (!rgba)     RaylibSIMD__ConvertPixels(source, job->format, span, UNCOMPRESSED_R8G8B8A8, pixels);
+
+            for (int index = 0; index < job->filter_count; index++)
+            {
+                RaylibSIMD__ColorFilter const *filter = job->filters + index;
+                int filtered                          = 0;
+                if (filter->type == RaylibSIMD__ColorFilterType_Lookup)
+                {
+                    RaylibSIMD__ColorLookupSpan(job->tables + filter->table, rgba8, pixels);
+                    filtered = pixels;
+                }
+                else if (sse41 && (filter->type == RaylibSIMD__ColorFilterType_Grayscale)) filtered = RaylibSIMD__GrayscaleSpan_SSE41(rgba8, pixels);
+                else if (sse41 && (filter->type == RaylibSIMD__ColorFilterType_Replace))   filtered = RaylibSIMD__ReplaceSpan_SSE41(filter->color, filter->replace, rgba8, pixels);
+
+                for (; filtered < pixels; filtered++) RaylibSIMD__ColorFilterPixel(filter, rgba8 + filtered * 4);
+            }
+
+            if (!rgba && sse41) RaylibSIMD__ConvertPixels_SSE41(span, UNCOMPRESSED_R8G8B8A8, source, job->format, pixels);
+            else if (!rgba)     RaylibSIMD__ConvertPixels(span, UNCOMPRESSED_R8G8B8A8, source, job->format, pixels);
+        }
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__FilterTask(void *user_data, int task_index)
+{
+    RaylibSIMD__FilterJob const *job = RS_CAST(RaylibSIMD__FilterJob const *)user_data;
+    RaylibSIMD__Rect band            = job->clip;
+    band.y0                          = job->clip.y0 + task_index * job->rows_per_task;
+    band.y1                          = RS_MIN(band.y0 + job->rows_per_task, job->clip.y1);
+    RaylibSIMD__FilterRect(job, band);
+}
+
+// NOTE: Separable convolution of a whole image, horizontally then vertically,
+// on float channels: [0, 255] for the 8 and 16 bit formats, which go through
+// R8G8B8A8 and are rounded to nearest when stored, and the float formats'
+// own values. Pixels outside the image repeat the edge pixel.
+//
+// The image is split into tiles of strip_width columns by band_rows rows that
+// run in parallel. A tile filters every source row it needs horizontally into
+// a ring of 2 * radius_y + 1 rows, so each row is only filtered once, and
+// sums the ring vertically into each output row. Box filters keep running
+// sums in both directions so their cost doesn't depend on the radius, and
+// their buffers stop growing at the image size, see RaylibSIMD_ImageBlurBox.
+#define RS_CONVOLVE_MAX_RADIUS 64
+
+typedef struct
+{
+    float                weights_x[2 * RS_CONVOLVE_MAX_RADIUS + 1];
+    float                weights_y[2 * RS_CONVOLVE_MAX_RADIUS + 1];
+    int                  radius_x;
+    int                  radius_y;
+    bool                 box;     // Running sums instead of weights, the cost doesn't depend on the radius
+    int                  box_extra_x; // Box radius past radius_x, see RaylibSIMD_ImageBlurBox
+    int                  box_extra_y;
+    float                sharpen; // Unsharp mask amount, 0 keeps the filtered pixels
+    unsigned char const *src;
+    unsigned char       *dest;
+    int                  format;
+    int                  bytes_per_pixel;
+    int                  width;
+    int                  height;
+    int                  strip_width;
+    int                  strip_count;
+    int                  band_rows;
+} RaylibSIMD__ConvolveJob;
+
+RS_FILE_SCOPE bool RaylibSIMD__IsFloatFormat(int format)
+{
+    bool result = (format == UNCOMPRESSED_R32) || (format == UNCOMPRESSED_R32G32B32) || (format == UNCOMPRESSED_R32G32B32A32);
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__WidenBytes(unsigned char const *src, float *dest, int count)
+{
+    for (int index = 0; index < count; index++) dest[index] = RS_CAST(float)src[index];
+}
+
+RS_FILE_SCOPE void RaylibSIMD__NarrowFloats(float const *src, unsigned char *dest, int count)
+{
+    for (int index = 0; index < count; index++)
+        dest[index] = RS_CAST(unsigned char)(RS_MIN(RS_MAX(src[index], 0.0f), 255.0f) + 0.5f);
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__WidenBytes_SSE41(unsigned char const *src, float *dest, int count)
+{
+    int index = 0;
+    for (; index + 16 <= count; index += 16)
+    {
+        __m128i const bytes = _mm_loadu_si128(RS_CAST(__m128i const *)(src + index));
+        _mm_storeu_ps(dest + index + 0,  _mm_cvtepi32_ps(_mm_cvtepu8_epi32(bytes)));
+        _mm_storeu_ps(dest + index + 4,  _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4))));
+        _mm_storeu_ps(dest + index + 8,  _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8))));
+        _mm_storeu_ps(dest + index + 12, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12))));
+    }
+    RaylibSIMD__WidenBytes(src + index, dest + index, count - index);
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__NarrowFloats_SSE41(float const *src, unsigned char *dest, int count)
+{
+    __m128 const zero  = _mm_setzero_ps();
+    __m128 const max_8 = _mm_set1_ps(255.0f);
+    __m128 const half  = _mm_set1_ps(0.5f);
+    int index          = 0;
+    for (; index + 16 <= count; index += 16)
+    {
+        __m128i values[4];
+        for (int part = 0; part < 4; part++)
+            values[part] = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + index + part * 4), zero), max_8), half));
+        __m128i const words = _mm_packus_epi32(values[0], values[1]);
+        _mm_storeu_si128(RS_CAST(__m128i *)(dest + index), _mm_packus_epi16(words, _mm_packus_epi32(values[2], values[3])));
+    }
+    RaylibSIMD__NarrowFloats(src + index, dest + index, count - index);
+}
+
+// NOTE: out[i] = sum of weights[tap] * rows[tap][i], taps summed in order so
+// that every instruction set gives the same result. count is a multiple of 4.
+RS_FILE_SCOPE void RaylibSIMD__WeightedSum(float const *const *rows, float const *weights, int taps, float *out, int count)
+{
+    for (int index = 0; index < count; index++)
+    {
+        float sum = 0;
+        for (int tap = 0; tap < taps; tap++) sum += weights[tap] * rows[tap][index];
+        out[index] = sum;
+    }
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__WeightedSum_SSE41(float const *const *rows, float const *weights, int taps, float *out, int count)
+{
+    int index = 0;
+    for (; index + 16 <= count; index += 16)
+    {
+        __m128 sum_0 = _mm_setzero_ps(), sum_1 = _mm_setzero_ps(), sum_2 = _mm_setzero_ps(), sum_3 = _mm_setzero_ps();
+        for (int tap = 0; tap < taps; tap++)
+        {
+            __m128 const weight = _mm_set1_ps(weights[tap]);
+            float const *row    = rows[tap] + index;
+            sum_0               = _mm_add_ps(sum_0, _mm_mul_ps(weight, _mm_loadu_ps(row + 0)));
+            sum_1               = _mm_add_ps(sum_1, _mm_mul_ps(weight, _mm_loadu_ps(row + 4)));
+            sum_2               = _mm_add_ps(sum_2, _mm_mul_ps(weight, _mm_loadu_ps(row + 8)));
+            sum_3               = _mm_add_ps(sum_3, _mm_mul_ps(weight, _mm_loadu_ps(row + 12)));
+        }
+        _mm_storeu_ps(out + index + 0, sum_0);
+        _mm_storeu_ps(out + index + 4, sum_1);
+        _mm_storeu_ps(out + index + 8, sum_2);
+        _mm_storeu_ps(out + index + 12, sum_3);
+    }
+    for (; index < count; index += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (int tap = 0; tap < taps; tap++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[tap]), _mm_loadu_ps(rows[tap] + index)));
+        _mm_storeu_ps(out + index, sum);
+    }
+}
+
+RS_FILE_SCOPE RS_TARGET_AVX2 void RaylibSIMD__WeightedSum_AVX2(float const *const *rows, float const *weights, int taps, float *out, int count)
+{
+    int index = 0;
+    for (; index + 32 <= count; index += 32)
+    {
+        __m256 sum_0 = _mm256_setzero_ps(), sum_1 = _mm256_setzero_ps(), sum_2 = _mm256_setzero_ps(), sum_3 = _mm256_setzero_ps();
+        for (int tap = 0; tap < taps; tap++)
+        {
+            __m256 const weight = _mm256_set1_ps(weights[tap]);
+            float const *row    = rows[tap] + index;
+            sum_0               = _mm256_add_ps(sum_0, _mm256_mul_ps(weight, _mm256_loadu_ps(row + 0)));
+            sum_1               = _mm256_add_ps(sum_1, _mm256_mul_ps(weight, _mm256_loadu_ps(row + 8)));
+            sum_2               = _mm256_add_ps(sum_2, _mm256_mul_ps(weight, _mm256_loadu_ps(row + 16)));
+            sum_3               = _mm256_add_ps(sum_3, _mm256_mul_ps(weight, _mm256_loadu_ps(row + 24)));
+        }
+        _mm256_storeu_ps(out + index + 0, sum_0);
+        _mm256_storeu_ps(out + index + 8, sum_1);
+        _mm256_storeu_ps(out + index + 16, sum_2);
+        _mm256_storeu_ps(out + index + 24, sum_3);
+    }
+    for (; index < count; index += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (int tap = 0; tap < taps; tap++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[tap]), _mm_loadu_ps(rows[tap] + index)));
+        _mm_storeu_ps(out + index, sum);
+    }
+}
+
+// NOTE: out[x] = sum of in[x .. x + 2 * radius] per channel, as a running sum
+// over pixels of 4 floats
+RS_FILE_SCOPE void RaylibSIMD__BoxRow(float const *in, int radius, float *out, int pixels)
+{
+    float sum[4] = {0};
+    for (int tap = 0; tap <= 2 * radius; tap++)
+        for (int channel = 0; channel < 4; channel++) sum[channel] += in[tap * 4 + channel];
+    for (int x = 0; x < pixels; x++)
+    {
+        for (int channel = 0; channel < 4; channel++)
+        {
+            if (x > 0) sum[channel] += in[(x + 2 * radius) * 4 + channel] - in[(x - 1) * 4 + channel];
+            out[x * 4 + channel] = sum[channel];
+        }
+    }
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__BoxRow_SSE41(float const *in, int radius, float *out, int pixels)
+{
+    __m128 sum = _mm_setzero_ps();
+    for (int tap = 0; tap <= 2 * radius; tap++) sum = _mm_add_ps(sum, _mm_loadu_ps(in + tap * 4));
+    _mm_storeu_ps(out, sum);
+
+    float const *leaving  = in;
+    float const *entering = in + (2 * radius + 1) * 4;
+    for (int x = 1; x < pixels; x++, leaving += 4, entering += 4)
+    {
+        sum = _mm_add_ps(sum, _mm_sub_ps(_mm_loadu_ps(entering), _mm_loadu_ps(leaving)));
+        _mm_storeu_ps(out + x * 4, sum);
+    }
+}
+
+// NOTE: Slides the vertical running sums down a row, out[i] = sums[i] * scale
+RS_FILE_SCOPE void RaylibSIMD__BoxColumns(float *sums, float const *entering, float const *leaving, float scale, float *out, int count)
+{
+    for (int index = 0; index < count; index++)
+    {
+        sums[index] += entering[index] - leaving[index];
+        out[index]   = sums[index] * scale;
+    }
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__BoxColumns_SSE41(float *sums, float const *entering, float const *leaving, float scale, float *out, int count)
+{
+    __m128 const scale_4x = _mm_set1_ps(scale);
+    for (int index = 0; index < count; index += 4)
+    {
+        __m128 const sum = _mm_add_ps(_mm_loadu_ps(sums + index), _mm_sub_ps(_mm_loadu_ps(entering + index), _mm_loadu_ps(leaving + index)));
+        _mm_storeu_ps(sums + index, sum);
+        _mm_storeu_ps(out + index, _mm_mul_ps(sum, scale_4x));
+    }
+}
+
+// NOTE: Per task buffers, carved out of one allocation
+typedef struct
+{
+    float          *line;  // Source row of the tile and its apron
+    unsigned char  *bytes; // R8G8B8A8 staging of line
+    float         **ring;  // 2 * radius_y + 2 rows, the last one spare
+    float const   **taps;
+    float          *sums;
+    float          *out;
+    float          *original;
+    bool            sse41;
+    bool            avx2;
+} RaylibSIMD__ConvolveScratch;
+
+// NOTE: Pixels [x0, x1) of row y as float channels, with rows and columns
+// outside the image repeating the edge
+RS_FILE_SCOPE void RaylibSIMD__ConvolveLoadRow(RaylibSIMD__ConvolveJob const *job, RaylibSIMD__ConvolveScratch const *scratch, int y, int x0, int x1, float *out)
+{
+    y                        = RS_MIN(RS_MAX(y, 0), job->height - 1);
+    int const inside_x0      = RS_MIN(RS_MAX(x0, 0), job->width - 1);
+    int const inside_x1      = RS_MAX(RS_MIN(x1, job->width), inside_x0 + 1);
+    int const pixels         = inside_x1 - inside_x0;
+    unsigned char const *src = job->src + (y * job->width + inside_x0) * job->bytes_per_pixel;
+    float *inside            = out + (inside_x0 - x0) * 4;
+    if (RaylibSIMD__IsFloatFormat(job->format))
+    {
+        if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(src, job->format, RS_CAST(unsigned char *)inside, UNCOMPRESSED_R32G32B32A32, pixels);
+        else                RaylibSIMD__ConvertPixels(src, job->format, RS_CAST(unsigned char *)inside, UNCOMPRESSED_R32G32B32A32, pixels);
+    }
+    else
+    {
+        unsigned char const *rgba8 = src;
+        if (job->format != UNCOMPRESSED_R8G8B8A8)
+        {
+            if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(src, job->format, scratch->bytes, UNCOMPRESSED_R8G8B8A8, pixels);
+            else                RaylibSIMD__ConvertPixels(src, job->format, scratch->bytes, UNCOMPRESSED_R8G8B8A8, pixels);
+            rgba8 = scratch->bytes;
+        }
+        if (scratch->sse41) RaylibSIMD__WidenBytes_SSE41(rgba8, inside, pixels * 4);
+        else                RaylibSIMD__WidenBytes(rgba8, inside, pixels * 4);
+    }
+
+    for (int x = x0; x < inside_x0; x++) memcpy(out + (x - x0) * 4, inside, sizeof(float) * 4);
+    for (int x = inside_x1; x < x1; x++) memcpy(out + (x - x0) * 4, inside + (pixels - 1) * 4, sizeof(float) * 4);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ConvolveStoreRow(RaylibSIMD__ConvolveJob const *job, RaylibSIMD__ConvolveScratch const *scratch, int y, int x0, int pixels, float const *row)
+{
+    unsigned char *dest = job->dest + (y * job->width + x0) * job->bytes_per_pixel;
+    if (RaylibSIMD__IsFloatFormat(job->format))
+    {
+        if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(RS_CAST(unsigned char const *)row, UNCOMPRESSED_R32G32B32A32, dest, job->format, pixels);
+        else                RaylibSIMD__ConvertPixels(RS_CAST(unsigned char const *)row, UNCOMPRESSED_R32G32B32A32, dest, job->format, pixels);
+        return;
+    }
+
+    unsigned char *rgba8 = (job->format == UNCOMPRESSED_R8G8B8A8) ? dest : scratch->bytes;
+    if (scratch->sse41) RaylibSIMD__NarrowFloats_SSE41(row, rgba8, pixels * 4);
+    else                RaylibSIMD__NarrowFloats(row, rgba8, pixels * 4);
+    if (job->format != UNCOMPRESSED_R8G8B8A8)
+    {
+        if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(rgba8, UNCOMPRESSED_R8G8B8A8, dest, job->format, pixels);
+        else                RaylibSIMD__ConvertPixels(rgba8, UNCOMPRESSED_R8G8B8A8, dest, job->format, pixels);
+    }
+}
+
+// NOTE: Row y of the tile's columns [x0, x0 + pixels) filtered horizontally,
+// unscaled sums for box filters
+RS_FILE_SCOPE void RaylibSIMD__ConvolveRowX(RaylibSIMD__ConvolveJob const *job, RaylibSIMD__ConvolveScratch const *scratch, int y, int x0, int pixels, float *out)
+{
+    int const radius = job->radius_x;
+    RaylibSIMD__ConvolveLoadRow(job, scratch, y, x0 - radius, x0 + pixels + radius, scratch->line);
+    if (job->box)
+    {
+        if (scratch->sse41) RaylibSIMD__BoxRow_SSE41(scratch->line, radius, out, pixels);
+        else                RaylibSIMD__BoxRow(scratch->line, radius, out, pixels);
+
+        // NOTE: The line starts on the first pixel of the row and ends on the
+        // last, each repeated box_extra_x more times in every box
+        if (job->box_extra_x)
+        {
+            float const extra    = RS_CAST(float)job->box_extra_x;
+            float const *last    = scratch->line + (pixels + 2 * radius - 1) * 4;
+            float const edges[4] = {scratch->line[0] + last[0], scratch->line[1] + last[1], scratch->line[2] + last[2], scratch->line[3] + last[3]};
+            for (int index = 0; index < pixels * 4; index++) out[index] += extra * edges[index & 3];
+        }
+        return;
+    }
+
+    for (int tap = 0; tap <= 2 * radius; tap++) scratch->taps[tap] = scratch->line + tap * 4;
+    if (scratch->avx2)       RaylibSIMD__WeightedSum_AVX2(scratch->taps, job->weights_x, 2 * radius + 1, out, pixels * 4);
+    else if (scratch->sse41) RaylibSIMD__WeightedSum_SSE41(scratch->taps, job->weights_x, 2 * radius + 1, out, pixels * 4);
+    else                     RaylibSIMD__WeightedSum(scratch->taps, job->weights_x, 2 * radius + 1, out, pixels * 4);
+}
+
+// NOTE: Applies the unsharp mask, if any, and stores the row
+RS_FILE_SCOPE void RaylibSIMD__ConvolveFinishRow(RaylibSIMD__ConvolveJob const *job, RaylibSIMD__ConvolveScratch const *scratch, int y, int x0, int pixels)
+{
+    if (job->sharpen != 0)
+    {
+        RaylibSIMD__ConvolveLoadRow(job, scratch, y, x0, x0 + pixels, scratch->original);
+        float const amount = job->sharpen;
+        for (int index = 0; index < pixels * 4; index++)
+            scratch->out[index] = scratch->original[index] + (scratch->original[index] - scratch->out[index]) * amount;
+    }
+    RaylibSIMD__ConvolveStoreRow(job, scratch, y, x0, pixels, scratch->out);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__ConvolveTask(void *user_data, int task_index)
+{
+    RaylibSIMD__ConvolveJob const *job = RS_CAST(RaylibSIMD__ConvolveJob const *)user_data;
+    int const x0                       = (task_index % job->strip_count) * job->strip_width;
+    int const y0                       = (task_index / job->strip_count) * job->band_rows;
+    int const pixels                   = RS_MIN(job->strip_width, job->width - x0);
+    int const y1                       = RS_MIN(y0 + job->band_rows, job->height);
+    int const floats                   = pixels * 4;
+    int const line_pixels              = pixels + 2 * job->radius_x;
+    int const ring_rows                = 2 * job->radius_y + 1;
+    int const tap_count                = RS_MAX(2 * job->radius_x + 1, ring_rows);
+
+    // NOTE: Rows padded to whole cache lines
+    size_t const line_stride = RS_ALIGN_UP(RS_CAST(size_t)line_pixels * 4 * sizeof(float)) / sizeof(float);
+    size_t const row_stride  = RS_ALIGN_UP(RS_CAST(size_t)floats * sizeof(float)) / sizeof(float);
+    size_t const float_count = line_stride + RS_CAST(size_t)(ring_rows + 4) * row_stride;
+    size_t const size        = float_count * sizeof(float) + RS_CAST(size_t)(ring_rows + 1 + tap_count) * sizeof(float *) + RS_CAST(size_t)line_pixels * 4;
+    unsigned char *memory    = RS_CAST(unsigned char *)RaylibSIMD__ScratchAlloc(size);
+    if (!memory)
+    {
+        TRACELOG(LOG_WARNING, "Image convolution failed to allocate memory, tile left unfiltered");
+        for (int y = y0; y < y1; y++)
+        {
+            size_t const offset = (RS_CAST(size_t)y * job->width + x0) * job->bytes_per_pixel;
+            memcpy(job->dest + offset, job->src + offset, RS_CAST(size_t)pixels * job->bytes_per_pixel);
+        }
+        return;
+    }
+
+    RaylibSIMD__ConvolveScratch scratch = {0};
+    float *floats_ptr                   = RS_CAST(float *)memory;
+    scratch.line                        = floats_ptr;
+    floats_ptr                         += line_stride;
+    scratch.sums                        = floats_ptr;
+    floats_ptr                         += row_stride;
+    scratch.out                         = floats_ptr;
+    floats_ptr                         += row_stride;
+    scratch.original                    = floats_ptr;
+    floats_ptr                         += row_stride;
+    scratch.ring                        = RS_CAST(float **)(memory + float_count * sizeof(float));
+    scratch.taps                        = RS_CAST(float const **)(scratch.ring + ring_rows + 1);
+    scratch.bytes                       = RS_CAST(unsigned char *)(scratch.taps + tap_count);
+    scratch.sse41                       = (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41);
+    scratch.avx2                        = (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_AVX2);
+    for (int row = 0; row <= ring_rows; row++) scratch.ring[row] = floats_ptr + row * row_stride;
+
+    int const radius_y = job->radius_y;
+    if (job->box)
+    {
+        // NOTE: The ring holds rows y - radius - 1 to y + radius - 1 when row
+        // y starts and sums is their total. The row entering the window is
+        // filtered into the spare, then swapped with the one leaving it.
+        int const first    = y0 - radius_y - 1;
+        float const size_x = 2.0f * RS_CAST(float)(job->radius_x + job->box_extra_x) + 1.0f;
+        float const size_y = 2.0f * RS_CAST(float)(radius_y + job->box_extra_y) + 1.0f;
+        float const scale  = 1.0f / (size_x * size_y);
+        memset(scratch.sums, 0, sizeof(float) * floats);
+        for (int row = first; row < y0 + radius_y; row++)
+        {
+            float *filtered = scratch.ring[row - first];
+            RaylibSIMD__ConvolveRowX(job, &scratch, row, x0, pixels, filtered);
+            for (int index = 0; index < floats; index++) scratch.sums[index] += filtered[index];
+        }
+
+        // NOTE: The first row of the ring is the first of the image and the
+        // last one its last, which every box repeats box_extra_y more times
+        if (job->box_extra_y)
+        {
+            float const extra = RS_CAST(float)job->box_extra_y;
+            for (int index = 0; index < floats; index++) scratch.sums[index] += extra * (scratch.ring[0][index] + scratch.ring[2 * radius_y][index]);
+        }
+
+        for (int y = y0; y < y1; y++)
+        {
+            int const slot  = (y - radius_y - 1 - first) % ring_rows;
+            float *entering = scratch.ring[ring_rows];
+            RaylibSIMD__ConvolveRowX(job, &scratch, y + radius_y, x0, pixels, entering);
+            if (scratch.sse41) RaylibSIMD__BoxColumns_SSE41(scratch.sums, entering, scratch.ring[slot], scale, scratch.out, floats);
+            else               RaylibSIMD__BoxColumns(scratch.sums, entering, scratch.ring[slot], scale, scratch.out, floats);
+            scratch.ring[ring_rows] = scratch.ring[slot];
+            scratch.ring[slot]      = entering;
+            RaylibSIMD__ConvolveFinishRow(job, &scratch, y, x0, pixels);
+        }
+    }
+    else
+    {
+        int const first = y0 - radius_y;
+        for (int row = first; row < y0 + radius_y; row++)
+            RaylibSIMD__ConvolveRowX(job, &scratch, row, x0, pixels, scratch.ring[row - first]);
+
+        for (int y = y0; y < y1; y++)
+        {
+            RaylibSIMD__ConvolveRowX(job, &scratch, y + radius_y, x0, pixels, scratch.ring[(y + radius_y - first) % ring_rows]);
+            for (int tap = 0; tap < ring_rows; tap++) scratch.taps[tap] = scratch.ring[(y - radius_y + tap - first) % ring_rows];
+            if (scratch.avx2)       RaylibSIMD__WeightedSum_AVX2(scratch.taps, job->weights_y, ring_rows, scratch.out, floats);
+            else if (scratch.sse41) RaylibSIMD__WeightedSum_SSE41(scratch.taps, job->weights_y, ring_rows, scratch.out, floats);
+            else                    RaylibSIMD__WeightedSum(scratch.taps, job->weights_y, ring_rows, scratch.out, floats);
+            RaylibSIMD__ConvolveFinishRow(job, &scratch, y, x0, pixels);
+        }
+    }
+
+    RaylibSIMD__ScratchFree(memory);
+}
+
+// NOTE: Mipmap levels follow the base level in the image data, each half the
+// size of the one above (rounded down, at least 1) like raylib's ImageMipmaps.
+// Every pixel of a level is the average of the 2x2 pixels above it, so on odd
+// sizes the last row or column of the level above is left out. Levels are
+// always built from the stored level above, so rebuilding part of them after a
+// draw gives the same pixels as rebuilding all of them.
+//
+// 8 bit formats are averaged as R8G8B8A8, float formats as float.
+// RaylibSIMD_MipmapFilter_BoxGamma averages the color of 8 bit formats in
+// linear light, as 14 bit values so that four of them still add up in 16 bits.
+// Alpha is scaled by 64 instead, which averages it exactly like Box.
+#define RS_MIPMAP_MAX_LEVELS 32
+#define RS_MIPMAP_BAND_ROWS  64 // Base rows per task, whose levels down to 1/64 are built in the same pass
+#define RS_MIPMAP_LINEAR_MAX 16383
+
+typedef struct
+{
+    unsigned char    *levels[RS_MIPMAP_MAX_LEVELS];
+    int               widths[RS_MIPMAP_MAX_LEVELS];
+    int               heights[RS_MIPMAP_MAX_LEVELS];
+    int               level_count;
+    int               format;
+    int               bytes_per_pixel;
+    bool              gamma;
+    int               band_levels;   // Levels built by RaylibSIMD__MipmapBandTask
+    int               level;         // Level and part of it built by RaylibSIMD__MipmapRowsTask
+    RaylibSIMD__Rect  rect;
+    int               rows_per_task;
+} RaylibSIMD__MipmapJob;
+
+RS_FILE_SCOPE uint16_t      RaylibSIMD__srgb_to_linear[256];
+RS_FILE_SCOPE unsigned char RaylibSIMD__linear_to_srgb[RS_MIPMAP_LINEAR_MAX + 1];
+RS_FILE_SCOPE bool          RaylibSIMD__srgb_tables_ready;
+
+RS_FILE_SCOPE void RaylibSIMD__InitSRGBTables(void)
+{
+    if (RaylibSIMD__srgb_tables_ready) return;
+    for (int value = 0; value < 256; value++)
+    {
+        double const srgb  = value / 255.0;
+        double const linear = (srgb <= 0.04045) ? srgb / 12.92 : pow((srgb + 0.055) / 1.055, 2.4);
+        RaylibSIMD__srgb_to_linear[value] = RS_CAST(uint16_t)(linear * RS_MIPMAP_LINEAR_MAX + 0.5);
+    }
+    for (int value = 0; value <= RS_MIPMAP_LINEAR_MAX; value++)
+    {
+        double const linear = RS_CAST(double)value / RS_MIPMAP_LINEAR_MAX;
+        double const srgb   = (linear <= 0.0031308) ? linear * 12.92 : 1.055 * pow(linear, 1.0 / 2.4) - 0.055;
+        RaylibSIMD__linear_to_srgb[value] = RS_CAST(unsigned char)(srgb * 255.0 + 0.5);
+    }
+    RaylibSIMD__srgb_tables_ready = true;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DecodeSRGB(unsigned char const *src, uint16_t *dest, int pixels)
+{
+    for (int index = 0; index < pixels; index++, src += 4, dest += 4)
+    {
+        uint32_t pixel;
+        memcpy(&pixel, src, 4);
+        dest[0] = RaylibSIMD__srgb_to_linear[pixel & 0xFF];
+        dest[1] = RaylibSIMD__srgb_to_linear[(pixel >> 8) & 0xFF];
+        dest[2] = RaylibSIMD__srgb_to_linear[(pixel >> 16) & 0xFF];
+        dest[3] = RS_CAST(uint16_t)((pixel >> 24) << 6);
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__EncodeSRGB(uint16_t const *src, unsigned char *dest, int pixels)
+{
+    for (int index = 0; index < pixels; index++, src += 4, dest += 4)
+    {
+        uint32_t const pixel = RaylibSIMD__linear_to_srgb[src[0]] | (RaylibSIMD__linear_to_srgb[src[1]] << 8) |
+                               (RaylibSIMD__linear_to_srgb[src[2]] << 16) | (RS_CAST(uint32_t)((src[3] + 32) >> 6) << 24);
+        memcpy(dest, &pixel, 4);
+    }
+}
+
+// NOTE: out pixel i = rounded average of pixels 2i and 2i + 1 of both rows
+RS_FILE_SCOPE void RaylibSIMD__Downsample8(unsigned char const *row0, unsigned char const *row1, unsigned char *out, int pixels)
+{
+    for (int index = 0; index < pixels * 4; index++)
+    {
+        int const channel = index & 3, src = (index - channel) * 2 + channel;
+        out[index]        = RS_CAST(unsigned char)((row0[src] + row0[src + 4] + row1[src] + row1[src + 4] + 2) >> 2);
+    }
+}
+
+RS_FILE_SCOPE void RaylibSIMD__Downsample16(uint16_t const *row0, uint16_t const *row1, uint16_t *out, int pixels)
+{
+    for (int index = 0; index < pixels * 4; index++)
+    {
+        int const channel = index & 3, src = (index - channel) * 2 + channel;
+        out[index]        = RS_CAST(uint16_t)((row0[src] + row0[src + 4] + row1[src] + row1[src + 4] + 2) >> 2);
+    }
+}
+
+// NOTE: Rows are added as 16 bit channels, then the channels of neighbouring
+// pixels by moving the odd pixels' 64 bit halves under the even ones
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__Downsample8_SSE41(unsigned char const *row0, unsigned char const *row1, unsigned char *out, int pixels)
+{
+    __m128i const zero  = _mm_setzero_si128();
+    __m128i const round = _mm_set1_epi16(2);
+    int index           = 0;
+    for (; index + 4 <= pixels; index += 4)
+    {
+        __m128i const a0    = _mm_loadu_si128(RS_CAST(__m128i const *)(row0 + index * 8));
+        __m128i const a1    = _mm_loadu_si128(RS_CAST(__m128i const *)(row0 + index * 8 + 16));
+        __m128i const b0    = _mm_loadu_si128(RS_CAST(__m128i const *)(row1 + index * 8));
+        __m128i const b1    = _mm_loadu_si128(RS_CAST(__m128i const *)(row1 + index * 8 + 16));
+        __m128i const s01   = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        __m128i const s23   = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        __m128i const s45   = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        __m128i const s67   = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+        __m128i const out01 = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+        __m128i const out23 = _mm_add_epi16(_mm_unpacklo_epi64(s45, s67), _mm_unpackhi_epi64(s45, s67));
+        _mm_storeu_si128(RS_CAST(__m128i *)(out + index * 4), _mm_packus_epi16(_mm_srli_epi16(_mm_add_epi16(out01, round), 2),
+                                                                               _mm_srli_epi16(_mm_add_epi16(out23, round), 2)));
+    }
+    RaylibSIMD__Downsample8(row0 + index * 8, row1 + index * 8, out + index * 4, pixels - index);
+}
+
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__Downsample16_SSE41(uint16_t const *row0, uint16_t const *row1, uint16_t *out, int pixels)
+{
+    __m128i const round = _mm_set1_epi16(2);
+    int index           = 0;
+    for (; index + 2 <= pixels; index += 2)
+    {
+        __m128i const s01 = _mm_add_epi16(_mm_loadu_si128(RS_CAST(__m128i const *)(row0 + index * 8)), _mm_loadu_si128(RS_CAST(__m128i const *)(row1 + index * 8)));
+        __m128i const s23 = _mm_add_epi16(_mm_loadu_si128(RS_CAST(__m128i const *)(row0 + index * 8 + 8)), _mm_loadu_si128(RS_CAST(__m128i const *)(row1 + index * 8 + 8)));
+        __m128i const sum = _mm_add_epi16(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23));
+        _mm_storeu_si128(RS_CAST(__m128i *)(out + index * 4), _mm_srli_epi16(_mm_add_epi16(sum, round), 2));
+    }
+    RaylibSIMD__Downsample16(row0 + index * 8, row1 + index * 8, out + index * 4, pixels - index);
+}
+
+// NOTE: Per task buffers, carved out of one allocation
+typedef struct
+{
+    unsigned char *rows[2];   // Rows of the level above as R8G8B8A8 or R32G32B32A32
+    unsigned char *out;       // Row of the level as R8G8B8A8 or R32G32B32A32
+    uint16_t      *linear[2]; // rows in linear light
+    uint16_t      *sums;
+    bool           sse41;
+} RaylibSIMD__MipmapScratch;
+
+// NOTE: Sized for rows of the base level, returns the allocation to free
+RS_FILE_SCOPE void *RaylibSIMD__MipmapScratchAlloc(RaylibSIMD__MipmapScratch *scratch, int width)
+{
+    size_t const row_bytes = RS_ALIGN_UP((RS_CAST(size_t)width + 2) * 16);
+    unsigned char *memory  = RS_CAST(unsigned char *)RaylibSIMD__ScratchAlloc(row_bytes * 4);
+    if (memory)
+    {
+        scratch->rows[0]   = memory;
+        scratch->rows[1]   = memory + row_bytes;
+        scratch->out       = memory + row_bytes * 2;
+        scratch->linear[0] = RS_CAST(uint16_t *)(memory + row_bytes * 3);
+        scratch->linear[1] = scratch->linear[0] + (width + 2) * 4;
+        scratch->sums      = RS_CAST(uint16_t *)scratch->out + (width + 2) * 4;
+        scratch->sse41     = RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41;
+    }
+    return memory;
+}
+
+// NOTE: Pixels [x0, x1) of row y of a level from the level above. A level
+// above that is 1 pixel wide or high has its column or row counted twice.
+RS_FILE_SCOPE void RaylibSIMD__MipmapRow(RaylibSIMD__MipmapJob const *job, RaylibSIMD__MipmapScratch const *scratch, int level, int y, int x0, int x1)
+{
+    int const bpp        = job->bytes_per_pixel;
+    int const src_width  = job->widths[level - 1];
+    int const src_height = job->heights[level - 1];
+    int const pixels     = x1 - x0;
+    int const src_pixels = (src_width == 1) ? 1 : pixels * 2;
+    int const src_x      = (src_width == 1) ? 0 : x0 * 2;
+    unsigned char *dest  = job->levels[level] + (RS_CAST(size_t)y * job->widths[level] + x0) * bpp;
+
+    unsigned char const *src_rows[2] = {0};
+    for (int row = 0; row < 2; row++)
+        src_rows[row] = job->levels[level - 1] + (RS_CAST(size_t)RS_MIN(y * 2 + row, src_height - 1) * src_width + src_x) * bpp;
+
+    bool const is_float  = RaylibSIMD__IsFloatFormat(job->format);
+    int const work       = is_float ? UNCOMPRESSED_R32G32B32A32 : UNCOMPRESSED_R8G8B8A8;
+    int const work_bytes = is_float ? 16 : 4;
+    unsigned char const *rows[2] = {src_rows[0], src_rows[1]};
+    for (int row = 0; row < 2; row++)
+    {
+        if ((job->format == work) && (src_pixels == pixels * 2)) continue;
+        if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(src_rows[row], job->format, scratch->rows[row], work, src_pixels);
+        else                RaylibSIMD__ConvertPixels(src_rows[row], job->format, scratch->rows[row], work, src_pixels);
+        if (src_pixels == 1) memcpy(scratch->rows[row] + work_bytes, scratch->rows[row], work_bytes);
+        rows[row] = scratch->rows[row];
+    }
+
+    unsigned char *out = (job->format == work) ? dest : scratch->out;
+    if (is_float)
+    {
+        float const *row0 = RS_CAST(float const *)rows[0];
+        float const *row1 = RS_CAST(float const *)rows[1];
+        float *sums       = RS_CAST(float *)out;
+        for (int index = 0; index < pixels * 4; index++)
+        {
+            int const channel = index & 3, src = (index - channel) * 2 + channel;
+            sums[index]       = (row0[src] + row0[src + 4] + row1[src] + row1[src + 4]) * 0.25f;
+        }
+    }
+    else if (job->gamma)
+    {
+        RaylibSIMD__DecodeSRGB(rows[0], scratch->linear[0], pixels * 2);
+        RaylibSIMD__DecodeSRGB(rows[1], scratch->linear[1], pixels * 2);
+        if (scratch->sse41) RaylibSIMD__Downsample16_SSE41(scratch->linear[0], scratch->linear[1], scratch->sums, pixels);
+        else                RaylibSIMD__Downsample16(scratch->linear[0], scratch->linear[1], scratch->sums, pixels);
+        RaylibSIMD__EncodeSRGB(scratch->sums, out, pixels);
+    }
+    else
+    {
+        if (scratch->sse41) RaylibSIMD__Downsample8_SSE41(rows[0], rows[1], out, pixels);
+        else                RaylibSIMD__Downsample8(rows[0], rows[1], out, pixels);
+    }
+
+    if (out != dest)
+    {
+        if (scratch->sse41) RaylibSIMD__ConvertPixels_SSE41(out, work, dest, job->format, pixels);
+        else                RaylibSIMD__ConvertPixels(out, work, dest, job->format, pixels);
+    }
+}
+
+// NOTE: One band of RS_MIPMAP_BAND_ROWS base rows per task. Each row built
+// that completes a pair builds the row below it in the next level straight
+// away, so the band is read once while every level down to band_levels is
+// built from rows still in cache.
+RS_FILE_SCOPE void RaylibSIMD__MipmapBandTask(void *user_data, int task_index)
+{
+    RaylibSIMD__MipmapJob const *job   = RS_CAST(RaylibSIMD__MipmapJob const *)user_data;
+    RaylibSIMD__MipmapScratch scratch = {0};
+    void *memory                      = RaylibSIMD__MipmapScratchAlloc(&scratch, job->widths[0]);
+    if (!memory)
+    {
+        TRACELOG(LOG_WARNING, "Image mipmaps failed to allocate memory");
+        return;
+    }
+
+    int const y0 = task_index * RS_MIPMAP_BAND_ROWS / 2;
+    int const y1 = RS_MIN((task_index + 1) * RS_MIPMAP_BAND_ROWS / 2, job->heights[1]);
+    for (int y = y0; y < y1; y++)
+    {
+        RaylibSIMD__MipmapRow(job, &scratch, 1, y, 0, job->widths[1]);
+        for (int level = 1, row = y; (level < job->band_levels) && (row & 1) && ((row >> 1) < job->heights[level + 1]); level++)
+        {
+            row >>= 1;
+            RaylibSIMD__MipmapRow(job, &scratch, level + 1, row, 0, job->widths[level + 1]);
+        }
+    }
+
+    RaylibSIMD__ScratchFree(memory);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__MipmapRowsTask(void *user_data, int task_index)
+{
+    RaylibSIMD__MipmapJob const *job   = RS_CAST(RaylibSIMD__MipmapJob const *)user_data;
+    RaylibSIMD__MipmapScratch scratch = {0};
+    void *memory                      = RaylibSIMD__MipmapScratchAlloc(&scratch, job->widths[0]);
+    if (!memory)
+    {
+        TRACELOG(LOG_WARNING, "Image mipmaps failed to allocate memory");
+        return;
+    }
+
+    int const y0 = job->rect.y0 + task_index * job->rows_per_task;
+    int const y1 = RS_MIN(y0 + job->rows_per_task, job->rect.y1);
+    for (int y = y0; y < y1; y++) RaylibSIMD__MipmapRow(job, &scratch, job->level, y, job->rect.x0, job->rect.x1);
+
+    RaylibSIMD__ScratchFree(memory);
+}
+
+RS_FILE_SCOPE int RaylibSIMD__MipmapLevelCount(int width, int height)
+{
+    int result = 1;
+    while ((width != 1) || (height != 1))
+    {
+        width  = RS_MAX(width / 2, 1);
+        height = RS_MAX(height / 2, 1);
+        result++;
+    }
+    return result;
+}
+
+RS_FILE_SCOPE RaylibSIMD__MipmapJob RaylibSIMD__MakeMipmapJob(Image const *image, int level_count)
+{
+    RaylibSIMD__MipmapJob result = {0};
+    result.level_count           = RS_MIN(level_count, RS_MIPMAP_MAX_LEVELS);
+    result.format                = image->format;
+    result.bytes_per_pixel       = RaylibSIMD__FormatToBitsPerPixel(image->format) / 8;
+    result.gamma                 = (RaylibSIMD__mipmap_filter == RaylibSIMD_MipmapFilter_BoxGamma) && !RaylibSIMD__IsFloatFormat(image->format);
+    if (result.gamma) RaylibSIMD__InitSRGBTables();
+
+    unsigned char *data = RS_CAST(unsigned char *)image->data;
+    int width = image->width, height = image->height;
+    for (int level = 0; level < result.level_count; level++)
+    {
+        result.levels[level]  = data;
+        result.widths[level]  = width;
+        result.heights[level] = height;
+        data  += GetPixelDataSize(width, height, image->format);
+        width  = RS_MAX(width / 2, 1);
+        height = RS_MAX(height / 2, 1);
+    }
+    return result;
+}
+
+// NOTE: Builds the pixels [x0, x1) x [y0, y1) of a level on the worker pool
+RS_FILE_SCOPE void RaylibSIMD__MipmapLevel(RaylibSIMD__MipmapJob *job, int level, RaylibSIMD__Rect rect)
+{
+    job->level           = level;
+    job->rect            = rect;
+    job->rows_per_task   = RaylibSIMD__RowsPerTask(rect.x1 - rect.x0, rect.y1 - rect.y0);
+    int const task_count = (rect.y1 - rect.y0 + job->rows_per_task - 1) / job->rows_per_task;
+    RaylibSIMD__RunTasks(RaylibSIMD__MipmapRowsTask, job, task_count);
+}
+
+// NOTE: Rebuilds what's under rect of the base level in every mipmap level,
+// after something was drawn there
+RS_FILE_SCOPE void RaylibSIMD__UpdateMipmaps(Image const *image, RaylibSIMD__Rect rect)
+{
+    if (image->mipmaps <= 1) return;
+
+    RaylibSIMD__MipmapJob job = RaylibSIMD__MakeMipmapJob(image, image->mipmaps);
+    for (int level = 1; level < job.level_count; level++)
+    {
+        rect.x0 = rect.x0 / 2;
+        rect.y0 = rect.y0 / 2;
+        rect.x1 = RS_MIN((rect.x1 + 1) / 2, job.widths[level]);
+        rect.y1 = RS_MIN((rect.y1 + 1) / 2, job.heights[level]);
+        if ((rect.x1 <= rect.x0) || (rect.y1 <= rect.y0)) break;
+        RaylibSIMD__MipmapLevel(&job, level, rect);
+    }
+}
+
+// NOTE: BC1 (DXT1), BC2 (DXT3) and BC3 (DXT5) blocks of 4x4 pixels, made and
+// read by RaylibSIMD_ImageFormat through R8G8B8A8. Colors are encoded like
+// van Waveren's real-time DXT compressor: the ends of the block's bounding
+// box, taken along the diagonal that follows the colors (from the signs of
+// their covariances) and inset by 1/16 of the range, then each pixel gets the
+// nearest of the 4 colors from its projection on the line between them. The
+// ends are then refitted to those indices by least squares once, like
+// stb_dxt. Alpha gets the 8 value mode between its minimum and maximum.
+// Integer statistics and projections make the SSE4.1 kernels give the same
+// blocks as the scalar ones.
+typedef struct
+{
+    int min[3];
+    int max[3];
+    int sum[3];
+    int products[3]; // Sums of r * g, g * b and b * r
+    int count;
+} RaylibSIMD__ColorStats;
+
+RS_FILE_SCOPE bool RaylibSIMD__IsBlockFormat(int format)
+{
+    bool result = (format >= COMPRESSED_DXT1_RGB) && (format <= COMPRESSED_DXT5_RGBA);
+    return result;
+}
+
+RS_FILE_SCOPE int RaylibSIMD__BlockBytes(int format)
+{
+    int result = (format <= COMPRESSED_DXT1_RGBA) ? 8 : 16;
+    return result;
+}
+
+// NOTE: Bytes of a level, blocks cover partial blocks at the edges
+RS_FILE_SCOPE int RaylibSIMD__LevelDataSize(int width, int height, int format)
+{
+    int result = RaylibSIMD__IsBlockFormat(format) ? ((width + 3) / 4) * ((height + 3) / 4) * RaylibSIMD__BlockBytes(format)
+                                                   : GetPixelDataSize(width, height, format);
+    return result;
+}
+
+RS_FILE_SCOPE int RaylibSIMD__Pack565(int const *color)
+{
+    int const r = (RS_MIN(RS_MAX(color[0], 0), 255) * 31 + 127) / 255;
+    int const g = (RS_MIN(RS_MAX(color[1], 0), 255) * 63 + 127) / 255;
+    int const b = (RS_MIN(RS_MAX(color[2], 0), 255) * 31 + 127) / 255;
+    return (r << 11) | (g << 5) | b;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__Unpack565(int packed, int *color)
+{
+    int const r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+    color[0]    = (r << 3) | (r >> 2);
+    color[1]    = (g << 2) | (g >> 4);
+    color[2]    = (b << 3) | (b >> 2);
+}
+
+// NOTE: Statistics of the pixels whose bit is set in mask
+RS_FILE_SCOPE void RaylibSIMD__GetColorStats(unsigned char const *pixels, int mask, RaylibSIMD__ColorStats *stats)
+{
+    *stats = (RaylibSIMD__ColorStats){{255, 255, 255}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, 0};
+    for (int index = 0; index < 16; index++)
+    {
+        if (!(mask & (1 << index))) continue;
+        unsigned char const *pixel = pixels + index * 4;
+        for (int channel = 0; channel < 3; channel++)
+        {
+            stats->min[channel]       = RS_MIN(stats->min[channel], pixel[channel]);
+            stats->max[channel]       = RS_MAX(stats->max[channel], pixel[channel]);
+            stats->sum[channel]      += pixel[channel];
+            stats->products[channel] += pixel[channel] * pixel[(channel + 1) % 3];
+        }
+        stats->count++;
+    }
+}
 
-            result.r_bit_shift = 12;
-            result.g_bit_shift = 8;
-            result.b_bit_shift = 4;
-            result.a_bit_shift = 0;
+// NOTE: Every pixel of the block, products of each pixel with itself rotated
+// to g, b, r
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__GetColorStats_SSE41(unsigned char const *pixels, RaylibSIMD__ColorStats *stats)
+{
+    __m128i rows[4];
+    for (int row = 0; row < 4; row++) rows[row] = _mm_loadu_si128(RS_CAST(__m128i const *)(pixels + row * 16));
+
+    __m128i low  = _mm_min_epu8(_mm_min_epu8(rows[0], rows[1]), _mm_min_epu8(rows[2], rows[3]));
+    __m128i high = _mm_max_epu8(_mm_max_epu8(rows[0], rows[1]), _mm_max_epu8(rows[2], rows[3]));
+    low          = _mm_min_epu8(low, _mm_srli_si128(low, 8));
+    low          = _mm_min_epu8(low, _mm_srli_si128(low, 4));
+    high         = _mm_max_epu8(high, _mm_srli_si128(high, 8));
+    high         = _mm_max_epu8(high, _mm_srli_si128(high, 4));
+
+    __m128i sums     = _mm_setzero_si128();
+    __m128i products = _mm_setzero_si128();
+    for (int index = 0; index < 16; index++)
+    {
+        int pixel;
+        memcpy(&pixel, pixels + index * 4, 4);
+        __m128i const channels = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(pixel));
+        sums                   = _mm_add_epi32(sums, channels);
+        products               = _mm_add_epi32(products, _mm_mullo_epi32(channels, _mm_shuffle_epi32(channels, _MM_SHUFFLE(3, 0, 2, 1))));
+    }
+
+    int lows[4], highs[4], sum_values[4], product_values[4];
+    _mm_storeu_si128(RS_CAST(__m128i *)lows, _mm_cvtepu8_epi32(low));
+    _mm_storeu_si128(RS_CAST(__m128i *)highs, _mm_cvtepu8_epi32(high));
+    _mm_storeu_si128(RS_CAST(__m128i *)sum_values, sums);
+    _mm_storeu_si128(RS_CAST(__m128i *)product_values, products);
+    for (int channel = 0; channel < 3; channel++)
+    {
+        stats->min[channel]      = lows[channel];
+        stats->max[channel]      = highs[channel];
+        stats->sum[channel]      = sum_values[channel];
+        stats->products[channel] = product_values[channel];
+    }
+    stats->count = 16;
+}
+
+// NOTE: Inset corners of the bounding box, on the diagonal whose channels
+// grow with the channel of the largest range when they're positively
+// correlated with it
+RS_FILE_SCOPE void RaylibSIMD__ColorEndpoints(RaylibSIMD__ColorStats const *stats, int *color0, int *color1)
+{
+    int dominant = 0;
+    for (int channel = 1; channel < 3; channel++)
+        if (stats->max[channel] - stats->min[channel] > stats->max[dominant] - stats->min[dominant]) dominant = channel;
+
+    int high[3], low[3];
+    for (int channel = 0; channel < 3; channel++)
+    {
+        int const inset = (stats->max[channel] - stats->min[channel]) >> 4;
+        high[channel]   = stats->max[channel] - inset;
+        low[channel]    = stats->min[channel] + inset;
+        if (channel == dominant) continue;
+
+        int const product          = ((channel + 1) % 3 == dominant) ? stats->products[channel] : stats->products[dominant];
+        int64_t const covariance   = RS_CAST(int64_t)stats->count * product - RS_CAST(int64_t)stats->sum[channel] * stats->sum[dominant];
+        if (covariance < 0)
+        {
+            int const swap = high[channel];
+            high[channel]  = low[channel];
+            low[channel]   = swap;
+        }
+    }
+    *color0 = RaylibSIMD__Pack565(high);
+    *color1 = RaylibSIMD__Pack565(low);
+}
+
+// NOTE: Index of the color nearest to each pixel, from its projection on the
+// line from end0 to end1. Four color blocks switch colors at 1/6, 1/2 and 5/6
+// of the way, three color ones at 1/4 and 3/4 and pixels outside mask get the
+// transparent index 3.
+RS_FILE_SCOPE uint32_t RaylibSIMD__ColorIndices(unsigned char const *pixels, int const *end0, int const *end1, bool three_color, int mask)
+{
+    static unsigned char const four_color_indices[4]  = {0, 2, 3, 1};
+    static unsigned char const three_color_indices[3] = {0, 2, 1};
+
+    int const direction[3] = {end1[0] - end0[0], end1[1] - end0[1], end1[2] - end0[2]};
+    int const length       = direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2];
+    int const origin       = end0[0] * direction[0] + end0[1] * direction[1] + end0[2] * direction[2];
+    uint32_t result        = 0;
+    for (int index = 0; index < 16; index++)
+    {
+        unsigned char const *pixel = pixels + index * 4;
+        int const dot              = pixel[0] * direction[0] + pixel[1] * direction[1] + pixel[2] * direction[2] - origin;
+        uint32_t color_index       = 3;
+        if (!(mask & (1 << index))) color_index = 3;
+        else if (three_color)       color_index = three_color_indices[(4 * dot > length) + (4 * dot > 3 * length)];
+        else                        color_index = four_color_indices[(6 * dot > length) + (6 * dot > 3 * length) + (6 * dot > 5 * length)];
+        result |= color_index << (index * 2);
+    }
+    return result;
+}
+
+// NOTE: Four color blocks only. Dot products of 4 pixels at a time, then the
+// 2 bit indices gathered into 32 bits with multiply adds.
+RS_FILE_SCOPE RS_TARGET_SSE41 uint32_t RaylibSIMD__ColorIndices_SSE41(unsigned char const *pixels, int const *end0, int const *end1)
+{
+    int const direction[3]   = {end1[0] - end0[0], end1[1] - end0[1], end1[2] - end0[2]};
+    int const length         = direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2];
+    int const origin         = end0[0] * direction[0] + end0[1] * direction[1] + end0[2] * direction[2];
+    __m128i const weights    = _mm_setr_epi16(RS_CAST(short)direction[0], RS_CAST(short)direction[1], RS_CAST(short)direction[2], 0,
+                                              RS_CAST(short)direction[0], RS_CAST(short)direction[1], RS_CAST(short)direction[2], 0);
+    __m128i const origin_4x  = _mm_set1_epi32(origin);
+    __m128i const stop_1     = _mm_set1_epi32(length);
+    __m128i const stop_2     = _mm_set1_epi32(3 * length);
+    __m128i const stop_3     = _mm_set1_epi32(5 * length);
+
+    __m128i positions[4];
+    for (int row = 0; row < 4; row++)
+    {
+        __m128i const row_pixels = _mm_loadu_si128(RS_CAST(__m128i const *)(pixels + row * 16));
+        __m128i const low        = _mm_madd_epi16(_mm_cvtepu8_epi16(row_pixels), weights);
+        __m128i const high       = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(row_pixels, 8)), weights);
+        __m128i const dot        = _mm_sub_epi32(_mm_hadd_epi32(low, high), origin_4x);
+        __m128i const dot_6x     = _mm_add_epi32(_mm_slli_epi32(dot, 2), _mm_slli_epi32(dot, 1));
+        positions[row]           = _mm_sub_epi32(_mm_sub_epi32(_mm_setzero_si128(), _mm_cmpgt_epi32(dot_6x, stop_1)),
+                                                 _mm_add_epi32(_mm_cmpgt_epi32(dot_6x, stop_2), _mm_cmpgt_epi32(dot_6x, stop_3)));
+    }
+
+    __m128i const bytes   = _mm_packus_epi16(_mm_packs_epi32(positions[0], positions[1]), _mm_packs_epi32(positions[2], positions[3]));
+    __m128i const indices = _mm_shuffle_epi8(_mm_setr_epi8(0, 2, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), bytes);
+    __m128i const nibbles = _mm_maddubs_epi16(indices, _mm_set1_epi16(0x0401));
+    __m128i const octets  = _mm_madd_epi16(nibbles, _mm_set1_epi32(0x00100001));
+    return RS_CAST(uint32_t)_mm_cvtsi128_si32(_mm_shuffle_epi8(octets, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+}
+
+// NOTE: Least squares ends for the indices picked, each pixel being a = 3/3,
+// 0, 2/3 or 1/3 of color0 by index and b = 3 - a of color1. Sums over the 16
+// pixels of a, a * a and a times each channel, those of b follow from them.
+typedef struct
+{
+    int weights;
+    int squares;
+    int channels[3];
+} RaylibSIMD__RefineSums;
+
+RS_FILE_SCOPE void RaylibSIMD__GetRefineSums(unsigned char const *pixels, uint32_t indices, RaylibSIMD__RefineSums *sums)
+{
+    static int const weights[4] = {3, 0, 2, 1};
+    *sums = (RaylibSIMD__RefineSums){0};
+    for (int index = 0; index < 16; index++)
+    {
+        int const a           = weights[(indices >> (index * 2)) & 3];
+        sums->weights        += a;
+        sums->squares        += a * a;
+        sums->channels[0]    += a * pixels[index * 4 + 0];
+        sums->channels[1]    += a * pixels[index * 4 + 1];
+        sums->channels[2]    += a * pixels[index * 4 + 2];
+    }
+}
+
+// NOTE: The 2 bit indices spread to a byte per pixel, then weights times r
+// and b and times g and alpha with multiply adds
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__GetRefineSums_SSE41(unsigned char const *pixels, uint32_t indices, RaylibSIMD__RefineSums *sums)
+{
+    __m128i const packed  = _mm_shuffle_epi8(_mm_cvtsi32_si128(RS_CAST(int)indices), _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3));
+    __m128i const low     = _mm_setr_epi8(1, 4, 16, 64, 1, 4, 16, 64, 1, 4, 16, 64, 1, 4, 16, 64);
+    __m128i const high    = _mm_add_epi8(low, low);
+    __m128i const bit_0   = _mm_cmpeq_epi8(_mm_and_si128(packed, low), low);
+    __m128i const bit_1   = _mm_cmpeq_epi8(_mm_and_si128(packed, high), high);
+    __m128i const index   = _mm_sub_epi8(_mm_setzero_si128(), _mm_add_epi8(bit_0, _mm_add_epi8(bit_1, bit_1)));
+    __m128i const weights = _mm_shuffle_epi8(_mm_setr_epi8(3, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), index);
+    __m128i const squares = _mm_shuffle_epi8(_mm_setr_epi8(9, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), index);
+    __m128i const weight_sums = _mm_sad_epu8(weights, _mm_setzero_si128());
+    __m128i const square_sums = _mm_sad_epu8(squares, _mm_setzero_si128());
+
+    __m128i red_blue   = _mm_setzero_si128();
+    __m128i green      = _mm_setzero_si128();
+    for (int row = 0; row < 4; row++)
+    {
+        __m128i const row_pixels = _mm_loadu_si128(RS_CAST(__m128i const *)(pixels + row * 16));
+        char const first         = RS_CAST(char)(row * 4);
+        __m128i const even       = _mm_shuffle_epi8(weights, _mm_setr_epi8(first, -1, first, -1, first + 1, -1, first + 1, -1,
+                                                                           first + 2, -1, first + 2, -1, first + 3, -1, first + 3, -1));
+        __m128i const odd        = _mm_slli_si128(even, 1);
+        red_blue                 = _mm_add_epi16(red_blue, _mm_maddubs_epi16(row_pixels, even));
+        green                    = _mm_add_epi16(green, _mm_maddubs_epi16(row_pixels, odd));
+    }
+    red_blue = _mm_add_epi16(red_blue, _mm_srli_si128(red_blue, 8));
+    red_blue = _mm_add_epi16(red_blue, _mm_srli_si128(red_blue, 4));
+    green    = _mm_add_epi16(green, _mm_srli_si128(green, 8));
+    green    = _mm_add_epi16(green, _mm_srli_si128(green, 4));
+
+    sums->weights     = _mm_cvtsi128_si32(weight_sums) + _mm_extract_epi32(weight_sums, 2);
+    sums->squares     = _mm_cvtsi128_si32(square_sums) + _mm_extract_epi32(square_sums, 2);
+    sums->channels[0] = _mm_extract_epi16(red_blue, 0);
+    sums->channels[1] = _mm_extract_epi16(green, 0);
+    sums->channels[2] = _mm_extract_epi16(red_blue, 1);
+}
+
+// NOTE: Returns false when the ends didn't change
+RS_FILE_SCOPE bool RaylibSIMD__RefineEndpoints(RaylibSIMD__RefineSums const *sums, int const *pixel_sums, int *color0, int *color1)
+{
+    int const aa          = sums->squares;
+    int const bb          = 16 * 9 - 6 * sums->weights + sums->squares;
+    int const ab          = 3 * sums->weights - sums->squares;
+    int const determinant = aa * bb - ab * ab;
+    if (determinant == 0) return false;
+
+    float const scale = 3.0f / determinant;
+    int high[3], low[3];
+    for (int channel = 0; channel < 3; channel++)
+    {
+        int const ax  = sums->channels[channel];
+        int const bx  = 3 * pixel_sums[channel] - ax;
+        high[channel] = RS_CAST(int)floorf((ax * bb - bx * ab) * scale + 0.5f);
+        low[channel]  = RS_CAST(int)floorf((bx * aa - ax * ab) * scale + 0.5f);
+    }
+    int const refined0 = RaylibSIMD__Pack565(high);
+    int const refined1 = RaylibSIMD__Pack565(low);
+    bool const result  = (refined0 != *color0) || (refined1 != *color1);
+    *color0            = refined0;
+    *color1            = refined1;
+    return result;
+}
+
+// NOTE: DXT1 RGBA blocks with pixels under half alpha use the three color
+// mode, whose index 3 is transparent black
+RS_FILE_SCOPE void RaylibSIMD__EncodeColorBlock(unsigned char const *pixels, bool alpha, bool sse41, unsigned char *out)
+{
+    int mask = 0xFFFF;
+    if (alpha)
+    {
+        mask = 0;
+        for (int index = 0; index < 16; index++) if (pixels[index * 4 + 3] >= 128) mask |= 1 << index;
+    }
+
+    bool const three_color = (mask != 0xFFFF);
+    uint32_t transparent   = 0;
+    for (int index = 0; index < 16; index++) if (!(mask & (1 << index))) transparent |= 3u << (index * 2);
+
+    int color0 = 0, color1 = 0;
+    uint32_t indices = transparent;
+    if (mask)
+    {
+        RaylibSIMD__ColorStats stats = {0};
+        if (sse41 && !three_color) RaylibSIMD__GetColorStats_SSE41(pixels, &stats);
+        else                       RaylibSIMD__GetColorStats(pixels, mask, &stats);
+        RaylibSIMD__ColorEndpoints(&stats, &color0, &color1);
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            // NOTE: The order of the ends picks the mode, four colors when color0 > color1
+            if (three_color ? (color0 > color1) : (color0 < color1))
+            {
+                int const swap = color0;
+                color0         = color1;
+                color1         = swap;
+            }
+            if (color0 == color1)
+            {
+                indices = transparent;
+                break;
+            }
+
+            int end0[3], end1[3];
+            RaylibSIMD__Unpack565(color0, end0);
+            RaylibSIMD__Unpack565(color1, end1);
+            if (sse41 && !three_color) indices = RaylibSIMD__ColorIndices_SSE41(pixels, end0, end1);
+            else                       indices = RaylibSIMD__ColorIndices(pixels, end0, end1, three_color, mask);
+            if ((pass == 1) || three_color) break;
+
+            RaylibSIMD__RefineSums sums = {0};
+            if (sse41) RaylibSIMD__GetRefineSums_SSE41(pixels, indices, &sums);
+            else       RaylibSIMD__GetRefineSums(pixels, indices, &sums);
+            if (!RaylibSIMD__RefineEndpoints(&sums, stats.sum, &color0, &color1)) break;
+        }
+    }
+
+    uint16_t const ends[2] = {RS_CAST(uint16_t)color0, RS_CAST(uint16_t)color1};
+    memcpy(out, ends, 4);
+    memcpy(out + 4, &indices, 4);
+}
+
+// NOTE: DXT5 alpha, alpha0 the maximum and alpha1 the minimum so that the 6
+// values between them are used. Each pixel gets the nearest of the 8 steps of
+// 1/7 from the minimum, counted by comparing against the points halfway.
+RS_FILE_SCOPE void RaylibSIMD__EncodeAlphaBlock(unsigned char const *pixels, unsigned char *out)
+{
+    static unsigned char const alpha_indices[8] = {1, 7, 6, 5, 4, 3, 2, 0};
+    int low = 255, high = 0;
+    for (int index = 0; index < 16; index++)
+    {
+        low  = RS_MIN(low, pixels[index * 4 + 3]);
+        high = RS_MAX(high, pixels[index * 4 + 3]);
+    }
+
+    uint64_t bits = 0;
+    for (int index = 0; (index < 16) && (high > low); index++)
+    {
+        int const scaled = (pixels[index * 4 + 3] - low) * 14;
+        int position     = 0;
+        for (int step = 1; step < 8; step++) position += (scaled >= (2 * step - 1) * (high - low));
+        bits |= RS_CAST(uint64_t)alpha_indices[position] << (index * 3);
+    }
+    out[0] = RS_CAST(unsigned char)high;
+    out[1] = RS_CAST(unsigned char)low;
+    for (int byte = 0; byte < 6; byte++) out[2 + byte] = RS_CAST(unsigned char)(bits >> (byte * 8));
+}
+
+// NOTE: 3 bit indices gathered with multiply adds into 12 bits per 4 pixels
+RS_FILE_SCOPE RS_TARGET_SSE41 void RaylibSIMD__EncodeAlphaBlock_SSE41(unsigned char const *pixels, unsigned char *out)
+{
+    __m128i const gather = _mm_setr_epi8(3, 7, 11, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    __m128i const alphas = _mm_unpacklo_epi64(
+        _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)pixels), gather),
+                           _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(pixels + 16)), gather)),
+        _mm_unpacklo_epi32(_mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(pixels + 32)), gather),
+                           _mm_shuffle_epi8(_mm_loadu_si128(RS_CAST(__m128i const *)(pixels + 48)), gather)));
+
+    __m128i low  = _mm_min_epu8(alphas, _mm_srli_si128(alphas, 8));
+    __m128i high = _mm_max_epu8(alphas, _mm_srli_si128(alphas, 8));
+    low          = _mm_min_epu8(low, _mm_srli_si128(low, 4));
+    high         = _mm_max_epu8(high, _mm_srli_si128(high, 4));
+    low          = _mm_min_epu8(low, _mm_srli_si128(low, 2));
+    high         = _mm_max_epu8(high, _mm_srli_si128(high, 2));
+    low          = _mm_min_epu8(low, _mm_srli_si128(low, 1));
+    high         = _mm_max_epu8(high, _mm_srli_si128(high, 1));
+    int const low_value  = _mm_cvtsi128_si32(low) & 0xFF;
+    int const high_value = _mm_cvtsi128_si32(high) & 0xFF;
+    int const range      = high_value - low_value;
+
+    uint64_t bits = 0;
+    if (range > 0)
+    {
+        __m128i const low_x = _mm_set1_epi16(RS_CAST(short)low_value);
+        __m128i const scale = _mm_set1_epi16(14);
+        __m128i scaled[2]   = {_mm_mullo_epi16(_mm_sub_epi16(_mm_cvtepu8_epi16(alphas), low_x), scale),
+                               _mm_mullo_epi16(_mm_sub_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(alphas, 8)), low_x), scale)};
+        __m128i positions[2] = {_mm_setzero_si128(), _mm_setzero_si128()};
+        for (int step = 1; step < 8; step++)
+        {
+            __m128i const stop = _mm_set1_epi16(RS_CAST(short)((2 * step - 1) * range - 1));
+            positions[0]       = _mm_sub_epi16(positions[0], _mm_cmpgt_epi16(scaled[0], stop));
+            positions[1]       = _mm_sub_epi16(positions[1], _mm_cmpgt_epi16(scaled[1], stop));
+        }
+
+        __m128i const indices = _mm_shuffle_epi8(_mm_setr_epi8(1, 7, 6, 5, 4, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0), _mm_packus_epi16(positions[0], positions[1]));
+        __m128i const pairs   = _mm_maddubs_epi16(indices, _mm_set1_epi16(0x0801));
+        uint32_t quads[4];
+        _mm_storeu_si128(RS_CAST(__m128i *)quads, _mm_madd_epi16(pairs, _mm_set1_epi32(0x00400001)));
+        bits = quads[0] | (RS_CAST(uint64_t)quads[1] << 12) | (RS_CAST(uint64_t)quads[2] << 24) | (RS_CAST(uint64_t)quads[3] << 36);
+    }
+    out[0] = RS_CAST(unsigned char)high_value;
+    out[1] = RS_CAST(unsigned char)low_value;
+    for (int byte = 0; byte < 6; byte++) out[2 + byte] = RS_CAST(unsigned char)(bits >> (byte * 8));
+}
+
+// NOTE: DXT3 alpha, 4 bits per pixel
+RS_FILE_SCOPE void RaylibSIMD__EncodeAlpha4Block(unsigned char const *pixels, unsigned char *out)
+{
+    uint64_t bits = 0;
+    for (int index = 0; index < 16; index++) bits |= RS_CAST(uint64_t)((pixels[index * 4 + 3] * 15 + 127) / 255) << (index * 4);
+    memcpy(out, &bits, 8);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__EncodeBlock(unsigned char const *pixels, int format, bool sse41, unsigned char *out)
+{
+    switch (format)
+    {
+        case COMPRESSED_DXT1_RGB:  RaylibSIMD__EncodeColorBlock(pixels, false, sse41, out); break;
+        case COMPRESSED_DXT1_RGBA: RaylibSIMD__EncodeColorBlock(pixels, true, sse41, out);  break;
+        case COMPRESSED_DXT3_RGBA:
+        {
+            RaylibSIMD__EncodeAlpha4Block(pixels, out);
+            RaylibSIMD__EncodeColorBlock(pixels, false, sse41, out + 8);
+        } break;
+        case COMPRESSED_DXT5_RGBA:
+        {
+            if (sse41) RaylibSIMD__EncodeAlphaBlock_SSE41(pixels, out);
+            else       RaylibSIMD__EncodeAlphaBlock(pixels, out);
+            RaylibSIMD__EncodeColorBlock(pixels, false, sse41, out + 8);
+        } break;
+        default: break;
+    }
+}
+
+// NOTE: Color blocks of DXT3 and DXT5 always have four colors
+RS_FILE_SCOPE void RaylibSIMD__DecodeBlock(unsigned char const *block, int format, unsigned char *pixels)
+{
+    unsigned char const *color_block = block + ((format >= COMPRESSED_DXT3_RGBA) ? 8 : 0);
+    uint16_t ends[2];
+    uint32_t indices;
+    memcpy(ends, color_block, 4);
+    memcpy(&indices, color_block + 4, 4);
+
+    int colors[4][4] = {0};
+    RaylibSIMD__Unpack565(ends[0], colors[0]);
+    RaylibSIMD__Unpack565(ends[1], colors[1]);
+    colors[0][3] = colors[1][3] = colors[2][3] = colors[3][3] = 255;
+    for (int channel = 0; channel < 3; channel++)
+    {
+        if ((ends[0] > ends[1]) || (format >= COMPRESSED_DXT3_RGBA))
+        {
+            colors[2][channel] = (2 * colors[0][channel] + colors[1][channel]) / 3;
+            colors[3][channel] = (colors[0][channel] + 2 * colors[1][channel]) / 3;
+        }
+        else colors[2][channel] = (colors[0][channel] + colors[1][channel]) / 2;
+    }
+    if ((ends[0] <= ends[1]) && (format == COMPRESSED_DXT1_RGBA)) colors[3][3] = 0;
+
+    for (int index = 0; index < 16; index++)
+    {
+        int const *color = colors[(indices >> (index * 2)) & 3];
+        for (int channel = 0; channel < 4; channel++) pixels[index * 4 + channel] = RS_CAST(unsigned char)color[channel];
+    }
+
+    if (format == COMPRESSED_DXT3_RGBA)
+    {
+        uint64_t bits;
+        memcpy(&bits, block, 8);
+        for (int index = 0; index < 16; index++) pixels[index * 4 + 3] = RS_CAST(unsigned char)(((bits >> (index * 4)) & 15) * 17);
+    }
+    else if (format == COMPRESSED_DXT5_RGBA)
+    {
+        int const alpha0 = block[0], alpha1 = block[1];
+        int alphas[8]    = {alpha0, alpha1, 0, 0, 0, 0, 0, 255};
+        if (alpha0 > alpha1) for (int step = 2; step < 8; step++) alphas[step] = ((8 - step) * alpha0 + (step - 1) * alpha1) / 7;
+        else                 for (int step = 2; step < 6; step++) alphas[step] = ((6 - step) * alpha0 + (step - 1) * alpha1) / 5;
+
+        uint64_t bits = 0;
+        for (int byte = 0; byte < 6; byte++) bits |= RS_CAST(uint64_t)block[2 + byte] << (byte * 8);
+        for (int index = 0; index < 16; index++) pixels[index * 4 + 3] = RS_CAST(unsigned char)alphas[(bits >> (index * 3)) & 7];
+    }
+}
+
+// NOTE: One level of an image compressed or decompressed, tasks take rows of
+// blocks
+typedef struct
+{
+    unsigned char const *src;
+    int                  src_format;
+    unsigned char       *dest;
+    int                  dest_format;
+    int                  width;
+    int                  height;
+    int                  blocks_x;
+    int                  blocks_y;
+    int                  block_rows_per_task;
+} RaylibSIMD__BlockJob;
+
+// NOTE: Blocks past the right or bottom edge repeat the last column or row
+RS_FILE_SCOPE void RaylibSIMD__CompressTask(void *user_data, int task_index)
+{
+    RaylibSIMD__BlockJob const *job = RS_CAST(RaylibSIMD__BlockJob const *)user_data;
+    bool const sse41                = RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41;
+    int const src_bytes_per_pixel   = RaylibSIMD__FormatToBitsPerPixel(job->src_format) / 8;
+    int const block_bytes           = RaylibSIMD__BlockBytes(job->dest_format);
+    size_t const stride             = RS_ALIGN_UP(RS_CAST(size_t)job->width * 4);
+    unsigned char *strip            = RS_CAST(unsigned char *)RaylibSIMD__ScratchAlloc(stride * 4);
+    if (!strip)
+    {
+        TRACELOG(LOG_WARNING, "Image compression failed to allocate memory");
+        return;
+    }
+
+    int const block_y0 = task_index * job->block_rows_per_task;
+    int const block_y1 = RS_MIN(block_y0 + job->block_rows_per_task, job->blocks_y);
+    for (int block_y = block_y0; block_y < block_y1; block_y++)
+    {
+        unsigned char const *rows[4];
+        for (int row = 0; row < 4; row++)
+        {
+            int const y              = RS_MIN(block_y * 4 + row, job->height - 1);
+            unsigned char const *src = job->src + RS_CAST(size_t)y * job->width * src_bytes_per_pixel;
+            rows[row]                = src;
+            if (job->src_format == UNCOMPRESSED_R8G8B8A8) continue;
+
+            rows[row] = strip + row * stride;
+            if (sse41) RaylibSIMD__ConvertPixels_SSE41(src, job->src_format, strip + row * stride, UNCOMPRESSED_R8G8B8A8, job->width);
+            else       RaylibSIMD__ConvertPixels(src, job->src_format, strip + row * stride, UNCOMPRESSED_R8G8B8A8, job->width);
+        }
+
+        unsigned char *dest = job->dest + RS_CAST(size_t)block_y * job->blocks_x * block_bytes;
+        for (int block_x = 0; block_x < job->blocks_x; block_x++, dest += block_bytes)
+        {
+            unsigned char pixels[64];
+            int const x = block_x * 4;
+            for (int row = 0; row < 4; row++)
+            {
+                if (x + 4 <= job->width) memcpy(pixels + row * 16, rows[row] + x * 4, 16);
+                else for (int column = 0; column < 4; column++) memcpy(pixels + row * 16 + column * 4, rows[row] + RS_MIN(x + column, job->width - 1) * 4, 4);
+            }
+            RaylibSIMD__EncodeBlock(pixels, job->dest_format, sse41, dest);
+        }
+    }
+
+    RaylibSIMD__ScratchFree(strip);
+}
+
+RS_FILE_SCOPE void RaylibSIMD__DecompressTask(void *user_data, int task_index)
+{
+    RaylibSIMD__BlockJob const *job = RS_CAST(RaylibSIMD__BlockJob const *)user_data;
+    bool const sse41                = RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41;
+    int const dest_bytes_per_pixel  = RaylibSIMD__FormatToBitsPerPixel(job->dest_format) / 8;
+    int const block_bytes           = RaylibSIMD__BlockBytes(job->src_format);
+    size_t const stride             = RS_ALIGN_UP(RS_CAST(size_t)job->blocks_x * 4 * 4);
+    unsigned char *strip            = RS_CAST(unsigned char *)RaylibSIMD__ScratchAlloc(stride * 4);
+    if (!strip)
+    {
+        TRACELOG(LOG_WARNING, "Image decompression failed to allocate memory");
+        return;
+    }
+
+    int const block_y0 = task_index * job->block_rows_per_task;
+    int const block_y1 = RS_MIN(block_y0 + job->block_rows_per_task, job->blocks_y);
+    for (int block_y = block_y0; block_y < block_y1; block_y++)
+    {
+        unsigned char const *src = job->src + RS_CAST(size_t)block_y * job->blocks_x * block_bytes;
+        for (int block_x = 0; block_x < job->blocks_x; block_x++, src += block_bytes)
+        {
+            unsigned char pixels[64];
+            RaylibSIMD__DecodeBlock(src, job->src_format, pixels);
+            for (int row = 0; row < 4; row++) memcpy(strip + row * stride + block_x * 16, pixels + row * 16, 16);
+        }
+
+        for (int row = 0; row < RS_MIN(4, job->height - block_y * 4); row++)
+        {
+            unsigned char *dest = job->dest + RS_CAST(size_t)(block_y * 4 + row) * job->width * dest_bytes_per_pixel;
+            if (job->dest_format == UNCOMPRESSED_R8G8B8A8) memcpy(dest, strip + row * stride, RS_CAST(size_t)job->width * 4);
+            else if (sse41) RaylibSIMD__ConvertPixels_SSE41(strip + row * stride, UNCOMPRESSED_R8G8B8A8, dest, job->dest_format, job->width);
+            else            RaylibSIMD__ConvertPixels(strip + row * stride, UNCOMPRESSED_R8G8B8A8, dest, job->dest_format, job->width);
+        }
+    }
+
+    RaylibSIMD__ScratchFree(strip);
+}
+
+// NOTE: Compresses or decompresses every mipmap level. raylib sizes
+// compressed levels with GetPixelDataSize, which only counts whole blocks for
+// sizes that are multiples of 4 or under 4 both ways, so compressing stops at
+// the first level that isn't.
+RS_FILE_SCOPE void RaylibSIMD__ImageFormatBlocks(Image *image, int newFormat)
+{
+    bool const compress = RaylibSIMD__IsBlockFormat(newFormat);
+    int level_count     = 0;
+    size_t dest_size    = 0;
+    for (int level = 0, width = image->width, height = image->height; level < RS_MAX(image->mipmaps, 1); level++)
+    {
+        bool const whole_blocks = (((width % 4) == 0) && ((height % 4) == 0)) || ((width < 4) && (height < 4));
+        if (compress && !whole_blocks) break;
+        dest_size += RaylibSIMD__LevelDataSize(width, height, newFormat);
+        level_count++;
+        width  = RS_MAX(width / 2, 1);
+        height = RS_MAX(height / 2, 1);
+    }
+    if (level_count == 0)
+    {
+        TRACELOG(LOG_WARNING, "Image compression requires width and height to be multiples of 4");
+        return;
+    }
+
+    unsigned char *dest = RS_CAST(unsigned char *)RaylibSIMD__ImageAlloc(dest_size);
+    if (!dest)
+    {
+        TRACELOG(LOG_WARNING, "Image format conversion failed to allocate memory");
+        return;
+    }
+
+    RaylibSIMD__BlockJob job = {0};
+    job.src                  = RS_CAST(unsigned char const *)image->data;
+    job.src_format           = image->format;
+    job.dest                 = dest;
+    job.dest_format          = newFormat;
+    job.width                = image->width;
+    job.height               = image->height;
+    for (int level = 0; level < level_count; level++)
+    {
+        job.blocks_x            = (job.width + 3) / 4;
+        job.blocks_y            = (job.height + 3) / 4;
+        job.block_rows_per_task = (RaylibSIMD__RowsPerTask(job.width, job.blocks_y * 4) + 3) / 4;
+        RaylibSIMD__RunTasks(compress ? RaylibSIMD__CompressTask : RaylibSIMD__DecompressTask, &job,
+                             (job.blocks_y + job.block_rows_per_task - 1) / job.block_rows_per_task);
+
+        job.src   += RaylibSIMD__LevelDataSize(job.width, job.height, job.src_format);
+        job.dest  += RaylibSIMD__LevelDataSize(job.width, job.height, job.dest_format);
+        job.width  = RS_MAX(job.width / 2, 1);
+        job.height = RS_MAX(job.height / 2, 1);
+    }
+
+    RL_FREE(image->data);
+    image->data    = dest;
+    image->format  = newFormat;
+    image->mipmaps = level_count;
+}
+
+// NOTE: Draws, fills and color adjustments on the image passed to
+// RaylibSIMD_BeginBatch are recorded instead of run. A flush bins every
+// command into the tiles it touches then runs tile by tile, each tile's
+// commands in recording order, so a tile is loaded into cache once per flush
+// rather than once per command.
+//
+// Recorded draws keep pointers to the source pixels, which must stay valid
+// until the batch is flushed.
+#define RS_BATCH_TILE_WIDTH  256
+#define RS_BATCH_TILE_HEIGHT 64 // 64KiB of R8G8B8A8 pixels, stays in L2
+
+typedef enum
+{
+    RaylibSIMD__BatchCommandType_Draw,
+    RaylibSIMD__BatchCommandType_Fill,
+    RaylibSIMD__BatchCommandType_Shape,
+    RaylibSIMD__BatchCommandType_Filter,
+} RaylibSIMD__BatchCommandType;
+
+typedef struct
+{
+    RaylibSIMD__BatchCommandType type;
+    union
+    {
+        RaylibSIMD__DrawJob   draw;
+        RaylibSIMD__FillJob   fill;
+        RaylibSIMD__ShapeJob  shape;
+        RaylibSIMD__FilterJob filter;
+    } job;
+} RaylibSIMD__BatchCommand;
+
+typedef struct
+{
+    Image const              *dst;          // NULL when not recording
+    RaylibSIMD__BatchCommand *commands;
+    int                       command_count;
+    int                       command_capacity;
+    int                      *tile_offsets; // Commands of tile t are tile_commands[tile_offsets[t], tile_offsets[t + 1])
+    int                       tile_offsets_capacity;
+    int                      *tile_commands;
+    int                       tile_commands_capacity;
+    int                       tiles_x;
+    int                       tiles_y;
+    RaylibSIMD__ColorTable   *color_tables; // Lookups of the recorded color adjustments
+    int                       color_table_count;
+    int                       color_table_capacity;
+} RaylibSIMD__Batch;
+
+RS_FILE_SCOPE RaylibSIMD__Batch RaylibSIMD__batch;
+
+RS_FILE_SCOPE bool RaylibSIMD__BatchRecording(Image const *dst)
+{
+    bool result = (RaylibSIMD__batch.dst != NULL) && (RaylibSIMD__batch.dst == dst);
+    return result;
+}
+
+RS_FILE_SCOPE RaylibSIMD__BatchCommand *RaylibSIMD__BatchPush(RaylibSIMD__BatchCommandType type)
+{
+    RaylibSIMD__Batch *batch = &RaylibSIMD__batch;
+    if (batch->command_count == batch->command_capacity)
+    {
+        int const capacity                 = RS_MAX(batch->command_capacity * 2, 256);
+        RaylibSIMD__BatchCommand *commands = RS_CAST(RaylibSIMD__BatchCommand *)RL_REALLOC(batch->commands, capacity * sizeof(*commands));
+        if (!commands)
+        {
+            TRACELOG(LOG_WARNING, "Failed to grow RaylibSIMD batch, command dropped");
+            return NULL;
+        }
+        batch->commands         = commands;
+        batch->command_capacity = capacity;
+    }
+
+    RaylibSIMD__BatchCommand *result = batch->commands + batch->command_count++;
+    result->type                     = type;
+    return result;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BatchPushDraw(RaylibSIMD__DrawJob const *job)
+{
+    RaylibSIMD__BatchCommand *command = RaylibSIMD__BatchPush(RaylibSIMD__BatchCommandType_Draw);
+    if (command) command->job.draw = *job;
+}
+
+RS_FILE_SCOPE void RaylibSIMD__BatchPushFill(RaylibSIMD__FillJob const *job)
+{
+    RaylibSIMD__BatchCommand *command = RaylibSIMD__BatchPush(RaylibSIMD__BatchCommandType_Fill);
+    if (command) command->job.fill = *job;
+}
 
-            result.r_to_01_coefficient = 1.f/15.f;
-            result.g_to_01_coefficient = 1.f/15.f;
-            result.b_to_01_coefficient = 1.f/15.f;
-            result.a_to_01_coefficient = 1.f/15.f;
-        }
-        break;
+RS_FILE_SCOPE void RaylibSIMD__BatchPushShape(RaylibSIMD__ShapeJob const *job)
+{
+    RaylibSIMD__BatchCommand *command = RaylibSIMD__BatchPush(RaylibSIMD__BatchCommandType_Shape);
+    if (command) command->job.shape = *job;
+}
 
-        // NOTE: RGB565 16bit Pixel
-        // Bits       | 15 14 13 12 11 | 10 98765 | 43210
-        // Color Bits |  R  R  R  R  R | G  GGGGG | BBBBB
-        //
-        // A 128bit SIMD register with 4x32bit lanes can store
-        // 2 pixels per register.
-        //
-        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
-        //
-        // See UNCOMPRESSED_R8G8B8 for reason for shuffle.
-        // Desired layout 1 pixel per 32 bit lane
-        //
-        // Register        | {[P1]   [P2]    [P3]    [P4]}
-        // Bits            |  [0:15] [16:31] [32:46] [46:61]
-        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
-        case UNCOMPRESSED_R5G6B5:
+// NOTE: Adjustments recorded right after another one on the same image are
+// appended to it, so that a chain of them runs as one pass over each tile.
+// Their lookups live in the batch, and jobs point at them once it's flushed.
+RS_FILE_SCOPE void RaylibSIMD__BatchPushFilter(RaylibSIMD__FilterJob const *job, RaylibSIMD__ColorFilter filter)
+{
+    RaylibSIMD__Batch *batch = &RaylibSIMD__batch;
+    if (batch->color_table_count == batch->color_table_capacity)
+    {
+        int const capacity             = RS_MAX(batch->color_table_capacity * 2, 16);
+        RaylibSIMD__ColorTable *tables = RS_CAST(RaylibSIMD__ColorTable *)RL_REALLOC(batch->color_tables, capacity * sizeof(*tables));
+        if (!tables)
         {
-            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
-                                           2, 3, 2, 3,
-                                           4, 5, 4, 5,
-                                           6, 7, 6, 7);
-            result.r_bit_mask = 0b011111;
-            result.g_bit_mask = 0b111111;
-            result.b_bit_mask = 0b011111;
+            TRACELOG(LOG_WARNING, "Failed to grow RaylibSIMD batch, command dropped");
+            return;
+        }
+        batch->color_tables         = tables;
+        batch->color_table_capacity = capacity;
+    }
 
-            result.r_bit_shift = 11;
-            result.g_bit_shift = 5;
-            result.b_bit_shift = 0;
+    RaylibSIMD__BatchCommand *last = batch->command_count ? batch->commands + batch->command_count - 1 : NULL;
+    if (last && (last->type == RaylibSIMD__BatchCommandType_Filter) &&
+        RaylibSIMD__FilterJobAppend(&last->job.filter, batch->color_tables, &batch->color_table_count, filter)) return;
 
-            result.r_to_01_coefficient = 1.f/31.f;
-            result.g_to_01_coefficient = 1.f/63.f;
-            result.b_to_01_coefficient = 1.f/31.f;
+    RaylibSIMD__BatchCommand *command = RaylibSIMD__BatchPush(RaylibSIMD__BatchCommandType_Filter);
+    if (command)
+    {
+        command->job.filter = *job;
+        RaylibSIMD__FilterJobAppend(&command->job.filter, batch->color_tables, &batch->color_table_count, filter);
+    }
+}
+
+RS_FILE_SCOPE RaylibSIMD__Rect RaylibSIMD__BatchCommandClip(RaylibSIMD__BatchCommand const *command)
+{
+    RaylibSIMD__Rect result = {0};
+    switch (command->type)
+    {
+        case RaylibSIMD__BatchCommandType_Draw:   result = command->job.draw.clip;       break;
+        case RaylibSIMD__BatchCommandType_Fill:   result = command->job.fill.clip;       break;
+        case RaylibSIMD__BatchCommandType_Shape:  result = command->job.shape.fill.clip; break;
+        case RaylibSIMD__BatchCommandType_Filter: result = command->job.filter.clip;     break;
+    }
+    return result;
+}
+
+// NOTE: Tiles covered by a clip rectangle, as [x0, x1) x [y0, y1) tile indices
+RS_FILE_SCOPE RaylibSIMD__Rect RaylibSIMD__BatchTileRange(RaylibSIMD__Rect clip)
+{
+    RaylibSIMD__Rect result = {0};
+    result.x0               = clip.x0 / RS_BATCH_TILE_WIDTH;
+    result.y0               = clip.y0 / RS_BATCH_TILE_HEIGHT;
+    result.x1               = (clip.x1 + RS_BATCH_TILE_WIDTH - 1) / RS_BATCH_TILE_WIDTH;
+    result.y1               = (clip.y1 + RS_BATCH_TILE_HEIGHT - 1) / RS_BATCH_TILE_HEIGHT;
+    return result;
+}
+
+// NOTE: One task per row of tiles
+RS_FILE_SCOPE void RaylibSIMD__BatchTask(void *user_data, int task_index)
+{
+    RaylibSIMD__Batch const *batch = RS_CAST(RaylibSIMD__Batch const *)user_data;
+    int const tile_y               = task_index;
+    for (int tile_x = 0; tile_x < batch->tiles_x; tile_x++)
+    {
+        int const tile          = tile_y * batch->tiles_x + tile_x;
+        RaylibSIMD__Rect bounds = {0};
+        bounds.x0               = tile_x * RS_BATCH_TILE_WIDTH;
+        bounds.y0               = tile_y * RS_BATCH_TILE_HEIGHT;
+        bounds.x1               = bounds.x0 + RS_BATCH_TILE_WIDTH;
+        bounds.y1               = bounds.y0 + RS_BATCH_TILE_HEIGHT;
+
+        for (int index = batch->tile_offsets[tile]; index < batch->tile_offsets[tile + 1]; index++)
+        {
+            RaylibSIMD__BatchCommand const *command = batch->commands + batch->tile_commands[index];
+            RaylibSIMD__Rect const rect             = RaylibSIMD__RectIntersection(RaylibSIMD__BatchCommandClip(command), bounds);
+            switch (command->type)
+            {
+                case RaylibSIMD__BatchCommandType_Draw:   RaylibSIMD__DrawRect(&command->job.draw, rect);     break;
+                case RaylibSIMD__BatchCommandType_Fill:   RaylibSIMD__FillRect(&command->job.fill, rect);     break;
+                case RaylibSIMD__BatchCommandType_Shape:  RaylibSIMD__ShapeRect(&command->job.shape, rect);   break;
+                case RaylibSIMD__BatchCommandType_Filter: RaylibSIMD__FilterRect(&command->job.filter, rect); break;
+            }
         }
-        break;
+    }
+}
 
-        // NOTE: RGBA5551 16bit Pixel
-        // Bits       | 15 14 13 12 11 | 10 9876 | 54321 | 0
-        // Color Bits |  R  R  R  R  R | G  GGGG | BBBBB | A
-        //
-        // A 128bit SIMD register with 4x32bit lanes can store
-        // 2 pixels per register.
-        //
-        // Register   | {[P1, P2] [P3, P4] [P5, P6] [P7, P8]}
-        //
-        // See UNCOMPRESSED_R8G8B8 for reason for shuffle.
-        // Desired layout 1 pixel per 32 bit lane
-        //
-        // Register        | {[P1]   [P2]    [P3]    [P4]}
-        // Bits            |  [0:15] [16:31] [32:46] [46:61]
-        // Bytes (Shuffle) |  [0:1]  [2:3]   [4:5]   [6:7]
-        case UNCOMPRESSED_R5G5B5A1:
+void RaylibSIMD_BeginBatch(Image *dst)
+{
+    if (RaylibSIMD__batch.dst) RaylibSIMD_EndBatch();
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+    RaylibSIMD__batch.dst = dst;
+}
+
+// NOTE: A failed allocation leaves the tile array it was for NULL, which the
+// capacity reset makes the next flush allocate again.
+RS_FILE_SCOPE void RaylibSIMD__BatchDropCommands(void)
+{
+    RaylibSIMD__Batch *batch = &RaylibSIMD__batch;
+    TRACELOG(LOG_WARNING, "Failed to allocate RaylibSIMD batch tiles, commands dropped");
+    if (!batch->tile_offsets)  batch->tile_offsets_capacity  = 0;
+    if (!batch->tile_commands) batch->tile_commands_capacity = 0;
+    batch->command_count     = 0;
+    batch->color_table_count = 0;
+}
+
+void RaylibSIMD_FlushBatch(void)
+{
+    RaylibSIMD__Batch *batch = &RaylibSIMD__batch;
+    if (!batch->dst || batch->command_count == 0) return;
+
+    batch->tiles_x       = (batch->dst->width + RS_BATCH_TILE_WIDTH - 1) / RS_BATCH_TILE_WIDTH;
+    batch->tiles_y       = (batch->dst->height + RS_BATCH_TILE_HEIGHT - 1) / RS_BATCH_TILE_HEIGHT;
+    int const tile_count = batch->tiles_x * batch->tiles_y;
+
+    // NOTE: Count the commands in each tile, so tile_offsets[t + 1] holds the
+    // count of tile t, then prefix sum into offsets.
+    if (tile_count + 1 > batch->tile_offsets_capacity)
+    {
+        RL_FREE(batch->tile_offsets);
+        batch->tile_offsets_capacity = tile_count + 1;
+        batch->tile_offsets          = RS_CAST(int *)RL_MALLOC(batch->tile_offsets_capacity * sizeof(int));
+        if (!batch->tile_offsets)
         {
-            result.shuffle = _mm_setr_epi8(0, 1, 0, 1, // Lane 1
-                                           2, 3, 2, 3,
-                                           4, 5, 4, 5,
-                                           6, 7, 6, 7);
-            result.r_bit_mask = 0b11111;
-            result.g_bit_mask = 0b11111;
-            result.b_bit_mask = 0b11111;
-            result.a_bit_mask = 0b00001;
+            RaylibSIMD__BatchDropCommands();
+            return;
+        }
+    }
+    memset(batch->tile_offsets, 0, (tile_count + 1) * sizeof(int));
 
-            result.r_bit_shift = 11;
-            result.g_bit_shift = 6;
-            result.b_bit_shift = 1;
-            result.a_bit_shift = 0;
+    RaylibSIMD__Rect changed = {batch->dst->width, batch->dst->height, 0, 0};
+    for (int index = 0; index < batch->command_count; index++)
+    {
+        if (batch->commands[index].type == RaylibSIMD__BatchCommandType_Filter) batch->commands[index].job.filter.tables = batch->color_tables;
 
-            result.r_to_01_coefficient = 1.f/31.f;
-            result.g_to_01_coefficient = 1.f/31.f;
-            result.b_to_01_coefficient = 1.f/31.f;
-            result.a_to_01_coefficient = 1.f;
+        RaylibSIMD__Rect const clip  = RaylibSIMD__BatchCommandClip(batch->commands + index);
+        RaylibSIMD__Rect const tiles = RaylibSIMD__BatchTileRange(clip);
+        changed.x0                   = RS_MIN(changed.x0, clip.x0);
+        changed.y0                   = RS_MIN(changed.y0, clip.y0);
+        changed.x1                   = RS_MAX(changed.x1, clip.x1);
+        changed.y1                   = RS_MAX(changed.y1, clip.y1);
+        for (int tile_y = tiles.y0; tile_y < tiles.y1; tile_y++)
+            for (int tile_x = tiles.x0; tile_x < tiles.x1; tile_x++)
+                batch->tile_offsets[tile_y * batch->tiles_x + tile_x + 1]++;
+    }
+
+    for (int tile = 0; tile < tile_count; tile++)
+        batch->tile_offsets[tile + 1] += batch->tile_offsets[tile];
+
+    int const binned_commands = batch->tile_offsets[tile_count];
+    if (binned_commands > batch->tile_commands_capacity)
+    {
+        RL_FREE(batch->tile_commands);
+        batch->tile_commands_capacity = binned_commands;
+        batch->tile_commands          = RS_CAST(int *)RL_MALLOC(batch->tile_commands_capacity * sizeof(int));
+        if (!batch->tile_commands)
+        {
+            RaylibSIMD__BatchDropCommands();
+            return;
         }
-        break;
     }
 
-    return result;
+    // NOTE: Fill each tile in recording order, advancing its offset to the
+    // start of the next tile, then shift the offsets back.
+    for (int index = 0; index < batch->command_count; index++)
+    {
+        RaylibSIMD__Rect const tiles = RaylibSIMD__BatchTileRange(RaylibSIMD__BatchCommandClip(batch->commands + index));
+        for (int tile_y = tiles.y0; tile_y < tiles.y1; tile_y++)
+            for (int tile_x = tiles.x0; tile_x < tiles.x1; tile_x++)
+                batch->tile_commands[batch->tile_offsets[tile_y * batch->tiles_x + tile_x]++] = index;
+    }
+
+    for (int tile = tile_count; tile > 0; tile--)
+        batch->tile_offsets[tile] = batch->tile_offsets[tile - 1];
+    batch->tile_offsets[0] = 0;
+
+    RaylibSIMD__RunTasks(RaylibSIMD__BatchTask, batch, batch->tiles_y);
+    RaylibSIMD__UpdateMipmaps(batch->dst, changed);
+    batch->command_count     = 0;
+    batch->color_table_count = 0;
 }
 
-typedef enum
+void RaylibSIMD_EndBatch(void)
 {
-    RaylibSIMD_ImageDrawMode_Original,
-    RaylibSIMD_ImageDrawMode_Flattened,
-    RaylibSIMD_ImageDrawMode_SIMD,
-} RaylibSIMD_ImageDrawMode;
+    RaylibSIMD__Batch *batch = &RaylibSIMD__batch;
+    RaylibSIMD_FlushBatch();
+    RL_FREE(batch->commands);
+    RL_FREE(batch->tile_offsets);
+    RL_FREE(batch->tile_commands);
+    RL_FREE(batch->color_tables);
+    *batch = (RaylibSIMD__Batch){0};
+}
 
-void RaylibSIMD_ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+void RaylibSIMD_ImageDrawEx(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint, RaylibSIMD_BlendMode blendMode)
 {
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
-    if (dst->mipmaps > 1)
-    {
-        TRACELOG(LOG_WARNING, "Image drawing only applied to base mipmap level");
-    }
     if (dst->format >= COMPRESSED_DXT1_RGB)
     {
         TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
     }
+    else if ((blendMode != RaylibSIMD_BlendMode_Alpha) &&
+             ((src.format != UNCOMPRESSED_R8G8B8A8) || (dst->format != UNCOMPRESSED_R8G8B8A8)))
+    {
+        TRACELOG(LOG_WARNING, "Image drawing blend modes other than alpha only supported for R8G8B8A8 images");
+    }
     else
     {
-        Image srcMod = { 0 };       // Source copy (in case it was required)
-        Image *srcPtr = &src;       // Pointer to source image
-        bool useSrcMod = false;     // Track source copy required
-
         // Source rectangle out-of-bounds security checks
         if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
         if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
         if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
         if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+        if (((int)srcRec.width <= 0) || ((int)srcRec.height <= 0)) return;
 
-        // Check if source rectangle needs to be resized to destination rectangle
-        // In that case, we make a copy of source and we apply all required transform
-        if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
-        {
-            srcMod = ImageFromImage(src, srcRec);   // Create image from another image
-            ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (Rectangle){ 0.f, 0.f, (float)srcMod.width, (float)srcMod.height };
-
-            srcPtr = &srcMod;
-            useSrcMod = true;
-        }
+        // NOTE: When the source rectangle size differs from the destination
+        // rectangle the source is stretched over it, sampled span by span
+        // inside the blend loop (see RaylibSIMD__Sampler).
+        bool const scaled     = ((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height);
+        int const draw_x      = (int)dstRec.x;
+        int const draw_y      = (int)dstRec.y;
+        int const draw_width  = scaled ? (int)dstRec.width  : (int)srcRec.width;
+        int const draw_height = scaled ? (int)dstRec.height : (int)srcRec.height;
 
         // Destination rectangle out-of-bounds security checks
-        if (dstRec.x < 0)
-        {
-            srcRec.x = -dstRec.x;
-            srcRec.width += dstRec.x;
-            dstRec.x = 0;
-        }
-        else if ((dstRec.x + srcRec.width) > dst->width) srcRec.width = dst->width - dstRec.x;
-
-        if (dstRec.y < 0)
-        {
-            srcRec.y = -dstRec.y;
-            srcRec.height += dstRec.y;
-            dstRec.y = 0;
-        }
-        else if ((dstRec.y + srcRec.height) > dst->height) srcRec.height = dst->height - dstRec.y;
-
-        if (dst->width < srcRec.width) srcRec.width = (float)dst->width;
-        if (dst->height < srcRec.height) srcRec.height = (float)dst->height;
+        int const clip_x0 = RS_MAX(draw_x, 0);
+        int const clip_y0 = RS_MAX(draw_y, 0);
+        int const clip_x1 = RS_MIN(draw_x + draw_width, dst->width);
+        int const clip_y1 = RS_MIN(draw_y + draw_height, dst->height);
+        if ((clip_x1 <= clip_x0) || (clip_y1 <= clip_y0)) return;
 
         // This blitting method is quite fast! The process followed is:
         // for every pixel -> [get_src_format/get_dst_format -> blend -> format_to_dst]
@@ -393,329 +6879,393 @@ void RaylibSIMD_ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dst
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
         //    [-] GetPixelColor(): Return Vector4 instead of Color, easier for ColorAlphaBlend()
+        //    [x] Sample the source inside the blend loop instead of resizing a copy
+
+        // NOTE: Bilinear sampling produces R8G8B8A8, float sources are sampled
+        // with nearest instead so HDR colors aren't quantized.
+        bool const src_float                = (src.format >= UNCOMPRESSED_R32) && (src.format <= UNCOMPRESSED_R32G32B32A32);
+        RaylibSIMD_ScaleFilter const filter = src_float ? RaylibSIMD_ScaleFilter_Nearest : RaylibSIMD__scale_filter;
+        int const span_format               = (scaled && filter == RaylibSIMD_ScaleFilter_Bilinear) ? UNCOMPRESSED_R8G8B8A8 : src.format;
+
+        RaylibSIMD__DrawJob job = {0};
+        job.state               = RaylibSIMD__MakeDrawState(span_format, dst->format, tint, blendMode);
+        job.clip                = (RaylibSIMD__Rect){clip_x0, clip_y0, clip_x1, clip_y1};
+        job.scaled              = scaled;
+        job.src_data            = (unsigned char const *)src.data;
+        job.src_stride          = GetPixelDataSize(src.width, 1, src.format);
+        job.src_x               = (int)srcRec.x;
+        job.src_y               = (int)srcRec.y;
+        job.dest_data           = (unsigned char *)dst->data;
+        job.dest_stride         = GetPixelDataSize(dst->width, 1, dst->format);
+        job.draw_x              = draw_x;
+        job.draw_y              = draw_y;
+        if (scaled) job.sampler = RaylibSIMD__MakeSampler(&src, srcRec, draw_width, draw_height, filter);
+
+        if (RaylibSIMD__BatchRecording(dst)) RaylibSIMD__BatchPushDraw(&job);
+        else
+        {
+            job.rows_per_task    = RaylibSIMD__RowsPerTask(clip_x1 - clip_x0, clip_y1 - clip_y0);
+            int const task_count = (clip_y1 - clip_y0 + job.rows_per_task - 1) / job.rows_per_task;
+            RaylibSIMD__RunTasks(RaylibSIMD__DrawTask, &job, task_count);
+            RaylibSIMD__UpdateMipmaps(dst, job.clip);
+        }
+    }
+}
+
+void RaylibSIMD_ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color tint)
+{
+    RaylibSIMD_ImageDrawEx(dst, src, srcRec, dstRec, tint, RaylibSIMD_BlendMode_Alpha);
+}
+
+// NOTE: Same parameters as raylib's DrawTexturePro. The source rectangle is
+// stretched over dstRec, rotated by rotation degrees (clockwise on screen)
+// around origin, which is relative to dstRec's top left and drawn at
+// (dstRec.x, dstRec.y). A negative source width or height flips the sprite.
+void RaylibSIMD_ImageDrawPro(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Vector2 origin, float rotation, Color tint)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
+
+    if ((dst->format >= COMPRESSED_DXT1_RGB) || (src.format >= COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+        return;
+    }
+
+    bool const flip_x = (srcRec.width < 0);
+    bool const flip_y = (srcRec.height < 0);
+    if (flip_x) srcRec.width = -srcRec.width;
+    if (flip_y) srcRec.height = -srcRec.height;
+
+    // Source rectangle out-of-bounds security checks
+    if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+    if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+    if ((srcRec.x + srcRec.width) > src.width) srcRec.width = src.width - srcRec.x;
+    if ((srcRec.y + srcRec.height) > src.height) srcRec.height = src.height - srcRec.y;
+    if (((int)srcRec.width <= 0) || ((int)srcRec.height <= 0) || (dstRec.width <= 0) || (dstRec.height <= 0)) return;
+
+    // NOTE: Destination point p maps to the sprite point
+    // q = origin + R(-rotation) * (p - (dstRec.x, dstRec.y)), scaled to the
+    // source rectangle. Evaluated at pixel centers in double, then stepped in
+    // 16.16 fixed point per pixel and per row.
+    double const radians  = rotation * (3.14159265358979323846 / 180.0);
+    double const cosine   = cos(radians);
+    double const sine     = sin(radians);
+    int const src_width   = (int)srcRec.width;
+    int const src_height  = (int)srcRec.height;
+    double const scale_u  = src_width / dstRec.width;
+    double const scale_v  = src_height / dstRec.height;
+    double const offset_x = 0.5 - dstRec.x;
+    double const offset_y = 0.5 - dstRec.y;
+
+    double u       = (origin.x + cosine * offset_x + sine * offset_y) * scale_u;
+    double v       = (origin.y - sine * offset_x + cosine * offset_y) * scale_v;
+    double u_x     = cosine * scale_u, u_y = sine * scale_u;
+    double v_x     = -sine * scale_v,  v_y = cosine * scale_v;
+    if (flip_x) { u = src_width - u;  u_x = -u_x; u_y = -u_y; }
+    if (flip_y) { v = src_height - v; v_x = -v_x; v_y = -v_y; }
+
+    // NOTE: Bounding box of the rotated rectangle, RaylibSIMD__AffineSpan
+    // decides which of its pixels are covered.
+    float min_x = (float)dst->width, min_y = (float)dst->height, max_x = 0, max_y = 0;
+    for (int corner = 0; corner < 4; corner++)
+    {
+        double const corner_x = ((corner & 1) ? dstRec.width : 0) - origin.x;
+        double const corner_y = ((corner & 2) ? dstRec.height : 0) - origin.y;
+        float const x         = (float)(dstRec.x + cosine * corner_x - sine * corner_y);
+        float const y         = (float)(dstRec.y + sine * corner_x + cosine * corner_y);
+        min_x = RS_MIN(min_x, x); max_x = RS_MAX(max_x, x);
+        min_y = RS_MIN(min_y, y); max_y = RS_MAX(max_y, y);
+    }
 
-        bool blendRequired = true;
-        
-        // Fast path: Avoid blend if source has no alpha to blend
-        if ((tint.a == 255) && ((srcPtr->format == UNCOMPRESSED_GRAYSCALE) || (srcPtr->format == UNCOMPRESSED_R8G8B8) || (srcPtr->format == UNCOMPRESSED_R5G6B5))) blendRequired = false;       
+    // Destination rectangle out-of-bounds security checks
+    int const clip_x0 = RS_MAX((int)floorf(min_x), 0);
+    int const clip_y0 = RS_MAX((int)floorf(min_y), 0);
+    int const clip_x1 = RS_MIN((int)ceilf(max_x), dst->width);
+    int const clip_y1 = RS_MIN((int)ceilf(max_y), dst->height);
+    if ((clip_x1 <= clip_x0) || (clip_y1 <= clip_y0)) return;
+
+    // NOTE: See RaylibSIMD_ImageDrawEx
+    bool const src_float                = (src.format >= UNCOMPRESSED_R32) && (src.format <= UNCOMPRESSED_R32G32B32A32);
+    RaylibSIMD_ScaleFilter const filter = src_float ? RaylibSIMD_ScaleFilter_Nearest : RaylibSIMD__scale_filter;
+    int const span_format               = (filter == RaylibSIMD_ScaleFilter_Bilinear) ? UNCOMPRESSED_R8G8B8A8 : src.format;
+
+    RaylibSIMD__AffineSampler sampler = {0};
+    sampler.src_data                  = (unsigned char const *)src.data;
+    sampler.src_format                = src.format;
+    sampler.filter                    = filter;
+    sampler.src_bytes_per_pixel       = GetPixelDataSize(1, 1, src.format);
+    sampler.src_stride                = GetPixelDataSize(src.width, 1, src.format);
+    sampler.src_x                     = (int)srcRec.x;
+    sampler.src_y                     = (int)srcRec.y;
+    sampler.src_width                 = src_width;
+    sampler.src_height                = src_height;
+    sampler.u_16_16                   = (int64_t)floor(u * 65536.0 + 0.5);
+    sampler.v_16_16                   = (int64_t)floor(v * 65536.0 + 0.5);
+    sampler.u_step_x_16_16            = (int64_t)floor(u_x * 65536.0 + 0.5);
+    sampler.v_step_x_16_16            = (int64_t)floor(v_x * 65536.0 + 0.5);
+    sampler.u_step_y_16_16            = (int64_t)floor(u_y * 65536.0 + 0.5);
+    sampler.v_step_y_16_16            = (int64_t)floor(v_y * 65536.0 + 0.5);
+
+    RaylibSIMD__DrawJob job = {0};
+    job.state               = RaylibSIMD__MakeDrawState(span_format, dst->format, tint, RaylibSIMD_BlendMode_Alpha);
+    job.clip                = (RaylibSIMD__Rect){clip_x0, clip_y0, clip_x1, clip_y1};
+    job.affine              = true;
+    job.affine_sampler      = sampler;
+    job.dest_data           = (unsigned char *)dst->data;
+    job.dest_stride         = GetPixelDataSize(dst->width, 1, dst->format);
+
+    if (RaylibSIMD__BatchRecording(dst)) RaylibSIMD__BatchPushDraw(&job);
+    else
+    {
+        job.rows_per_task    = RaylibSIMD__RowsPerTask(clip_x1 - clip_x0, clip_y1 - clip_y0);
+        int const task_count = (clip_y1 - clip_y0 + job.rows_per_task - 1) / job.rows_per_task;
+        RaylibSIMD__RunTasks(RaylibSIMD__DrawTask, &job, task_count);
+        RaylibSIMD__UpdateMipmaps(dst, job.clip);
+    }
+}
 
-        int strideDst = GetPixelDataSize(dst->width, 1, dst->format);
-        int bytesPerPixelDst = strideDst/(dst->width);
+// NOTE: Shared by RaylibSIMD_ImageDrawMasked and RaylibSIMD_ImageDrawColorMasked,
+// src is NULL for the latter which draws color through the mask. Glyphs drawn
+// at another size than the font's pass the destination size in dest_size, the
+// mask is then stretched over it with the scale filter like RaylibSIMD_ImageDraw
+// (color only).
+RS_FILE_SCOPE void RaylibSIMD__ImageDrawMasked(Image *dst, Image const *src, Rectangle srcRec, Image mask, Rectangle maskRec, Vector2 position, Vector2 const *dest_size, Color tint, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
+        (mask.data == NULL) || (mask.width == 0) || (mask.height == 0)) return;
+    if (src && ((src->data == NULL) || (src->width == 0) || (src->height == 0))) return;
 
-        int strideSrc = GetPixelDataSize(srcPtr->width, 1, srcPtr->format);
-        int bytesPerPixelSrc = strideSrc/(srcPtr->width);
+    if ((dst->format >= COMPRESSED_DXT1_RGB) || (src && (src->format >= COMPRESSED_DXT1_RGB)))
+    {
+        TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+        return;
+    }
+    if ((mask.format != UNCOMPRESSED_GRAYSCALE) && (mask.format != UNCOMPRESSED_GRAY_ALPHA) && (mask.format != UNCOMPRESSED_R8G8B8A8))
+    {
+        TRACELOG(LOG_WARNING, "Image drawing masks must be GRAYSCALE, GRAY_ALPHA or R8G8B8A8 images");
+        return;
+    }
 
-        unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
-        unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
+    // Mask and source rectangle out-of-bounds security checks
+    if (maskRec.x < 0) { maskRec.width += maskRec.x; maskRec.x = 0; }
+    if (maskRec.y < 0) { maskRec.height += maskRec.y; maskRec.y = 0; }
+    if ((maskRec.x + maskRec.width) > mask.width) maskRec.width = mask.width - maskRec.x;
+    if ((maskRec.y + maskRec.height) > mask.height) maskRec.height = mask.height - maskRec.y;
+    if (((int)maskRec.width <= 0) || ((int)maskRec.height <= 0)) return;
+    bool const scaled = dest_size && !src && (((int)dest_size->x != (int)maskRec.width) || ((int)dest_size->y != (int)maskRec.height));
+    int draw_width    = scaled ? (int)dest_size->x : (int)maskRec.width;
+    int draw_height   = scaled ? (int)dest_size->y : (int)maskRec.height;
+    if (src)
+    {
+        if (srcRec.x < 0) { srcRec.width += srcRec.x; srcRec.x = 0; }
+        if (srcRec.y < 0) { srcRec.height += srcRec.y; srcRec.y = 0; }
+        if ((srcRec.x + srcRec.width) > src->width) srcRec.width = src->width - srcRec.x;
+        if ((srcRec.y + srcRec.height) > src->height) srcRec.height = src->height - srcRec.y;
+        draw_width  = RS_MIN(draw_width, (int)srcRec.width);
+        draw_height = RS_MIN(draw_height, (int)srcRec.height);
+    }
+    if ((draw_width <= 0) || (draw_height <= 0)) return;
 
-        float const INV_255 = 1.f / 255.f;
-        RaylibSIMD_ImageDrawMode draw_mode = RaylibSIMD_ImageDrawMode_Original;
+    // Destination rectangle out-of-bounds security checks
+    int const draw_x  = (int)position.x;
+    int const draw_y  = (int)position.y;
+    int const clip_x0 = RS_MAX(draw_x, 0);
+    int const clip_y0 = RS_MAX(draw_y, 0);
+    int const clip_x1 = RS_MIN(draw_x + draw_width, dst->width);
+    int const clip_y1 = RS_MIN(draw_y + draw_height, dst->height);
+    if ((clip_x1 <= clip_x0) || (clip_y1 <= clip_y0)) return;
 
-        // TODO(doyle): Other destination formats untested but algorithm has
-        // been written in a way that is agnostic of the format. Test and
-        // verify.
-        if (dst->format == UNCOMPRESSED_R8G8B8A8 ||
-            dst->format == UCOMPRESSED_R8G8B8 ||
-            dst->format == UNCOMPRESSED_R5G6B5 ||
-            dst->format == UNCOMPRESSED_R5G5B5A1 ||
-            dst->format == UNCOMPRESSED_R4G4B4A4)
-            &&
-            (srcPtr->format == UNCOMPRESSED_R8G8B8A8 ||
-             srcPtr->format == UNCOMPRESSED_R8G8B8 ||
-             srcPtr->format == UNCOMPRESSED_R5G6B5 ||
-             srcPtr->format == UNCOMPRESSED_R5G5B5A1 ||
-             srcPtr->format == UNCOMPRESSED_R4G4B4A4
-             ))
+    RaylibSIMD__DrawJob job = {0};
+    job.state                = RaylibSIMD__MakeDrawState(UNCOMPRESSED_R8G8B8A8, dst->format, tint, RaylibSIMD_BlendMode_Alpha);
+    job.clip                 = (RaylibSIMD__Rect){clip_x0, clip_y0, clip_x1, clip_y1};
+    job.masked               = true;
+    job.mask.data            = (unsigned char const *)mask.data;
+    job.mask.stride          = GetPixelDataSize(mask.width, 1, mask.format);
+    job.mask.bytes_per_pixel = GetPixelDataSize(1, 1, mask.format);
+    job.mask.coverage_offset = RaylibSIMD__MaskCoverageOffset(mask.format);
+    job.mask.x               = (int)maskRec.x;
+    job.mask.y               = (int)maskRec.y;
+    job.mask.color           = color;
+    job.dest_data            = (unsigned char *)dst->data;
+    job.dest_stride          = GetPixelDataSize(dst->width, 1, dst->format);
+    job.draw_x               = draw_x;
+    job.draw_y               = draw_y;
+    if (scaled)
+    {
+        // NOTE: Bilinear sampling produces R8G8B8A8, with the gray of
+        // GRAYSCALE masks in red
+        job.scaled  = true;
+        job.sampler = RaylibSIMD__MakeSampler(&mask, maskRec, draw_width, draw_height, RaylibSIMD__scale_filter);
+        if (RaylibSIMD__scale_filter == RaylibSIMD_ScaleFilter_Bilinear)
         {
-            draw_mode = RaylibSIMD_ImageDrawMode_SIMD;
+            job.mask.bytes_per_pixel = 4;
+            job.mask.coverage_offset = (mask.format == UNCOMPRESSED_GRAYSCALE) ? 0 : 3;
         }
+    }
+    if (src)
+    {
+        job.mask.src_format          = src->format;
+        job.mask.src_bytes_per_pixel = GetPixelDataSize(1, 1, src->format);
+        job.src_data                 = (unsigned char const *)src->data;
+        job.src_stride               = GetPixelDataSize(src->width, 1, src->format);
+        job.src_x                    = (int)srcRec.x;
+        job.src_y                    = (int)srcRec.y;
+    }
 
-        switch(draw_mode)
-        {
-            case RaylibSIMD_ImageDrawMode_Original:
-            {
-                Color colSrc, colDst, blend;
-                for (int y = 0; y < (int)srcRec.height; y++)
-                {
-                    unsigned char *pSrc = pSrcBase;
-                    unsigned char *pDst = pDstBase;
-
-                    // Fast path: Avoid moving pixel by pixel if no blend required and same format
-                    if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (size_t)srcRec.width*bytesPerPixelSrc);
-                    else
-                    {
-                        for (int x = 0; x < (int)srcRec.width; x++)
-                        {
-                            colSrc = GetPixelColor(pSrc, srcPtr->format);
-                            colDst = GetPixelColor(pDst, dst->format);
-
-                            // Fast path: Avoid blend if source has no alpha to blend
-                            if (blendRequired) blend = ColorAlphaBlend(colDst, colSrc, tint);
-                            else blend = colSrc;
-
-                            SetPixelColor(pDst, blend, dst->format);
-
-                            pDst += bytesPerPixelDst;
-                            pSrc += bytesPerPixelSrc;
-                        }
-                    }
-
-                    pSrcBase += strideSrc;
-                    pDstBase += strideDst;
-                }
-            }
-            break;
+    if (RaylibSIMD__BatchRecording(dst)) RaylibSIMD__BatchPushDraw(&job);
+    else
+    {
+        job.rows_per_task    = RaylibSIMD__RowsPerTask(clip_x1 - clip_x0, clip_y1 - clip_y0);
+        int const task_count = (clip_y1 - clip_y0 + job.rows_per_task - 1) / job.rows_per_task;
+        RaylibSIMD__RunTasks(RaylibSIMD__DrawTask, &job, task_count);
+        RaylibSIMD__UpdateMipmaps(dst, job.clip);
+    }
+}
 
-            case RaylibSIMD_ImageDrawMode_Flattened:
-            {
-                unsigned char *src_row    = RS_CAST(unsigned char *)pSrcBase;
-                unsigned char *dest_row   = RS_CAST(unsigned char *)pDstBase;
-                float const src_alpha_min = (srcPtr->format == UNCOMPRESSED_R8G8B8) ? 255.f : 0.f;
+// NOTE: Source pixel (srcRec.x + x, srcRec.y + y) is covered by mask pixel
+// (maskRec.x + x, maskRec.y + y) and drawn at (position.x + x, position.y + y),
+// over the smaller of the two rectangles.
+void RaylibSIMD_ImageDrawMasked(Image *dst, Image src, Rectangle srcRec, Image mask, Rectangle maskRec, Vector2 position, Color tint)
+{
+    Color const white = {255, 255, 255, 255};
+    RaylibSIMD__ImageDrawMasked(dst, &src, srcRec, mask, maskRec, position, NULL, tint, white);
+}
 
-                for (int y = 0; y < (int)srcRec.height; y++)
-                {
-                    unsigned char *src_ptr  = src_row;
-                    unsigned char *dest_ptr = dest_row;
-                    for (int x = 0; x < (int)srcRec.width; x++)
-                    {
-                        RaylibSIMD__SoftwareBlendPixel(src_ptr, dest_ptr, tint, src_alpha_min);
-                        src_ptr += bytesPerPixelSrc;
-                        dest_ptr += bytesPerPixelDst;
-                    }
-
-                    src_row += strideSrc;
-                    dest_row += strideDst;
-                }
+void RaylibSIMD_ImageDrawColorMasked(Image *dst, Image mask, Rectangle maskRec, Vector2 position, Color color)
+{
+    // NOTE: color's alpha is multiplied in with the coverage, the tint stays
+    // white so that fully covered spans of an opaque color are copied
+    Color const white = {255, 255, 255, 255};
+    RaylibSIMD__ImageDrawMasked(dst, NULL, (Rectangle){0}, mask, maskRec, position, NULL, white, color);
+}
 
-            }
-            break;
+// NOTE: UTF-8 decoding like raylib's GetNextCodepoint, invalid sequences
+// decode to '?' and consume one byte.
+RS_FILE_SCOPE int RaylibSIMD__NextCodepoint(unsigned char const *text, int *bytes)
+{
+    int result = '?';
+    *bytes     = 1;
+    if (text[0] < 0x80) result = text[0];
+    else if ((text[0] & 0xE0) == 0xC0 && (text[1] & 0xC0) == 0x80)
+    {
+        result = ((text[0] & 0x1F) << 6) | (text[1] & 0x3F);
+        *bytes = 2;
+    }
+    else if ((text[0] & 0xF0) == 0xE0 && (text[1] & 0xC0) == 0x80 && (text[2] & 0xC0) == 0x80)
+    {
+        result = ((text[0] & 0x0F) << 12) | ((text[1] & 0x3F) << 6) | (text[2] & 0x3F);
+        *bytes = 3;
+    }
+    else if ((text[0] & 0xF8) == 0xF0 && (text[1] & 0xC0) == 0x80 && (text[2] & 0xC0) == 0x80 && (text[3] & 0xC0) == 0x80)
+    {
+        result = ((text[0] & 0x07) << 18) | ((text[1] & 0x3F) << 12) | ((text[2] & 0x3F) << 6) | (text[3] & 0x3F);
+        *bytes = 4;
+    }
+    return result;
+}
 
-            case RaylibSIMD_ImageDrawMode_SIMD:
-            {
-                // NOTE: The general approach to SIMD the drawing loop is to
-                // pull out each pixel into each available f32 SIMD lane to
-                // do color blends in a [0, 1] 32 bit float space.
-                // For example a __m128 consists of 4x32 bit lanes.
-                //
-                // SIMD Register
-                // {[Pixel1] [Pixel2] [Pixel3] [Pixel4]}
-                //
-                // Followed by pulling each color component from pixels 1, 2,
-                // 3 and 4 into a SIMD lane to perform the color blend.
-                //
-                // {[R1] [R2] [R3] [R4]} Register 1
-                // {[G1] [G2] [G3] [G4]}    ..
-                // {[B1] [B2] [B3] [B4]}    ..
-                // {[A1] [A2] [A3] [A4]}    ..
-                //
-                // We collate the same colors of each pixel into the lanes
-                // because the required blend equation is the same across the
-                // same color components.
-
-                __m128 const tint_r01_4x      = _mm_set1_ps(tint.r * INV_255);
-                __m128 const tint_g01_4x      = _mm_set1_ps(tint.g * INV_255);
-                __m128 const tint_b01_4x      = _mm_set1_ps(tint.b * INV_255);
-                __m128 const tint_a01_4x      = _mm_set1_ps(tint.a * INV_255);
-                __m128 const one_4x           = _mm_set1_ps(1.f);
-
-                float src_alpha_min  = 0.f;
-                float dest_alpha_min = 0.f;
-                if (srcPtr->format == UNCOMPRESSED_R8G8B8 || srcPtr->format == UNCOMPRESSED_R5G6B5) src_alpha_min = 255.f;
-                if (dst->format == UNCOMPRESSED_R8G8B8 || dst->format == UNCOMPRESSED_R5G6B5)      dest_alpha_min = 255.f;
-
-                RaylibSIMD_PixelPerLaneShuffle src_lanes  = RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(srcPtr->format);
-                RaylibSIMD_PixelPerLaneShuffle dest_lanes = RaylibSIMD__FormatToPixelPerLaneShuffle128Bit(dst->format);
-
-                __m128 const src_alpha_min_4x   = _mm_set1_ps(src_alpha_min);
-                __m128 const dest_alpha_min_4x  = _mm_set1_ps(dest_alpha_min);
-                __m128i src_r_bit_mask          = _mm_set1_epi32(src_lanes.r_bit_mask);
-                __m128i src_g_bit_mask          = _mm_set1_epi32(src_lanes.g_bit_mask);
-                __m128i src_b_bit_mask          = _mm_set1_epi32(src_lanes.b_bit_mask);
-                __m128i src_a_bit_mask          = _mm_set1_epi32(src_lanes.a_bit_mask);
-
-                __m128 src_r_to_01_coefficient  = _mm_set1_ps(src_lanes.r_to_01_coefficient);
-                __m128 src_g_to_01_coefficient  = _mm_set1_ps(src_lanes.g_to_01_coefficient);
-                __m128 src_b_to_01_coefficient  = _mm_set1_ps(src_lanes.b_to_01_coefficient);
-                __m128 src_a_to_01_coefficient  = _mm_set1_ps(src_lanes.a_to_01_coefficient);
-
-                __m128i dest_r_bit_mask         = _mm_set1_epi32(dest_lanes.r_bit_mask);
-                __m128i dest_g_bit_mask         = _mm_set1_epi32(dest_lanes.g_bit_mask);
-                __m128i dest_b_bit_mask         = _mm_set1_epi32(dest_lanes.b_bit_mask);
-                __m128i dest_a_bit_mask         = _mm_set1_epi32(dest_lanes.a_bit_mask);
-
-                __m128 dest_r_to_01_coefficient = _mm_set1_ps(dest_lanes.r_to_01_coefficient);
-                __m128 dest_g_to_01_coefficient = _mm_set1_ps(dest_lanes.g_to_01_coefficient);
-                __m128 dest_b_to_01_coefficient = _mm_set1_ps(dest_lanes.b_to_01_coefficient);
-                __m128 dest_a_to_01_coefficient = _mm_set1_ps(dest_lanes.a_to_01_coefficient);
-
-                __m128 dest_r01_to_pixel_format_coefficient = _mm_rcp_ps(dest_r_to_01_coefficient);
-                __m128 dest_g01_to_pixel_format_coefficient = _mm_rcp_ps(dest_g_to_01_coefficient);
-                __m128 dest_b01_to_pixel_format_coefficient = _mm_rcp_ps(dest_b_to_01_coefficient);
-                __m128 dest_a01_to_pixel_format_coefficient = _mm_rcp_ps(dest_a_to_01_coefficient);
-
-                // NOTE: Divide by float because we blend in [0,1] 32 bit float space
-                // Each color component requires 1 SIMD float lane to perform such blend.
-                int const PIXELS_PER_SIMD_WRITE = sizeof(__m128) / sizeof(float);
-                int const src_bits_per_pixel    = RaylibSIMD__FormatToBitsPerPixel(srcPtr->format);
-                int const src_bytes_per_pixel   = src_bits_per_pixel / 8;
-                int const dest_bits_per_pixel   = RaylibSIMD__FormatToBitsPerPixel(dst->format);
-                int const dest_bytes_per_pixel  = dest_bits_per_pixel / 8;
-
-                int const src_bytes_per_simd_write  = PIXELS_PER_SIMD_WRITE * src_bytes_per_pixel;
-                int const dest_bytes_per_simd_write = PIXELS_PER_SIMD_WRITE * dest_bytes_per_pixel;
-
-                int const simd_iterations       = RS_CAST(int) srcRec.width / PIXELS_PER_SIMD_WRITE; // NOTE: Divison here rounds down fractional pixels
-                int const total_simd_pixels     = simd_iterations * PIXELS_PER_SIMD_WRITE;
-                int const remaining_iterations  = srcRec.width - total_simd_pixels;                  // NOTE: Ensure pixels fractionally written to are dealt with
-
-                unsigned char const *src_row = RS_CAST(unsigned char const *)pSrcBase;
-                unsigned char *dest_row      = RS_CAST(unsigned char *)pDstBase;
-                for (int y = 0; y < (int)srcRec.height; y++)
-                {
-                    unsigned char *src_ptr  = src_row;
-                    unsigned char *dest_ptr = dest_row;
-                    for (int x = 0; x < simd_iterations; x++)
-                    {
-                        unsigned char *dest = dest_ptr;
-
-                        // NOTE: Extract Pixels From Buffer
-                        __m128i src_pixels_4x           = _mm_loadu_si128((__m128i *)src_ptr);
-                        __m128i dest_pixels_4x          = _mm_loadu_si128((__m128i *)dest_ptr);
-
-                        // NOTE: Arrange loaded pixels to 1 pixel per lane.
-                        __m128i src_pixels_4x_shuffled  = _mm_shuffle_epi8(src_pixels_4x, src_lanes.shuffle);
-                        __m128i dest_pixels_4x_shuffled = _mm_shuffle_epi8(dest_pixels_4x, dest_lanes.shuffle);
-
-                        // NOTE: Advance Pixel Buffer
-                        src_ptr += src_bytes_per_simd_write;
-                        dest_ptr += dest_bytes_per_simd_write;
-
-                        // NOTE: Unpack Source & Dest Pixel Layout for SIMD
-                        // From {ABGR1, ABGR2, ABGR3, ABGR3} to {RRRR} {GGGG} {BBBB} {AAAA} where each
-                        // new {...} is one SIMD register with u32x4 lanes of the same color component.
-                        //
-                        //    1. Shift colour component to lowest 8 bits
-                        //    2. Isolate the color component
-                        //
-                        __m128i src0123_r_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes.r_bit_shift), src_r_bit_mask);
-                        __m128i src0123_g_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes.g_bit_shift), src_g_bit_mask);
-                        __m128i src0123_b_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes.b_bit_shift), src_b_bit_mask);
-                        __m128i src0123_a_int = _mm_and_si128(_mm_srli_epi32(src_pixels_4x_shuffled, src_lanes.a_bit_shift), src_a_bit_mask);
-
-                        __m128i dest0123_r_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes.r_bit_shift), dest_r_bit_mask);
-                        __m128i dest0123_g_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes.g_bit_shift), dest_g_bit_mask);
-                        __m128i dest0123_b_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes.b_bit_shift), dest_b_bit_mask);
-                        __m128i dest0123_a_int = _mm_and_si128(_mm_srli_epi32(dest_pixels_4x_shuffled, dest_lanes.a_bit_shift), dest_a_bit_mask);
-
-                        // NOTE: Convert to SIMD f32x4
-                        __m128 src0123_r  = _mm_cvtepi32_ps(src0123_r_int);
-                        __m128 src0123_g  = _mm_cvtepi32_ps(src0123_g_int);
-                        __m128 src0123_b  = _mm_cvtepi32_ps(src0123_b_int);
-                        __m128 src0123_a  = _mm_cvtepi32_ps(src0123_a_int);
-
-                        __m128 dest0123_r = _mm_cvtepi32_ps(dest0123_r_int);
-                        __m128 dest0123_g = _mm_cvtepi32_ps(dest0123_g_int);
-                        __m128 dest0123_b = _mm_cvtepi32_ps(dest0123_b_int);
-                        __m128 dest0123_a = _mm_cvtepi32_ps(dest0123_a_int);
-
-                        // NOTE: For images without an alpha component the src_alpha_min_4x is set to 255 to completely overwrite dest.
-                        //       For images with an alpha component the src_alpha_min_4x is set to 0 (i.e. no-op)
-                        src0123_a  = _mm_max_ps(src0123_a, src_alpha_min_4x);
-                        dest0123_a = _mm_max_ps(dest0123_a, dest_alpha_min_4x);
-
-                        // NOTE: Source Pixels to Normalized [0, 1] Float Space
-                        __m128 src0123_r01 = _mm_mul_ps(src0123_r, src_r_to_01_coefficient);
-                        __m128 src0123_g01 = _mm_mul_ps(src0123_g, src_g_to_01_coefficient);
-                        __m128 src0123_b01 = _mm_mul_ps(src0123_b, src_b_to_01_coefficient);
-                        __m128 src0123_a01 = _mm_mul_ps(src0123_a, src_a_to_01_coefficient);
-
-                        // NOTE: Tint Source Pixels
-                        __m128 src0123_tinted_r01 = _mm_mul_ps(src0123_r01, tint_r01_4x);
-                        __m128 src0123_tinted_g01 = _mm_mul_ps(src0123_g01, tint_g01_4x);
-                        __m128 src0123_tinted_b01 = _mm_mul_ps(src0123_b01, tint_b01_4x);
-                        __m128 src0123_tinted_a01 = _mm_mul_ps(src0123_a01, tint_a01_4x);
-
-                        // NOTE: Dest Pixels to Normalized [0, 1] Float Space
-                        __m128 dest0123_r01 = _mm_mul_ps(dest0123_r, dest_r_to_01_coefficient);
-                        __m128 dest0123_g01 = _mm_mul_ps(dest0123_g, dest_g_to_01_coefficient);
-                        __m128 dest0123_b01 = _mm_mul_ps(dest0123_b, dest_b_to_01_coefficient);
-                        __m128 dest0123_a01 = _mm_mul_ps(dest0123_a, dest_a_to_01_coefficient);
-
-                        // NOTE: Porter Duff Blend
-                        // NOTE: Blend Alpha
-                        // i.e. blend_a = src_a + (dest_a * (1 - src_a)) / blend_a
-                        __m128 blend0123_a01                           = _mm_add_ps(src0123_tinted_a01, _mm_mul_ps(dest0123_a01, _mm_sub_ps(one_4x, src0123_tinted_a01)));
-                        __m128 inv_blend0123_a01                       = _mm_rcp_ps(blend0123_a01);
-
-                        // (dest_a * (1 - src a) / blend_a)
-                        __m128 one_minus_src0123_tinted_a01 = _mm_sub_ps(one_4x, src0123_tinted_a01);
-                        __m128 blend_rhs                    = _mm_mul_ps(_mm_mul_ps(dest0123_a01, _mm_mul_ps(dest0123_a01, one_minus_src0123_tinted_a01)), inv_blend0123_a01);
-
-                        // NOTE: Blend Colors
-                        // i.e. blend_r = ((src_r * a) + (dest_r * dest_a * (1.f - src_a))) / blend_a;
-                        __m128 blend0123_r01 = _mm_add_ps(_mm_mul_ps(src0123_tinted_r01, src0123_tinted_a01), _mm_mul_ps(dest0123_r01, blend_rhs));
-                        __m128 blend0123_g01 = _mm_add_ps(_mm_mul_ps(src0123_tinted_g01, src0123_tinted_a01), _mm_mul_ps(dest0123_g01, blend_rhs));
-                        __m128 blend0123_b01 = _mm_add_ps(_mm_mul_ps(src0123_tinted_b01, src0123_tinted_a01), _mm_mul_ps(dest0123_b01, blend_rhs));
-
-                        // NOTE: Convert Blend to F32 Space for Pixel Format
-                        // i.e. For RGBA8888 to [0-255], RGBA4444 to [0-16] .. etc.
-                        __m128 blend0123_a = _mm_mul_ps(blend0123_a01, dest_a01_to_pixel_format_coefficient);
-                        __m128 blend0123_r = _mm_mul_ps(blend0123_r01, dest_r01_to_pixel_format_coefficient);
-                        __m128 blend0123_g = _mm_mul_ps(blend0123_g01, dest_g01_to_pixel_format_coefficient);
-                        __m128 blend0123_b = _mm_mul_ps(blend0123_b01, dest_b01_to_pixel_format_coefficient);
-
-                        // NOTE: Convert Blend to Integer Space
-                        __m128i blended0123_a_int = _mm_cvtps_epi32(blend0123_a);
-                        __m128i blended0123_r_int = _mm_cvtps_epi32(blend0123_r);
-                        __m128i blended0123_g_int = _mm_cvtps_epi32(blend0123_g);
-                        __m128i blended0123_b_int = _mm_cvtps_epi32(blend0123_b);
-
-                        // NOTE: Repack The Pixel
-                        // From {RRRR} {GGGG} {BBBB} {AAAA} to target format, i.e. for RGBA8888 {ABGR ABGR ABGR ABGR}
-                        // Each blend has the color component converted to 8 bits sitting in the low bits of the SIMD lane.
-                        // Shift the colors into place and or them together to get the final output
-                        //
-                        //      blended0123_r_int = {[0,0,0,R], [0,0,0,R], [0,0,0,R], [0,0,0,R]}
-                        //      blended0123_g_int = {[0,0,0,G], [0,0,0,G], [0,0,0,G], [0,0,0,G]}
-                        //      blended0123_b_int = {[0,0,0,B], [0,0,0,B], [0,0,0,B], [0,0,0,B]}
-                        //      blended0123_b_int = {[0,0,0,A], [0,0,0,A], [0,0,0,A], [0,0,0,A]}
-                        //      pixel0123         = {[A,B,G,R], [A,B,G,R], [A,B,G,R], [A,B,G,R]}
-                        //
-
-                        __m128i blended0123_a_int_shifted = _mm_slli_epi32(blended0123_a_int, dest_lanes.a_bit_shift);
-                        __m128i blended0123_r_int_shifted = _mm_slli_epi32(blended0123_r_int, dest_lanes.r_bit_shift);
-                        __m128i blended0123_g_int_shifted = _mm_slli_epi32(blended0123_g_int, dest_lanes.g_bit_shift);
-                        __m128i blended0123_b_int_shifted = _mm_slli_epi32(blended0123_b_int, dest_lanes.b_bit_shift);
-
-                        __m128i pixel0123_ar = _mm_or_si128(blended0123_a_int_shifted, blended0123_r_int_shifted);
-                        __m128i pixel0123_gb = _mm_or_si128(blended0123_g_int_shifted, blended0123_b_int_shifted);
-                        __m128i pixel0123    = _mm_or_si128(pixel0123_ar, pixel0123_gb);
-                        _mm_storeu_si128((__m128i *)dest, pixel0123);
-                    }
-
-                    // NOTE: Remaining iterations are done serially.
-                    for (int x = 0; x < remaining_iterations; x++)
-                    {
-                        RaylibSIMD__SoftwareBlendPixel(src_ptr, dest_ptr, tint, src_alpha_min);
-                        src_ptr += bytesPerPixelSrc;
-                        dest_ptr += bytesPerPixelDst;
-                    }
-
-                    src_row += strideSrc;
-                    dest_row += strideDst;
-                }
+// NOTE: Fonts loaded with raylib's default charset hold the glyphs of 32 to
+// 126 in order, so the glyph is usually found without searching. Missing
+// glyphs fall back to '?', or the first glyph.
+RS_FILE_SCOPE int RaylibSIMD__GlyphIndex(Font const *font, int codepoint)
+{
+    int const guess = codepoint - 32;
+    if ((guess >= 0) && (guess < font->charsCount) && (font->chars[guess].value == codepoint)) return guess;
 
-            }
+    int result = 0;
+    for (int index = 0; index < font->charsCount; index++)
+    {
+        if (font->chars[index].value == codepoint) return index;
+        if (font->chars[index].value == '?') result = index;
+    }
+    return result;
+}
+
+// NOTE: Glyphs are placed like DrawTextEx: scaled by fontSize / baseSize, a
+// glyph without advanceX advances by its width, spacing is added after every
+// glyph and '\n' starts a new line 1.5 * fontSize lower. Spaces and tabs only
+// advance.
+RaylibSIMD_TextRun RaylibSIMD_LoadTextRun(Font font, const char *text, float fontSize, float spacing)
+{
+    RaylibSIMD_TextRun result = {0};
+    if ((text == NULL) || (font.chars == NULL) || (font.charsCount <= 0) || (font.baseSize <= 0)) return result;
+
+    int const length = (int)strlen(text);
+    result.glyphs    = (RaylibSIMD_TextGlyph *)RL_MALLOC((length + 1) * sizeof(RaylibSIMD_TextGlyph));
+    if (result.glyphs == NULL) return result;
+
+    float const scale = fontSize / font.baseSize;
+    float offset_x    = 0;
+    float offset_y    = 0;
+    float line_width  = 0;
+    for (int position = 0; position < length;)
+    {
+        int bytes           = 0;
+        int const codepoint = RaylibSIMD__NextCodepoint((unsigned char const *)text + position, &bytes);
+        position           += bytes;
+        if (codepoint == '\n')
+        {
+            offset_y += (int)((font.baseSize + font.baseSize / 2) * scale);
+            offset_x  = 0;
+            continue;
         }
 
-        if (useSrcMod) UnloadImage(srcMod);     // Unload source modified image
+        int const index       = RaylibSIMD__GlyphIndex(&font, codepoint);
+        CharInfo const *glyph = font.chars + index;
+        if ((codepoint != ' ') && (codepoint != '\t') && (glyph->image.data != NULL))
+        {
+            RaylibSIMD_TextGlyph *text_glyph = result.glyphs + result.glyphCount++;
+            text_glyph->index                = index;
+            text_glyph->rec                  = (Rectangle){offset_x + glyph->offsetX * scale, offset_y + glyph->offsetY * scale, glyph->image.width * scale, glyph->image.height * scale};
+        }
+
+        float advance = (float)glyph->advanceX;
+        if (advance == 0) advance = font.recs ? font.recs[index].width : (float)glyph->image.width;
+        offset_x  += advance * scale;
+        line_width = RS_MAX(line_width, offset_x);
+        offset_x  += spacing;
+    }
+
+    result.size = (Vector2){line_width, offset_y + font.baseSize * scale};
+    return result;
+}
+
+void RaylibSIMD_UnloadTextRun(RaylibSIMD_TextRun run)
+{
+    RL_FREE(run.glyphs);
+}
+
+// NOTE: Every glyph is drawn through its image as a coverage mask, see
+// RaylibSIMD_ImageDrawColorMasked, and stretched over its rectangle when the
+// run was laid out at another size than the font's.
+void RaylibSIMD_ImageDrawTextRun(Image *dst, Font font, RaylibSIMD_TextRun run, Vector2 position, Color color)
+{
+    Color const white = {255, 255, 255, 255};
+    for (int glyph_index = 0; glyph_index < run.glyphCount; glyph_index++)
+    {
+        RaylibSIMD_TextGlyph const *glyph = run.glyphs + glyph_index;
+        Image const image                 = font.chars[glyph->index].image;
+        Rectangle const mask_rec          = {0, 0, (float)image.width, (float)image.height};
+        Vector2 const glyph_position      = {position.x + glyph->rec.x, position.y + glyph->rec.y};
+        Vector2 const glyph_size          = {glyph->rec.width, glyph->rec.height};
+        RaylibSIMD__ImageDrawMasked(dst, NULL, (Rectangle){0}, image, mask_rec, glyph_position, &glyph_size, white, color);
     }
 }
 
+void RaylibSIMD_ImageDrawTextEx(Image *dst, Vector2 position, Font font, const char *text, float fontSize, float spacing, Color color)
+{
+    RaylibSIMD_TextRun run = RaylibSIMD_LoadTextRun(font, text, fontSize, spacing);
+    RaylibSIMD_ImageDrawTextRun(dst, font, run, position, color);
+    RaylibSIMD_UnloadTextRun(run);
+}
+
 Image RaylibSIMD_GenImageColor(int width, int height, Color color)
 {
     Image image   = {0};
-    image.data    = RS_CAST(Color *) RL_MALLOC(width * height * sizeof(Color));
+    image.data    = RS_CAST(Color *) RaylibSIMD__ImageAlloc(RS_CAST(size_t)width * height * sizeof(Color));
     image.width   = width;
     image.height  = height;
     image.format  = UNCOMPRESSED_R8G8B8A8;
@@ -724,38 +7274,38 @@ Image RaylibSIMD_GenImageColor(int width, int height, Color color)
     return image;
 }
 
-RS_FILE_SCOPE int RaylibSIMD__FormatToBitsPerPixel(int format)
-{
-    int result = 4;
-    switch (format)
+Image RaylibSIMD_LoadScratchImage(int width, int height, int format)
+{
+    Image result = {0};
+    if ((width <= 0) || (height <= 0) || (format >= COMPRESSED_DXT1_RGB))
     {
-        case UNCOMPRESSED_GRAYSCALE: result = 8; break;
-        case UNCOMPRESSED_GRAY_ALPHA:
-        case UNCOMPRESSED_R5G6B5:
-        case UNCOMPRESSED_R5G5B5A1:
-        case UNCOMPRESSED_R4G4B4A4: result = 16; break;
-        case UNCOMPRESSED_R8G8B8A8: result = 32; break;
-        case UNCOMPRESSED_R8G8B8: result = 24; break;
-        case UNCOMPRESSED_R32: result = 32; break;
-        case UNCOMPRESSED_R32G32B32: result = 32*3; break;
-        case UNCOMPRESSED_R32G32B32A32: result = 32*4; break;
-        case COMPRESSED_DXT1_RGB:
-        case COMPRESSED_DXT1_RGBA:
-        case COMPRESSED_ETC1_RGB:
-        case COMPRESSED_ETC2_RGB:
-        case COMPRESSED_PVRT_RGB:
-        case COMPRESSED_PVRT_RGBA: result = 4; break;
-        case COMPRESSED_DXT3_RGBA:
-        case COMPRESSED_DXT5_RGBA:
-        case COMPRESSED_ETC2_EAC_RGBA:
-        case COMPRESSED_ASTC_4x4_RGBA: result = 8; break;
-        case COMPRESSED_ASTC_8x8_RGBA: result = 2; break;
-        default: break;
+        TRACELOG(LOG_WARNING, "Scratch images must have a size and an uncompressed format");
+        return result;
     }
 
+    result.data = RaylibSIMD__ScratchAlloc(GetPixelDataSize(width, height, format));
+    if (!result.data)
+    {
+        TRACELOG(LOG_WARNING, "Scratch image failed to allocate memory");
+        return result;
+    }
+    result.width   = width;
+    result.height  = height;
+    result.format  = format;
+    result.mipmaps = 1;
     return result;
 }
 
+void RaylibSIMD_UnloadScratchImage(Image image)
+{
+    // NOTE: image is a copy, so the batch is matched on the pixels rather than
+    // the Image. Recorded draws must land before the block goes back to the
+    // pool, where the next scratch image would receive them.
+    bool recording = (RaylibSIMD__batch.dst != NULL) && (RaylibSIMD__batch.dst->data == image.data);
+    if (recording) RaylibSIMD_FlushBatch();
+    RaylibSIMD__ScratchFree(image.data);
+}
+
 Rectangle RaylibSIMD__RectangleIntersection(Rectangle a, Rectangle b)
 {
     float a_max_x = a.x + a.width;
@@ -777,18 +7327,12 @@ Rectangle RaylibSIMD__RectangleIntersection(Rectangle a, Rectangle b)
     return result;
 }
 
-// Draw rectangle within an image
-void RaylibSIMD_ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+// NOTE: color in format repeated over a register, whole pixels from the first
+// byte. Every format matches SetPixelColor, see TestImageDrawRectangleRec.
+RS_FILE_SCOPE __m128i RaylibSIMD__FillPattern(int format, Color color)
 {
-    // Security check to avoid program crash
-    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
-
-    // TODO(doyle): Grayscale, Gray Alpha, R5G6B5, R5G5B5A1, R4G4B4A4 haven't
-    // been tested yet but, I wrote this function to technically be agnostic of
-    // the storage format. It probably works but should be checked.
-
     __m128i color_4x = {0};
-    switch(dst->format)
+    switch(format)
     {
         default: break;
         case UNCOMPRESSED_GRAYSCALE:
@@ -844,70 +7388,71 @@ void RaylibSIMD_ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
         case UNCOMPRESSED_R5G5B5A1:
         case UNCOMPRESSED_R4G4B4A4:
         {
-            float r01 = RS_CAST(float) color.r / 255.0f;
-            float g01 = RS_CAST(float) color.g / 255.0f;
-            float b01 = RS_CAST(float) color.b / 255.0f;
-            float a01 = RS_CAST(float) color.a / 255.0f;
-
-            uint16_t rgba = 0;
-            if (dst->format == UNCOMPRESSED_R5G6B5)
-            {
-                char r = RS_CAST(char)(r01 * 31.f);
-                char g = RS_CAST(char)(g01 * 63.f);
-                char b = RS_CAST(char)(b01 * 31.f);
-                rgba   = r << 11 | g << 5 | b << 0;
-            }
-            else if (dst->format == UNCOMPRESSED_R5G5B5A1)
-            {
-                char r = RS_CAST(char)(r01 * 31.f);
-                char g = RS_CAST(char)(g01 * 31.f);
-                char b = RS_CAST(char)(b01 * 31.f);
-                char a = RS_CAST(char)(a01 * 31.f);
-                rgba   = r << 11 | g << 6 | b << 1 | a << 0;
-            }
-            else if (dst->format == UNCOMPRESSED_R4G4B4A4)
-            {
-                char r = RS_CAST(char)(r01 * 15.f);
-                char g = RS_CAST(char)(g01 * 15.f);
-                char b = RS_CAST(char)(b01 * 15.f);
-                char a = RS_CAST(char)(a01 * 15.f);
-                rgba   = r << 12 | g << 8 | b << 4 | a << 0;
-            }
+            // NOTE: Packed by raylib so channels round and the 1 bit alpha
+            // threshold match SetPixelColor exactly
+            unsigned char pixel[4] = {0};
+            uint16_t rgba          = 0;
+            SetPixelColor(pixel, color, format);
+            memcpy(&rgba, pixel, sizeof(rgba));
+            color_4x = _mm_set1_epi16(RS_CAST(short)rgba);
+        }
+        break;
 
-            color_4x = _mm_set1_epi32((rgba << 0) | (rgba << 16));
+        case UNCOMPRESSED_R32:
+        case UNCOMPRESSED_R32G32B32:
+        case UNCOMPRESSED_R32G32B32A32:
+        {
+            // NOTE: SetPixelColor has no float formats, encoded like
+            // RaylibSIMD_ImageFormat and repeated over the register
+            float const channels[4]           = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+            int const bytes_per_pixel         = RaylibSIMD__FormatToBitsPerPixel(format) / 8;
+            unsigned char pattern[sizeof(__m128i)] = {0};
+            RaylibSIMD__EncodePixel(channels, format, pattern);
+            for (int offset = bytes_per_pixel; offset < RS_CAST(int)sizeof(pattern); offset += bytes_per_pixel)
+                memcpy(pattern + offset, pattern, RS_MIN(bytes_per_pixel, RS_CAST(int)sizeof(pattern) - offset));
+            color_4x = _mm_loadu_si128(RS_CAST(__m128i const *)pattern);
         }
         break;
     }
+    return color_4x;
+}
 
-    Rectangle dst_rect = (Rectangle){0, 0, dst->width, dst->height};
-    rec                = RaylibSIMD__RectangleIntersection(dst_rect, rec);
+// Draw rectangle within an image
+void RaylibSIMD_ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    int const bits_per_pixel        = RaylibSIMD__FormatToBitsPerPixel(dst->format);
-    int const bytes_per_pixel       = bits_per_pixel / 8;
+    __m128i const color_4x = RaylibSIMD__FillPattern(dst->format, color);
 
-    int const pixels_per_simd_write = sizeof(__m128i) / bytes_per_pixel;
-    int const bytes_per_simd_write  = pixels_per_simd_write * bytes_per_pixel;
+    Rectangle dst_rect = (Rectangle){0, 0, dst->width, dst->height};
+    rec                = RaylibSIMD__RectangleIntersection(dst_rect, rec);
+    if ((RS_CAST(int)rec.width <= 0) || (RS_CAST(int)rec.height <= 0)) return;
 
-    int const simd_iterations       = RS_CAST(int)rec.width / pixels_per_simd_write;
-    int const remaining_iterations  = rec.width - (pixels_per_simd_write * simd_iterations);
+    int const bits_per_pixel  = RaylibSIMD__FormatToBitsPerPixel(dst->format);
+    int const bytes_per_pixel = bits_per_pixel / 8;
 
-    int const stride                = dst->width * bytes_per_pixel;
-    int const row_offset            = (rec.y * stride) + rec.x * bytes_per_pixel;
+    RaylibSIMD__FillJob job = {0};
+    job.color_4x            = color_4x;
+    job.bytes_per_pixel     = bytes_per_pixel;
+    job.clip.x0             = RS_CAST(int)rec.x;
+    job.clip.y0             = RS_CAST(int)rec.y;
+    job.clip.x1             = job.clip.x0 + RS_CAST(int)rec.width;
+    job.clip.y1             = job.clip.y0 + RS_CAST(int)rec.height;
+    job.dest_data           = RS_CAST(unsigned char *)dst->data;
+    job.dest_stride         = dst->width * bytes_per_pixel;
 
-    for (int y = 0; y < RS_CAST(int)rec.height; y++)
+    if (RaylibSIMD__BatchRecording(dst)) RaylibSIMD__BatchPushFill(&job);
+    else
     {
-        unsigned char *dest = RS_CAST(unsigned char *)dst->data + (row_offset + (stride * y));
-        for (int iteration = 0; iteration < simd_iterations; iteration++)
-        {
-            _mm_storeu_si128(RS_CAST(__m128i *)dest, color_4x);
-            dest += bytes_per_simd_write;
-        }
-
-        for (int iteration = 0; iteration < remaining_iterations; iteration++)
-        {
-            SetPixelColor(dest, color, dst->format);
-            dest += bytes_per_pixel;
-        }
+        // NOTE: Batches are flushed tile by tile so that the following
+        // draws hit the cache, their fills are never streamed.
+        int const rows       = job.clip.y1 - job.clip.y0;
+        job.stream           = (RS_CAST(size_t)(job.clip.x1 - job.clip.x0) * rows * bytes_per_pixel) >= RS_STREAM_FILL_BYTES;
+        job.rows_per_task    = RaylibSIMD__RowsPerTask(job.clip.x1 - job.clip.x0, rows);
+        int const task_count = (rows + job.rows_per_task - 1) / job.rows_per_task;
+        RaylibSIMD__RunTasks(RaylibSIMD__FillTask, &job, task_count);
+        RaylibSIMD__UpdateMipmaps(dst, job.clip);
     }
 }
 
@@ -920,4 +7465,556 @@ void RaylibSIMD_ImageClearBackground(Image *dst, Color color)
 {
     RaylibSIMD_ImageDrawRectangleRec(dst, (Rectangle){0, 0, dst->width, dst->height}, color);
 }
+
+// NOTE: Shared by the primitives, (min_x, min_y) - (max_x, max_y) bounds the
+// shape and is grown by half a pixel for antialiased edges.
+RS_FILE_SCOPE void RaylibSIMD__ImageDrawShape(Image *dst, RaylibSIMD__Shape const *shape, float min_x, float min_y, float max_x, float max_y, Color color)
+{
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
+
+    if (dst->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image drawing not supported for compressed formats");
+        return;
+    }
+
+    bool const antialiased = (RaylibSIMD__shape_edges == RaylibSIMD_ShapeEdges_Antialiased);
+    float const grow       = antialiased ? 0.5f : 0.0f;
+    if (antialiased && (color.a == 0)) return;
+
+    // Destination rectangle out-of-bounds security checks
+    int const clip_x0 = RS_CAST(int)floorf(RS_MAX(min_x - grow, 0.0f));
+    int const clip_y0 = RS_CAST(int)floorf(RS_MAX(min_y - grow, 0.0f));
+    int const clip_x1 = RS_CAST(int)ceilf(RS_MIN(max_x + grow, RS_CAST(float)dst->width));
+    int const clip_y1 = RS_CAST(int)ceilf(RS_MIN(max_y + grow, RS_CAST(float)dst->height));
+    if ((clip_x1 <= clip_x0) || (clip_y1 <= clip_y0)) return;
+
+    int const bytes_per_pixel = RaylibSIMD__FormatToBitsPerPixel(dst->format) / 8;
+    RaylibSIMD__ShapeJob job  = {0};
+    job.shape                 = *shape;
+    job.color                 = color;
+    job.antialiased           = antialiased;
+    job.fill.color_4x         = RaylibSIMD__FillPattern(dst->format, color);
+    job.fill.bytes_per_pixel  = bytes_per_pixel;
+    job.fill.clip             = (RaylibSIMD__Rect){clip_x0, clip_y0, clip_x1, clip_y1};
+    job.fill.dest_data        = RS_CAST(unsigned char *)dst->data;
+    job.fill.dest_stride      = dst->width * bytes_per_pixel;
+    if (antialiased) job.state = RaylibSIMD__MakeDrawState(UNCOMPRESSED_R8G8B8A8, dst->format, (Color){255, 255, 255, 255}, RaylibSIMD_BlendMode_Alpha);
+
+    if (RaylibSIMD__BatchRecording(dst)) RaylibSIMD__BatchPushShape(&job);
+    else
+    {
+        job.fill.rows_per_task = RaylibSIMD__RowsPerTask(clip_x1 - clip_x0, clip_y1 - clip_y0);
+        int const task_count   = (clip_y1 - clip_y0 + job.fill.rows_per_task - 1) / job.fill.rows_per_task;
+        RaylibSIMD__RunTasks(RaylibSIMD__ShapeTask, &job, task_count);
+        RaylibSIMD__UpdateMipmaps(dst, job.fill.clip);
+    }
+}
+
+RS_FILE_SCOPE RaylibSIMD__RoundedBox RaylibSIMD__MakeRoundedBox(Rectangle rec, float radius)
+{
+    RaylibSIMD__RoundedBox result = {0};
+    result.half_width             = rec.width * 0.5f;
+    result.half_height            = rec.height * 0.5f;
+    result.center_x               = rec.x + result.half_width;
+    result.center_y               = rec.y + result.half_height;
+    result.radius                 = RS_MIN(RS_MAX(radius, 0.0f), RS_MIN(result.half_width, result.half_height));
+    return result;
+}
+
+// NOTE: Filled when thick is 0, otherwise lines thick pixels wide inside rec
+// whose inner corners are rounded by what's left of the radius
+RS_FILE_SCOPE void RaylibSIMD__ImageDrawRoundedBox(Image *dst, Rectangle rec, float radius, float thick, Color color)
+{
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
+
+    RaylibSIMD__Shape shape = {0};
+    shape.type              = RaylibSIMD__ShapeType_RoundedBox;
+    shape.box               = RaylibSIMD__MakeRoundedBox(rec, radius);
+    if ((thick > 0) && (thick * 2 < rec.width) && (thick * 2 < rec.height))
+    {
+        Rectangle const inner = {rec.x + thick, rec.y + thick, rec.width - thick * 2, rec.height - thick * 2};
+        shape.hollow          = true;
+        shape.hole            = RaylibSIMD__MakeRoundedBox(inner, shape.box.radius - thick);
+    }
+    RaylibSIMD__ImageDrawShape(dst, &shape, rec.x, rec.y, rec.x + rec.width, rec.y + rec.height, color);
+}
+
+// NOTE: Convex polygon of up to 4 points in either winding order, nothing is
+// drawn when it has no area
+RS_FILE_SCOPE void RaylibSIMD__ImageDrawPolygon(Image *dst, Vector2 const *points, int point_count, Color color)
+{
+    float area  = 0;
+    float min_x = points[0].x, min_y = points[0].y, max_x = points[0].x, max_y = points[0].y;
+    for (int index = 0; index < point_count; index++)
+    {
+        Vector2 const a = points[index];
+        Vector2 const b = points[(index + 1) % point_count];
+        area           += a.x * b.y - b.x * a.y;
+        min_x = RS_MIN(min_x, a.x); max_x = RS_MAX(max_x, a.x);
+        min_y = RS_MIN(min_y, a.y); max_y = RS_MAX(max_y, a.y);
+    }
+    if (area == 0) return;
+
+    // NOTE: Edge normals point out of the polygon for either winding
+    float const sign        = (area > 0) ? 1.0f : -1.0f;
+    RaylibSIMD__Shape shape = {0};
+    shape.type              = RaylibSIMD__ShapeType_Polygon;
+    for (int index = 0; index < point_count; index++)
+    {
+        Vector2 const a    = points[index];
+        Vector2 const b    = points[(index + 1) % point_count];
+        float const dx     = b.x - a.x;
+        float const dy     = b.y - a.y;
+        float const length = sqrtf(dx * dx + dy * dy);
+        if (length == 0) continue;
+
+        float *line = shape.edges[shape.edge_count++];
+        line[0]     = sign * dy / length;
+        line[1]     = -sign * dx / length;
+        line[2]     = -(line[0] * a.x + line[1] * a.y);
+    }
+
+    float const bounds[4][3] = {{-1, 0, min_x}, {1, 0, -max_x}, {0, -1, min_y}, {0, 1, -max_y}};
+    memcpy(shape.edges[shape.edge_count], bounds, sizeof(bounds));
+    shape.edge_count += 4;
+    RaylibSIMD__ImageDrawShape(dst, &shape, min_x, min_y, max_x, max_y, color);
+}
+
+// NOTE: A 1 pixel wide line between the pixel centers, extended by half a
+// pixel at both ends to cover the end pixels. Unlike Bresenham's some steps of
+// a line that isn't horizontal, vertical or diagonal set 2 pixels.
+void RaylibSIMD_ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
+{
+    float dx     = RS_CAST(float)(endPosX - startPosX);
+    float dy     = RS_CAST(float)(endPosY - startPosY);
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length == 0) { dx = 1; length = 1; }
+
+    float const cap_x   = dx / length * 0.5f;
+    float const cap_y   = dy / length * 0.5f;
+    Vector2 const start = {RS_CAST(float)startPosX + 0.5f - cap_x, RS_CAST(float)startPosY + 0.5f - cap_y};
+    Vector2 const end   = {RS_CAST(float)endPosX + 0.5f + cap_x, RS_CAST(float)endPosY + 0.5f + cap_y};
+    RaylibSIMD_ImageDrawLineEx(dst, start, end, 1.0f, color);
+}
+
+void RaylibSIMD_ImageDrawLineEx(Image *dst, Vector2 startPos, Vector2 endPos, float thick, Color color)
+{
+    float const dx     = endPos.x - startPos.x;
+    float const dy     = endPos.y - startPos.y;
+    float const length = sqrtf(dx * dx + dy * dy);
+    if ((length == 0) || (thick <= 0)) return;
+
+    float const normal_x    = -dy / length * thick * 0.5f;
+    float const normal_y    = dx / length * thick * 0.5f;
+    Vector2 const points[4] = {
+        {startPos.x + normal_x, startPos.y + normal_y},
+        {endPos.x + normal_x, endPos.y + normal_y},
+        {endPos.x - normal_x, endPos.y - normal_y},
+        {startPos.x - normal_x, startPos.y - normal_y},
+    };
+    RaylibSIMD__ImageDrawPolygon(dst, points, 4, color);
+}
+
+// NOTE: Pixels within radius of (centerX, centerY), i.e. x * x + y * y <=
+// radius * radius + radius, a disc of radius + 0.5 around the pixel's center
+void RaylibSIMD_ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
+{
+    if (radius < 0) return;
+    Rectangle const rec = {RS_CAST(float)(centerX - radius), RS_CAST(float)(centerY - radius), RS_CAST(float)(radius * 2 + 1), RS_CAST(float)(radius * 2 + 1)};
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, rec.width * 0.5f, 0, color);
+}
+
+void RaylibSIMD_ImageDrawCircleV(Image *dst, Vector2 center, float radius, Color color)
+{
+    Rectangle const rec = {center.x - radius, center.y - radius, radius * 2, radius * 2};
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, radius, 0, color);
+}
+
+// NOTE: The 1 pixel wide outline of RaylibSIMD_ImageDrawCircle
+void RaylibSIMD_ImageDrawCircleLines(Image *dst, int centerX, int centerY, int radius, Color color)
+{
+    if (radius < 0) return;
+    Rectangle const rec = {RS_CAST(float)(centerX - radius), RS_CAST(float)(centerY - radius), RS_CAST(float)(radius * 2 + 1), RS_CAST(float)(radius * 2 + 1)};
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, rec.width * 0.5f, 1, color);
+}
+
+void RaylibSIMD_ImageDrawTriangle(Image *dst, Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    Vector2 const points[3] = {v1, v2, v3};
+    RaylibSIMD__ImageDrawPolygon(dst, points, 3, color);
+}
+
+void RaylibSIMD_ImageDrawRectangleLines(Image *dst, Rectangle rec, int thick, Color color)
+{
+    if (thick <= 0) return;
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, 0, RS_CAST(float)thick, color);
+}
+
+void RaylibSIMD_ImageDrawRectangleRounded(Image *dst, Rectangle rec, float roundness, Color color)
+{
+    float const radius = RS_MIN(RS_MAX(roundness, 0.0f), 1.0f) * RS_MIN(rec.width, rec.height) * 0.5f;
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, radius, 0, color);
+}
+
+void RaylibSIMD_ImageDrawRectangleRoundedLines(Image *dst, Rectangle rec, float roundness, int thick, Color color)
+{
+    if (thick <= 0) return;
+    float const radius = RS_MIN(RS_MAX(roundness, 0.0f), 1.0f) * RS_MIN(rec.width, rec.height) * 0.5f;
+    RaylibSIMD__ImageDrawRoundedBox(dst, rec, radius, RS_CAST(float)thick, color);
+}
+
+void RaylibSIMD_ImageAlphaPremultiply(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format != UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "Image alpha premultiply only supported for R8G8B8A8 images");
+        return;
+    }
+
+    int const pixels   = image->width * image->height;
+    unsigned char *ptr = RS_CAST(unsigned char *)image->data;
+    int pixels_done    = 0;
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41) pixels_done = RaylibSIMD__PremultiplyRow_SSE41(ptr, pixels);
+
+    for (int index = pixels_done; index < pixels; index++)
+        RaylibSIMD__PremultiplyPixel(ptr + (index * 4));
+}
+
+void RaylibSIMD_ImageAlphaUnpremultiply(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format != UNCOMPRESSED_R8G8B8A8)
+    {
+        TRACELOG(LOG_WARNING, "Image alpha unpremultiply only supported for R8G8B8A8 images");
+        return;
+    }
+
+    int const pixels   = image->width * image->height;
+    unsigned char *ptr = RS_CAST(unsigned char *)image->data;
+    int pixels_done    = 0;
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41) pixels_done = RaylibSIMD__UnpremultiplyRow_SSE41(ptr, pixels);
+
+    for (int index = pixels_done; index < pixels; index++)
+        RaylibSIMD__UnpremultiplyPixel(ptr + (index * 4));
+}
+
+void RaylibSIMD_ImageFormat(Image *image, int newFormat)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+    if ((newFormat == 0) || (image->format == newFormat)) return;
+
+    // NOTE: Commands recorded for the image point at its data
+    if (RaylibSIMD__BatchRecording(image)) RaylibSIMD_FlushBatch();
+
+    bool const src_blocks  = RaylibSIMD__IsBlockFormat(image->format);
+    bool const dest_blocks = RaylibSIMD__IsBlockFormat(newFormat);
+    if (((image->format >= COMPRESSED_DXT1_RGB) && !src_blocks) || ((newFormat >= COMPRESSED_DXT1_RGB) && !dest_blocks))
+    {
+        TRACELOG(LOG_WARNING, "Image data format is compressed, can not be converted");
+        return;
+    }
+    if (src_blocks && dest_blocks) RaylibSIMD__ImageFormatBlocks(image, UNCOMPRESSED_R8G8B8A8);
+    if (src_blocks || dest_blocks)
+    {
+        if (image->format != newFormat) RaylibSIMD__ImageFormatBlocks(image, newFormat);
+        return;
+    }
+
+    RaylibSIMD__ConvertJob job = {0};
+    job.src                    = RS_CAST(unsigned char const *)image->data;
+    job.src_format             = image->format;
+    job.dest                   = RS_CAST(unsigned char *)RaylibSIMD__ImageAlloc(GetPixelDataSize(image->width, image->height, newFormat));
+    job.dest_format            = newFormat;
+    job.pixels                 = image->width * image->height;
+    if (!job.dest)
+    {
+        TRACELOG(LOG_WARNING, "Image format conversion failed to allocate memory");
+        return;
+    }
+
+    // NOTE: The image is one contiguous run of pixels, so tasks split it into
+    // bands of whole rows like the draws.
+    int const rows_per_task = RaylibSIMD__RowsPerTask(image->width, image->height);
+    job.pixels_per_task     = rows_per_task * image->width;
+    RaylibSIMD__RunTasks(RaylibSIMD__ConvertTask, &job, (image->height + rows_per_task - 1) / rows_per_task);
+
+    RL_FREE(image->data);
+    image->data   = job.dest;
+    image->format = newFormat;
+
+    // In case original image had mipmaps, generate mipmaps for formated image
+    // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+        RaylibSIMD_ImageMipmaps(image);
+    }
+}
+
+// NOTE: Runs one adjustment over the whole image, or appends it to the
+// adjustments recorded just before it when the image is being batched
+RS_FILE_SCOPE void RaylibSIMD__ImageColorFilter(Image *image, RaylibSIMD__ColorFilter filter)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image color adjustments not supported for compressed formats");
+        return;
+    }
+
+    RaylibSIMD__FilterJob job = {0};
+    job.format                = image->format;
+    job.bytes_per_pixel       = RaylibSIMD__FormatToBitsPerPixel(image->format) / 8;
+    job.clip                  = (RaylibSIMD__Rect){0, 0, image->width, image->height};
+    job.data                  = RS_CAST(unsigned char *)image->data;
+    job.stride                = image->width * job.bytes_per_pixel;
+
+    if (RaylibSIMD__BatchRecording(image)) RaylibSIMD__BatchPushFilter(&job, filter);
+    else
+    {
+        RaylibSIMD__ColorTable table = {0};
+        int table_count              = 0;
+        RaylibSIMD__FilterJobAppend(&job, &table, &table_count, filter);
+        job.tables           = &table;
+        job.rows_per_task    = RaylibSIMD__RowsPerTask(image->width, image->height);
+        int const task_count = (image->height + job.rows_per_task - 1) / job.rows_per_task;
+        RaylibSIMD__RunTasks(RaylibSIMD__FilterTask, &job, task_count);
+        RaylibSIMD__UpdateMipmaps(image, job.clip);
+    }
+}
+
+void RaylibSIMD_ImageColorTint(Image *image, Color color)
+{
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Tint;
+    filter.color                   = color;
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+void RaylibSIMD_ImageColorInvert(Image *image)
+{
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Invert;
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+void RaylibSIMD_ImageColorGrayscale(Image *image)
+{
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Grayscale;
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+void RaylibSIMD_ImageColorContrast(Image *image, float contrast)
+{
+    contrast = RS_MIN(RS_MAX(contrast, -100.0f), 100.0f);
+    contrast = (100.0f + contrast) / 100.0f;
+
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Contrast;
+    filter.amount                  = contrast * contrast;
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+void RaylibSIMD_ImageColorBrightness(Image *image, int brightness)
+{
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Brightness;
+    filter.amount                  = RS_CAST(float)RS_MIN(RS_MAX(brightness, -255), 255);
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+void RaylibSIMD_ImageColorReplace(Image *image, Color color, Color replace)
+{
+    RaylibSIMD__ColorFilter filter = {0};
+    filter.type                    = RaylibSIMD__ColorFilterType_Replace;
+    filter.color                   = color;
+    filter.replace                 = replace;
+    RaylibSIMD__ImageColorFilter(image, filter);
+}
+
+// NOTE: Runs the job on the image into a new buffer, like RaylibSIMD_ImageFormat
+RS_FILE_SCOPE void RaylibSIMD__ImageConvolve(Image *image, RaylibSIMD__ConvolveJob *job)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image filtering not supported for compressed formats");
+        return;
+    }
+
+    // NOTE: Tiles read their neighbours, so recorded commands must run first
+    if (RaylibSIMD__BatchRecording(image)) RaylibSIMD_FlushBatch();
+
+    job->src             = RS_CAST(unsigned char const *)image->data;
+    job->dest            = RS_CAST(unsigned char *)RaylibSIMD__ImageAlloc(GetPixelDataSize(image->width, image->height, image->format));
+    job->format          = image->format;
+    job->bytes_per_pixel = RaylibSIMD__FormatToBitsPerPixel(image->format) / 8;
+    job->width           = image->width;
+    job->height          = image->height;
+    if (!job->dest)
+    {
+        TRACELOG(LOG_WARNING, "Image filtering failed to allocate memory");
+        return;
+    }
+
+    // NOTE: Tiles of about 256x64 pixels stay in L2 with their ring of rows.
+    // They grow with the radius so that the apron each one filters on top of
+    // its own pixels stays under half of them.
+    job->strip_width = RS_MAX(256, 4 * job->radius_x);
+    job->strip_count = (image->width + job->strip_width - 1) / job->strip_width;
+    job->band_rows   = RS_MAX(64, 4 * job->radius_y);
+    int const bands  = (image->height + job->band_rows - 1) / job->band_rows;
+    RaylibSIMD__RunTasks(RaylibSIMD__ConvolveTask, job, job->strip_count * bands);
+
+    RL_FREE(image->data);
+    image->data = job->dest;
+
+    // In case original image had mipmaps, generate mipmaps for filtered image
+    // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+        RaylibSIMD_ImageMipmaps(image);
+    }
+}
+
+// NOTE: Normalized weights of a Gaussian out to 3 sigma, returns the radius
+RS_FILE_SCOPE int RaylibSIMD__GaussianWeights(float sigma, float *weights)
+{
+    int const radius = RS_MIN(RS_CAST(int)ceilf(3.0f * sigma), RS_CONVOLVE_MAX_RADIUS);
+    float total      = 0;
+    for (int tap = -radius; tap <= radius; tap++)
+    {
+        weights[tap + radius] = expf(-RS_CAST(float)(tap * tap) / (2.0f * sigma * sigma));
+        total                += weights[tap + radius];
+    }
+    for (int tap = 0; tap <= 2 * radius; tap++) weights[tap] /= total;
+    return radius;
+}
+
+void RaylibSIMD_ImageBlurBox(Image *image, int radius)
+{
+    if (radius <= 0) return;
+
+    // NOTE: Once the box covers the image in one direction, each step of
+    // radius only adds another copy of the first and last pixel. The tiles
+    // filter a box the size of the image and add the rest of the copies, so
+    // their buffers never outgrow the image.
+    RaylibSIMD__ConvolveJob job = {0};
+    job.box                     = true;
+    job.radius_x                = RS_MIN(radius, image->width);
+    job.radius_y                = RS_MIN(radius, image->height);
+    job.box_extra_x             = radius - job.radius_x;
+    job.box_extra_y             = radius - job.radius_y;
+    RaylibSIMD__ImageConvolve(image, &job);
+}
+
+void RaylibSIMD_ImageBlurGaussian(Image *image, float sigma)
+{
+    if (sigma <= 0) return;
+
+    RaylibSIMD__ConvolveJob job = {0};
+    job.radius_x                = RaylibSIMD__GaussianWeights(sigma, job.weights_x);
+    job.radius_y                = RaylibSIMD__GaussianWeights(sigma, job.weights_y);
+    RaylibSIMD__ImageConvolve(image, &job);
+}
+
+void RaylibSIMD_ImageSharpen(Image *image, float sigma, float amount)
+{
+    if ((sigma <= 0) || (amount == 0)) return;
+
+    RaylibSIMD__ConvolveJob job = {0};
+    job.radius_x                = RaylibSIMD__GaussianWeights(sigma, job.weights_x);
+    job.radius_y                = RaylibSIMD__GaussianWeights(sigma, job.weights_y);
+    job.sharpen                 = amount;
+    RaylibSIMD__ImageConvolve(image, &job);
+}
+
+void RaylibSIMD_ImageConvolve(Image *image, float const *kernelX, int sizeX, float const *kernelY, int sizeY)
+{
+    int const max_size = 2 * RS_CONVOLVE_MAX_RADIUS + 1;
+    if ((sizeX < 1) || (sizeY < 1) || (sizeX > max_size) || (sizeY > max_size) || !(sizeX & 1) || !(sizeY & 1))
+    {
+        TRACELOG(LOG_WARNING, "Image convolution kernels must have an odd size from 1 to %i", max_size);
+        return;
+    }
+
+    RaylibSIMD__ConvolveJob job = {0};
+    job.radius_x                = sizeX / 2;
+    job.radius_y                = sizeY / 2;
+    memcpy(job.weights_x, kernelX, sizeX * sizeof(float));
+    memcpy(job.weights_y, kernelY, sizeY * sizeof(float));
+    RaylibSIMD__ImageConvolve(image, &job);
+}
+
+// Generate all mipmap levels for a provided image
+// NOTE: Every level is built in one pass over the base level (see
+// RaylibSIMD__MipmapBandTask), only the last few small ones level by level
+void RaylibSIMD_ImageMipmaps(Image *image)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format >= COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "Image mipmaps generation not supported for compressed formats");
+        return;
+    }
+
+    if (RaylibSIMD__BatchRecording(image)) RaylibSIMD_FlushBatch();
+
+    int const level_count = RS_MIN(RaylibSIMD__MipmapLevelCount(image->width, image->height), RS_MIPMAP_MAX_LEVELS);
+    if (level_count == 1) return;
+    if (image->mipmaps < level_count)
+    {
+        RaylibSIMD__MipmapJob const sizes = RaylibSIMD__MakeMipmapJob(image, level_count);
+        int const last                    = level_count - 1;
+        int const size                    = RS_CAST(int)(sizes.levels[last] - sizes.levels[0]) + GetPixelDataSize(sizes.widths[last], sizes.heights[last], image->format);
+        // NOTE: realloc wouldn't keep the data aligned, the levels below the
+        // base are rebuilt anyway
+        void *data = NULL;
+        if (RaylibSIMD__image_alignment)
+        {
+            data = RaylibSIMD__ImageAlloc(size);
+            if (data)
+            {
+                memcpy(data, image->data, GetPixelDataSize(image->width, image->height, image->format));
+                RL_FREE(image->data);
+            }
+        }
+        else data = RL_REALLOC(image->data, size);
+        if (!data)
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Mipmaps required memory could not be allocated");
+            return;
+        }
+        image->data = data;
+    }
+    image->mipmaps = level_count;
+
+    // NOTE: Levels whose rows each come from two rows of the level above are
+    // built band by band, those below a 1 pixel high level row by row
+    RaylibSIMD__MipmapJob job = RaylibSIMD__MakeMipmapJob(image, level_count);
+    while ((job.band_levels + 1 < level_count) && ((1 << (job.band_levels + 1)) <= RS_MIPMAP_BAND_ROWS) && (job.heights[job.band_levels] >= 2))
+        job.band_levels++;
+    if (job.band_levels > 0)
+        RaylibSIMD__RunTasks(RaylibSIMD__MipmapBandTask, &job, (job.heights[1] + RS_MIPMAP_BAND_ROWS / 2 - 1) / (RS_MIPMAP_BAND_ROWS / 2));
+
+    for (int level = job.band_levels + 1; level < level_count; level++)
+        RaylibSIMD__MipmapLevel(&job, level, (RaylibSIMD__Rect){0, 0, job.widths[level], job.heights[level]});
+}
+
 #endif // RAYLIB_SIMD_IMPLEMENTATION
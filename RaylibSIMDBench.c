@@ -0,0 +1,1084 @@
+// RaylibSIMD benchmark, times every public routine against the raylib
+// function it replaces and the ImageDraw modes against each other.
+//
+// CMakeLists.txt builds it in standalone mode (RAYLIB_SIMD_STANDALONE), which
+// compares against the Original draw mode only. To include raylib's functions
+// build it against a raylib whose textures.c includes the RaylibSIMD
+// implementation (see README.md), e.g.
+//
+//   cc -O2 RaylibSIMDBench.c -I path/to/raylib/src -L path/to/raylib/src -lraylib -lm -lpthread -ldl -o RaylibSIMDBench
+//
+// Usage: RaylibSIMDBench [--quick] [--threads N] [--filter text] [--csv]
+//
+//   --quick    Fewer sizes, formats and tints, for a fast sanity check
+//   --threads  Worker count passed to RaylibSIMD_SetWorkerCount (default 1)
+//   --filter   Only run routines whose name contains text
+//   --csv      Comma separated output
+//
+// Every case runs 5 samples of at least 10ms each and reports the median.
+// Cycles are read from the time stamp counter so they're reference cycles at
+// the nominal frequency, pin the CPU frequency for reproducible numbers.
+
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#if defined(RAYLIB_SIMD_STANDALONE)
+    #define RAYLIB_SIMD_IMPLEMENTATION
+    #include "RaylibSIMD.h"
+    #define BENCH_RAYLIB 0
+#else
+    #include "raylib.h"
+    #include "RaylibSIMD.h"
+    #define BENCH_RAYLIB 1
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+
+#define BENCH_SAMPLES           5
+#define BENCH_MIN_SAMPLE_SECONDS 0.01
+
+typedef struct
+{
+    bool        quick;
+    bool        csv;
+    int         threads;
+    char const *filter;
+} BenchOptions;
+
+// NOTE: One timed configuration. run is timed, setup runs untimed before
+// every call for routines that consume their input (ImageFormat).
+typedef struct BenchCase BenchCase;
+struct BenchCase
+{
+    char const *routine;
+    char const *variant;
+    void      (*setup)(BenchCase *bench_case);
+    void      (*run)(BenchCase *bench_case);
+    Image       src;
+    Image       dst;
+    Image       scratch;       // Image handed to routines that modify or replace it
+    Rectangle   src_rec;
+    Rectangle   dst_rec;
+    Color       tint;
+    int         format;        // Target format of ImageFormat
+    int         blend_mode;    // RaylibSIMD_BlendMode of RaylibSIMD_ImageDrawEx
+    int         offset;        // Pixels the draw is shifted by to misalign rows
+    float       radius;        // Blur radius, or sigma of Gaussian filters
+    double      bytes_per_run; // Memory traffic of one call, for GB/s
+    int         pixels_per_run;
+};
+
+typedef struct
+{
+    double seconds_per_run;
+    double cycles_per_run;
+} BenchResult;
+
+static double BenchSeconds(void)
+{
+    struct timespec time = {0};
+#if defined(_WIN32)
+    timespec_get(&time, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &time);
+#endif
+    return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+static int BenchCompareDouble(void const *a, void const *b)
+{
+    double lhs = *(double const *)a;
+    double rhs = *(double const *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static BenchResult BenchMeasure(BenchCase *bench_case)
+{
+    double seconds[BENCH_SAMPLES];
+    double cycles[BENCH_SAMPLES];
+
+    // NOTE: Warm up caches, the worker pool and any lazy initialisation
+    if (bench_case->setup) bench_case->setup(bench_case);
+    bench_case->run(bench_case);
+
+    for (int sample = 0; sample < BENCH_SAMPLES; sample++)
+    {
+        double total_seconds = 0;
+        double total_cycles  = 0;
+        int runs             = 0;
+        while (total_seconds < BENCH_MIN_SAMPLE_SECONDS)
+        {
+            if (bench_case->setup) bench_case->setup(bench_case);
+            double start_seconds         = BenchSeconds();
+            unsigned long long start_tsc = __rdtsc();
+            bench_case->run(bench_case);
+            total_cycles  += (double)(__rdtsc() - start_tsc);
+            total_seconds += BenchSeconds() - start_seconds;
+            runs++;
+        }
+        seconds[sample] = total_seconds / runs;
+        cycles[sample]  = total_cycles / runs;
+    }
+
+    qsort(seconds, BENCH_SAMPLES, sizeof(double), BenchCompareDouble);
+    qsort(cycles, BENCH_SAMPLES, sizeof(double), BenchCompareDouble);
+
+    BenchResult result     = {0};
+    result.seconds_per_run = seconds[BENCH_SAMPLES / 2];
+    result.cycles_per_run  = cycles[BENCH_SAMPLES / 2];
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// Inputs
+// -----------------------------------------------------------------------------
+static unsigned int bench_random_state = 0x12345678;
+static unsigned char BenchRandom8(void)
+{
+    bench_random_state = bench_random_state * 1103515245 + 12345;
+    return (unsigned char)(bench_random_state >> 16);
+}
+
+// NOTE: Random colors with a spread of alpha, a quarter transparent, a quarter
+// opaque and the rest translucent, in runs so the opaque/transparent block
+// fast paths get exercised like they would by a sprite.
+static Image BenchGenImage(int width, int height, int format)
+{
+    Image result = RaylibSIMD_GenImageColor(width, height, (Color){0, 0, 0, 0});
+    Color *pixels = (Color *)result.data;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int const run    = ((x / 32) + y) & 3;
+            Color color      = {BenchRandom8(), BenchRandom8(), BenchRandom8(), BenchRandom8()};
+            if (run == 0) color.a = 0;
+            if (run == 1) color.a = 255;
+            pixels[y * width + x] = color;
+        }
+    }
+
+    RaylibSIMD_ImageFormat(&result, format);
+    return result;
+}
+
+static Image BenchCopyImage(Image image)
+{
+    Image result   = image;
+    int const size = GetPixelDataSize(image.width, image.height, image.format);
+    result.data    = RL_MALLOC(size);
+    memcpy(result.data, image.data, size);
+    return result;
+}
+
+static void BenchUnloadImage(Image image)
+{
+    RL_FREE(image.data);
+}
+
+static char const *BenchFormatName(int format)
+{
+    switch (format)
+    {
+        case UNCOMPRESSED_GRAYSCALE:     return "GRAYSCALE";
+        case UNCOMPRESSED_GRAY_ALPHA:    return "GRAY_ALPHA";
+        case UNCOMPRESSED_R5G6B5:        return "R5G6B5";
+        case UNCOMPRESSED_R8G8B8:        return "R8G8B8";
+        case UNCOMPRESSED_R5G5B5A1:      return "R5G5B5A1";
+        case UNCOMPRESSED_R4G4B4A4:      return "R4G4B4A4";
+        case UNCOMPRESSED_R8G8B8A8:      return "R8G8B8A8";
+        case UNCOMPRESSED_R32:           return "R32";
+        case UNCOMPRESSED_R32G32B32:     return "R32G32B32";
+        case UNCOMPRESSED_R32G32B32A32:  return "R32G32B32A32";
+        case COMPRESSED_DXT1_RGB:        return "DXT1_RGB";
+        case COMPRESSED_DXT1_RGBA:       return "DXT1_RGBA";
+        case COMPRESSED_DXT3_RGBA:       return "DXT3_RGBA";
+        case COMPRESSED_DXT5_RGBA:       return "DXT5_RGBA";
+        default:                         return "?";
+    }
+}
+
+static int BenchBytesPerPixel(int format)
+{
+    return GetPixelDataSize(1, 1, format);
+}
+
+// -----------------------------------------------------------------------------
+// Routines
+// -----------------------------------------------------------------------------
+#if BENCH_RAYLIB
+static void BenchRun_ImageDraw(BenchCase *c)              { ImageDraw(&c->dst, c->src, c->src_rec, c->dst_rec, c->tint); }
+static void BenchRun_ImageDrawRectangleRec(BenchCase *c)  { ImageDrawRectangleRec(&c->dst, c->dst_rec, c->tint); }
+static void BenchRun_ImageClearBackground(BenchCase *c)   { ImageClearBackground(&c->dst, c->tint); }
+static void BenchRun_GenImageColor(BenchCase *c)          { UnloadImage(GenImageColor(c->dst.width, c->dst.height, c->tint)); }
+static void BenchRun_ImageFormat(BenchCase *c)            { ImageFormat(&c->scratch, c->format); }
+static void BenchRun_ImageAlphaPremultiply(BenchCase *c)  { ImageAlphaPremultiply(&c->scratch); }
+static void BenchRun_ImageDrawCircle(BenchCase *c)        { ImageDrawCircle(&c->dst, (int)c->dst_rec.x, (int)c->dst_rec.y, (int)c->dst_rec.width, c->tint); }
+static void BenchRun_ImageColorChain(BenchCase *c)
+{
+    ImageColorTint(&c->dst, c->tint);
+    ImageColorContrast(&c->dst, 20.0f);
+    ImageColorBrightness(&c->dst, 10);
+    ImageColorInvert(&c->dst);
+}
+static void BenchRun_ImageMipmaps(BenchCase *c)           { ImageMipmaps(&c->dst); }
+
+// NOTE: raylib's ImageMipmaps leaves images that have levels alone
+static void BenchSetup_BaseLevelOnly(BenchCase *c)
+{
+    c->dst.mipmaps = 1;
+}
+#endif
+
+static void BenchRun_RaylibSIMD_ImageDraw(BenchCase *c)   { RaylibSIMD_ImageDraw(&c->dst, c->src, c->src_rec, c->dst_rec, c->tint); }
+static void BenchRun_RaylibSIMD_ImageDrawPro(BenchCase *c) { RaylibSIMD_ImageDrawPro(&c->dst, c->src, c->src_rec, c->dst_rec, (Vector2){c->dst_rec.width / 2, c->dst_rec.height / 2}, 30.0f, c->tint); }
+static void BenchRun_RaylibSIMD_ImageDrawPremultiplied(BenchCase *c) { RaylibSIMD_ImageDrawEx(&c->dst, c->src, c->src_rec, c->dst_rec, c->tint, RaylibSIMD_BlendMode_AlphaPremultiplied); }
+static void BenchRun_RaylibSIMD_ImageDrawColorMasked(BenchCase *c) { RaylibSIMD_ImageDrawColorMasked(&c->dst, c->src, c->src_rec, (Vector2){c->dst_rec.x, c->dst_rec.y}, c->tint); }
+
+// NOTE: What masked draws replace, an R8G8B8A8 copy of the color with the
+// coverage in alpha built in scratch and then drawn
+static void BenchRun_ImageDrawColorMaskedTemp(BenchCase *c)
+{
+    unsigned char const *coverage = (unsigned char const *)c->src.data;
+    Color *pixels                 = (Color *)c->scratch.data;
+    for (int index = 0; index < c->src.width * c->src.height; index++)
+        pixels[index] = (Color){c->tint.r, c->tint.g, c->tint.b, (unsigned char)((c->tint.a * coverage[index] + 127) / 255)};
+    RaylibSIMD_ImageDraw(&c->dst, c->scratch, c->src_rec, c->dst_rec, (Color){255, 255, 255, 255});
+}
+
+// NOTE: What raylib's primitives do, every pixel of the bounding square tested
+// and set on its own. dst_rec holds the center and the radius.
+static void BenchRun_ImageDrawCirclePixels(BenchCase *c)
+{
+    int const center_x = (int)c->dst_rec.x, center_y = (int)c->dst_rec.y, radius = (int)c->dst_rec.width;
+    int const bpp      = BenchBytesPerPixel(c->dst.format);
+    for (int y = -radius; y <= radius; y++)
+    for (int x = -radius; x <= radius; x++)
+        if (x * x + y * y <= radius * radius + radius) SetPixelColor((unsigned char *)c->dst.data + ((center_y + y) * c->dst.width + center_x + x) * bpp, c->tint, c->dst.format);
+}
+static void BenchRun_RaylibSIMD_ImageDrawCircle(BenchCase *c) { RaylibSIMD_ImageDrawCircle(&c->dst, (int)c->dst_rec.x, (int)c->dst_rec.y, (int)c->dst_rec.width, c->tint); }
+static void BenchRun_RaylibSIMD_ImageDrawEx(BenchCase *c) { RaylibSIMD_ImageDrawEx(&c->dst, c->src, c->src_rec, c->dst_rec, c->tint, (RaylibSIMD_BlendMode)c->blend_mode); }
+static void BenchRun_RaylibSIMD_ImageDrawRectangleRec(BenchCase *c) { RaylibSIMD_ImageDrawRectangleRec(&c->dst, c->dst_rec, c->tint); }
+static void BenchRun_RaylibSIMD_ImageClearBackground(BenchCase *c) { RaylibSIMD_ImageClearBackground(&c->dst, c->tint); }
+static void BenchRun_RaylibSIMD_GenImageColor(BenchCase *c) { BenchUnloadImage(RaylibSIMD_GenImageColor(c->dst.width, c->dst.height, c->tint)); }
+static void BenchRun_RaylibSIMD_ImageFormat(BenchCase *c) { RaylibSIMD_ImageFormat(&c->scratch, c->format); }
+static void BenchRun_RaylibSIMD_ImageAlphaPremultiply(BenchCase *c) { RaylibSIMD_ImageAlphaPremultiply(&c->scratch); }
+
+// NOTE: A thumbnail style chain of adjustments, each call a pass over the
+// image unless they're recorded into one batch
+static void BenchRun_RaylibSIMD_ImageColorChain(BenchCase *c)
+{
+    RaylibSIMD_ImageColorTint(&c->dst, c->tint);
+    RaylibSIMD_ImageColorContrast(&c->dst, 20.0f);
+    RaylibSIMD_ImageColorBrightness(&c->dst, 10);
+    RaylibSIMD_ImageColorInvert(&c->dst);
+}
+static void BenchRun_RaylibSIMD_ImageColorChainBatched(BenchCase *c)
+{
+    RaylibSIMD_BeginBatch(&c->dst);
+    BenchRun_RaylibSIMD_ImageColorChain(c);
+    RaylibSIMD_EndBatch();
+}
+
+// NOTE: What a plain C blur does, a separable box over Color copies of the
+// image where every output pixel sums its whole window
+static void BenchRun_ImageBlurBoxPixels(BenchCase *c)
+{
+    int const width = c->dst.width, height = c->dst.height, radius = (int)c->radius;
+    Color *pixels   = (Color *)c->dst.data;
+    int *sums       = (int *)RL_MALLOC(sizeof(int) * 4 * width * height);
+    for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+    for (int channel = 0; channel < 4; channel++)
+    {
+        int sum = 0;
+        for (int tap = -radius; tap <= radius; tap++) sum += (&pixels[y * width + RS_MIN(RS_MAX(x + tap, 0), width - 1)].r)[channel];
+        sums[(y * width + x) * 4 + channel] = sum;
+    }
+    int const area = (2 * radius + 1) * (2 * radius + 1);
+    for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+    for (int channel = 0; channel < 4; channel++)
+    {
+        int sum = 0;
+        for (int tap = -radius; tap <= radius; tap++) sum += sums[(RS_MIN(RS_MAX(y + tap, 0), height - 1) * width + x) * 4 + channel];
+        (&pixels[y * width + x].r)[channel] = (unsigned char)((sum + area / 2) / area);
+    }
+    RL_FREE(sums);
+}
+static void BenchRun_RaylibSIMD_ImageBlurBox(BenchCase *c)      { RaylibSIMD_ImageBlurBox(&c->dst, (int)c->radius); }
+static void BenchRun_RaylibSIMD_ImageBlurGaussian(BenchCase *c) { RaylibSIMD_ImageBlurGaussian(&c->dst, c->radius); }
+static void BenchRun_RaylibSIMD_ImageSharpen(BenchCase *c)      { RaylibSIMD_ImageSharpen(&c->dst, c->radius, 1.0f); }
+
+// NOTE: What a plain C mipmap chain does, every level averaged from the one
+// above a Color at a time. dst already holds the levels.
+static void BenchRun_ImageMipmapsPixels(BenchCase *c)
+{
+    Color *level = (Color *)c->dst.data;
+    int width = c->dst.width, height = c->dst.height;
+    for (int index = 1; index < c->dst.mipmaps; index++)
+    {
+        Color *next           = level + width * height;
+        int const next_width  = RS_MAX(width / 2, 1);
+        int const next_height = RS_MAX(height / 2, 1);
+        for (int y = 0; y < next_height; y++)
+        for (int x = 0; x < next_width; x++)
+        for (int channel = 0; channel < 4; channel++)
+        {
+            int const x0 = RS_MIN(2 * x, width - 1), x1 = RS_MIN(2 * x + 1, width - 1);
+            int const y0 = RS_MIN(2 * y, height - 1), y1 = RS_MIN(2 * y + 1, height - 1);
+            int const sum = (&level[y0 * width + x0].r)[channel] + (&level[y0 * width + x1].r)[channel] +
+                            (&level[y1 * width + x0].r)[channel] + (&level[y1 * width + x1].r)[channel];
+            (&next[y * next_width + x].r)[channel] = (unsigned char)((sum + 2) / 4);
+        }
+        level  = next;
+        width  = next_width;
+        height = next_height;
+    }
+}
+static void BenchRun_RaylibSIMD_ImageMipmaps(BenchCase *c) { RaylibSIMD_ImageMipmaps(&c->dst); }
+static void BenchRun_RaylibSIMD_ImageMipmapsGamma(BenchCase *c)
+{
+    RaylibSIMD_SetMipmapFilter(RaylibSIMD_MipmapFilter_BoxGamma);
+    RaylibSIMD_ImageMipmaps(&c->dst);
+    RaylibSIMD_SetMipmapFilter(RaylibSIMD_MipmapFilter_Box);
+}
+
+// NOTE: A temporary image the size of dst, cleared, used and dropped, from
+// a fresh allocation against the scratch pool
+static void BenchRun_RaylibSIMD_GenImageColorTemporary(BenchCase *c)
+{
+    Image image = RaylibSIMD_GenImageColor(c->dst.width, c->dst.height, c->tint);
+    RL_FREE(image.data);
+}
+static void BenchRun_RaylibSIMD_ScratchImageTemporary(BenchCase *c)
+{
+    Image image = RaylibSIMD_LoadScratchImage(c->dst.width, c->dst.height, UNCOMPRESSED_R8G8B8A8);
+    RaylibSIMD_ImageClearBackground(&image, c->tint);
+    RaylibSIMD_UnloadScratchImage(image);
+}
+
+// NOTE: Blocks encoded one at a time by the scalar kernels, the reference for
+// the SSE4.1 ones and the worker pool
+static void BenchRun_CompressBlocksScalar(BenchCase *c)
+{
+    unsigned char const *pixels = (unsigned char const *)c->src.data;
+    unsigned char *dest         = (unsigned char *)c->dst.data;
+    int const block_bytes       = RaylibSIMD__BlockBytes(c->format);
+    for (int block_y = 0; block_y < c->src.height / 4; block_y++)
+    for (int block_x = 0; block_x < c->src.width / 4; block_x++, dest += block_bytes)
+    {
+        unsigned char block[64];
+        for (int row = 0; row < 4; row++) memcpy(block + row * 16, pixels + ((block_y * 4 + row) * c->src.width + block_x * 4) * 4, 16);
+        RaylibSIMD__EncodeBlock(block, c->format, false, dest);
+    }
+}
+
+// NOTE: A sprite drawn on a texture that has mipmaps, updating the levels
+// under it against drawing on the base level then building every level
+static void BenchRun_RaylibSIMD_ImageDrawMipmapped(BenchCase *c) { RaylibSIMD_ImageDraw(&c->dst, c->src, c->src_rec, c->dst_rec, c->tint); }
+static void BenchRun_RaylibSIMD_ImageDrawThenMipmaps(BenchCase *c)
+{
+    Image base   = c->dst;
+    base.mipmaps = 1;
+    RaylibSIMD_ImageDraw(&base, c->src, c->src_rec, c->dst_rec, c->tint);
+    RaylibSIMD_ImageMipmaps(&c->dst);
+}
+
+// NOTE: Restore the input of routines that convert or modify it in place
+static void BenchSetup_CopySource(BenchCase *c)
+{
+    if (c->scratch.data && c->scratch.format == c->src.format)
+    {
+        memcpy(c->scratch.data, c->src.data, GetPixelDataSize(c->src.width, c->src.height, c->src.format));
+        return;
+    }
+
+    BenchUnloadImage(c->scratch);
+    c->scratch = BenchCopyImage(c->src);
+}
+
+// -----------------------------------------------------------------------------
+// Reporting
+// -----------------------------------------------------------------------------
+static void BenchPrintHeader(BenchOptions const *options)
+{
+    if (options->csv) printf("routine,variant,width,height,src,dst,tint,offset,ns_per_pixel,cycles_per_pixel,gb_per_second,speedup\n");
+    else printf("%-24s %-16s %-11s %-12s %-12s %-15s %-6s %9s %9s %8s %8s\n", "routine", "variant", "size", "src", "dst", "tint", "offset", "ns/px", "cycles/px", "GB/s", "speedup");
+}
+
+// NOTE: Speedup is relative to the first variant of each case, raylib's or
+// the Original draw mode in standalone builds
+static void BenchReport(BenchOptions const *options, BenchCase *bench_case, int dst_format, double *baseline_seconds)
+{
+    if (options->filter && !strstr(bench_case->routine, options->filter)) return;
+
+    BenchResult result = BenchMeasure(bench_case);
+    if (*baseline_seconds <= 0) *baseline_seconds = result.seconds_per_run;
+
+    double const pixels       = (double)bench_case->pixels_per_run;
+    double const ns_per_pixel = result.seconds_per_run * 1e9 / pixels;
+    double const cycles       = result.cycles_per_run / pixels;
+    double const gb_per_sec   = bench_case->bytes_per_run / result.seconds_per_run * 1e-9;
+    double const speedup      = *baseline_seconds / result.seconds_per_run;
+
+    char size[32], tint[32];
+    snprintf(size, sizeof(size), "%dx%d", bench_case->dst.width ? bench_case->dst.width : bench_case->src.width, bench_case->dst.height ? bench_case->dst.height : bench_case->src.height);
+    snprintf(tint, sizeof(tint), "%d,%d,%d,%d", bench_case->tint.r, bench_case->tint.g, bench_case->tint.b, bench_case->tint.a);
+
+    if (options->csv)
+    {
+        printf("%s,%s,%s,%s,%s,\"%s\",%d,%.4f,%.3f,%.3f,%.2f\n", bench_case->routine, bench_case->variant, size,
+               BenchFormatName(bench_case->src.format), BenchFormatName(dst_format), tint, bench_case->offset, ns_per_pixel, cycles, gb_per_sec, speedup);
+    }
+    else
+    {
+        printf("%-24s %-16s %-11s %-12s %-12s %-15s %-6d %9.3f %9.2f %8.2f %7.2fx\n", bench_case->routine, bench_case->variant, size,
+               bench_case->src.data ? BenchFormatName(bench_case->src.format) : "-", BenchFormatName(dst_format), tint, bench_case->offset, ns_per_pixel, cycles, gb_per_sec, speedup);
+    }
+    fflush(stdout);
+}
+
+// -----------------------------------------------------------------------------
+// Suites
+// -----------------------------------------------------------------------------
+static int const BENCH_SIZES[]       = {64, 256, 1024, 4096};
+static int const BENCH_QUICK_SIZES[] = {256, 1024};
+
+// NOTE: Formats the SIMD draw mode supports
+static int const BENCH_DRAW_FORMATS[]       = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R5G5B5A1, UNCOMPRESSED_R4G4B4A4,
+                                               UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R32G32B32A32};
+static int const BENCH_QUICK_DRAW_FORMATS[] = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_GRAY_ALPHA};
+
+static Color const BENCH_TINTS[]       = {{255, 255, 255, 255}, {255, 255, 255, 128}, {200, 150, 100, 255}};
+static Color const BENCH_QUICK_TINTS[] = {{255, 255, 255, 255}, {255, 255, 255, 128}};
+
+#define BENCH_COUNT(array) ((int)(sizeof(array) / sizeof((array)[0])))
+
+static void BenchImageDraw(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+    int const *formats   = options->quick ? BENCH_QUICK_DRAW_FORMATS : BENCH_DRAW_FORMATS;
+    int const fmt_count  = options->quick ? BENCH_COUNT(BENCH_QUICK_DRAW_FORMATS) : BENCH_COUNT(BENCH_DRAW_FORMATS);
+    Color const *tints   = options->quick ? BENCH_QUICK_TINTS : BENCH_TINTS;
+    int const tint_count = options->quick ? BENCH_COUNT(BENCH_QUICK_TINTS) : BENCH_COUNT(BENCH_TINTS);
+
+    struct { char const *name; RaylibSIMD_ImageDrawMode mode; } const modes[] =
+    {
+        {"Original",  RaylibSIMD_ImageDrawMode_Original},
+        {"Flattened", RaylibSIMD_ImageDrawMode_Flattened},
+        {"SIMD",      RaylibSIMD_ImageDrawMode_SIMD},
+    };
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    for (int src_index = 0; src_index < fmt_count; src_index++)
+    for (int dst_index = 0; dst_index < fmt_count; dst_index++)
+    for (int tint_index = 0; tint_index < tint_count; tint_index++)
+    for (int offset = 0; offset <= 1; offset++)
+    {
+        int const size       = sizes[size_index];
+        int const src_format = formats[src_index];
+        int const dst_format = formats[dst_index];
+
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageDraw";
+        bench_case.src            = BenchGenImage(size + offset, size, src_format);
+        bench_case.dst            = BenchGenImage(size + offset, size, dst_format);
+        bench_case.src_rec        = (Rectangle){(float)offset, 0, (float)size, (float)size};
+        bench_case.dst_rec        = (Rectangle){(float)offset, 0, (float)size, (float)size};
+        bench_case.tint           = tints[tint_index];
+        bench_case.offset         = offset;
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * (BenchBytesPerPixel(src_format) + 2 * BenchBytesPerPixel(dst_format));
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageDraw;
+        BenchReport(options, &bench_case, dst_format, &baseline);
+#endif
+
+        bench_case.run = BenchRun_RaylibSIMD_ImageDraw;
+        for (int mode = 0; mode < BENCH_COUNT(modes); mode++)
+        {
+            bool const flattened_supported = (src_format == UNCOMPRESSED_R8G8B8A8 && dst_format == UNCOMPRESSED_R8G8B8A8);
+            if (modes[mode].mode == RaylibSIMD_ImageDrawMode_Flattened && !flattened_supported) continue;
+
+            RaylibSIMD_SetImageDrawMode(modes[mode].mode);
+            bench_case.variant = modes[mode].name;
+            BenchReport(options, &bench_case, dst_format, &baseline);
+        }
+        RaylibSIMD_SetImageDrawMode(RaylibSIMD_ImageDrawMode_Auto);
+
+        if (src_format == UNCOMPRESSED_R8G8B8A8 && dst_format == UNCOMPRESSED_R8G8B8A8)
+        {
+            RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Fixed16);
+            bench_case.variant = "SIMD Fixed16";
+            BenchReport(options, &bench_case, dst_format, &baseline);
+            RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Float);
+
+            bench_case.variant = "Premultiplied";
+            bench_case.run     = BenchRun_RaylibSIMD_ImageDrawPremultiplied;
+            BenchReport(options, &bench_case, dst_format, &baseline);
+
+            bench_case.run        = BenchRun_RaylibSIMD_ImageDrawEx;
+            bench_case.variant    = "Additive";
+            bench_case.blend_mode = RaylibSIMD_BlendMode_Additive;
+            BenchReport(options, &bench_case, dst_format, &baseline);
+
+            bench_case.variant    = "Multiply";
+            bench_case.blend_mode = RaylibSIMD_BlendMode_Multiply;
+            BenchReport(options, &bench_case, dst_format, &baseline);
+        }
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchImageDrawScaled(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        // NOTE: Upscale a source half the size of the destination
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageDraw (scaled 2x)";
+        bench_case.src            = BenchGenImage(size / 2, size / 2, UNCOMPRESSED_R8G8B8A8);
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.src_rec        = (Rectangle){0, 0, (float)(size / 2), (float)(size / 2)};
+        bench_case.dst_rec        = (Rectangle){0, 0, (float)size, (float)size};
+        bench_case.tint           = (Color){255, 255, 255, 255};
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)(size / 2) * (size / 2) * 4 + (double)size * size * 2 * 4;
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageDraw;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+#endif
+
+        bench_case.run = BenchRun_RaylibSIMD_ImageDraw;
+        RaylibSIMD_SetImageDrawMode(RaylibSIMD_ImageDrawMode_Original);
+        bench_case.variant = "Original";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        RaylibSIMD_SetImageDrawMode(RaylibSIMD_ImageDrawMode_Auto);
+
+        RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Nearest);
+        bench_case.variant = "SIMD Nearest";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Bilinear);
+        bench_case.variant = "SIMD Bilinear";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchImageDrawRotated(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        // NOTE: Rotate a source half the size of the destination by 30 degrees
+        // around its center, scaled up 1.5x so that it covers about half of it
+        int const size            = sizes[size_index];
+        int const scaled          = size * 3 / 4;
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageDrawPro (30 deg)";
+        bench_case.src            = BenchGenImage(size / 2, size / 2, UNCOMPRESSED_R8G8B8A8);
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.src_rec        = (Rectangle){0, 0, (float)(size / 2), (float)(size / 2)};
+        bench_case.dst_rec        = (Rectangle){(float)(size / 2), (float)(size / 2), (float)scaled, (float)scaled};
+        bench_case.tint           = (Color){255, 255, 255, 255};
+        bench_case.pixels_per_run = scaled * scaled;
+        bench_case.bytes_per_run  = (double)(size / 2) * (size / 2) * 4 + (double)scaled * scaled * 2 * 4;
+        bench_case.run            = BenchRun_RaylibSIMD_ImageDrawPro;
+
+        double baseline = 0;
+        RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Nearest);
+        bench_case.variant = "SIMD Nearest";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Bilinear);
+        bench_case.variant = "SIMD Bilinear";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchImageDrawMasked(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        // NOTE: A color drawn through a GRAYSCALE coverage mask, e.g. a glyph
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageDrawColorMasked";
+        bench_case.src            = BenchGenImage(size, size, UNCOMPRESSED_GRAYSCALE);
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.scratch        = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.src_rec        = (Rectangle){0, 0, (float)size, (float)size};
+        bench_case.dst_rec        = (Rectangle){0, 0, (float)size, (float)size};
+        bench_case.tint           = (Color){230, 180, 40, 255};
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * (1 + 2 * 4);
+
+        double baseline = 0;
+        bench_case.variant = "Temp image";
+        bench_case.run     = BenchRun_ImageDrawColorMaskedTemp;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageDrawColorMasked;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.dst);
+        BenchUnloadImage(bench_case.scratch);
+    }
+}
+
+static void BenchShapes(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        // NOTE: A circle filling most of the destination, e.g. a chart marker
+        // or a pie. dst_rec holds the center and the radius.
+        int const size            = sizes[size_index];
+        int const radius          = size * 3 / 8;
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageDrawCircle";
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.dst_rec        = (Rectangle){(float)(size / 2), (float)(size / 2), (float)radius, (float)radius};
+        bench_case.tint           = (Color){60, 140, 220, 255};
+        bench_case.pixels_per_run = (int)(3.14159265f * radius * radius);
+        bench_case.bytes_per_run  = (double)bench_case.pixels_per_run * 4;
+
+        double baseline = 0;
+        bench_case.variant = "Pixel loop";
+        bench_case.run     = BenchRun_ImageDrawCirclePixels;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageDrawCircle;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+#endif
+
+        bench_case.variant = "SIMD Aliased";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageDrawCircle;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges_Antialiased);
+        bench_case.variant = "SIMD Antialiased";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges_Aliased);
+
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchFills(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+    int const formats[]  = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R8G8B8A8};
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    for (int format_index = 0; format_index < BENCH_COUNT(formats); format_index++)
+    for (int offset = 0; offset <= 1; offset++)
+    {
+        int const size            = sizes[size_index];
+        int const format          = formats[format_index];
+        BenchCase bench_case      = {0};
+        bench_case.dst            = BenchGenImage(size + offset, size, format);
+        bench_case.dst_rec        = (Rectangle){(float)offset, 0, (float)size, (float)size};
+        bench_case.tint           = (Color){200, 150, 100, 255};
+        bench_case.offset         = offset;
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * BenchBytesPerPixel(format);
+
+        double baseline = 0;
+        bench_case.routine = "ImageDrawRectangleRec";
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageDrawRectangleRec;
+        BenchReport(options, &bench_case, format, &baseline);
+#endif
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageDrawRectangleRec;
+        BenchReport(options, &bench_case, format, &baseline);
+
+        if (offset == 0)
+        {
+            baseline = 0;
+            bench_case.routine = "ImageClearBackground";
+#if BENCH_RAYLIB
+            bench_case.variant = "raylib";
+            bench_case.run     = BenchRun_ImageClearBackground;
+            BenchReport(options, &bench_case, format, &baseline);
+#endif
+            bench_case.variant = "SIMD";
+            bench_case.run     = BenchRun_RaylibSIMD_ImageClearBackground;
+            BenchReport(options, &bench_case, format, &baseline);
+        }
+
+        BenchUnloadImage(bench_case.dst);
+    }
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "GenImageColor";
+        bench_case.dst.width      = size;
+        bench_case.dst.height     = size;
+        bench_case.tint           = (Color){200, 150, 100, 255};
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * 4;
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_GenImageColor;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+#endif
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_GenImageColor;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+    }
+}
+
+static void BenchConversions(BenchOptions const *options)
+{
+    int const size        = options->quick ? 512 : 1024;
+    int const formats[]   = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G5B5A1,
+                             UNCOMPRESSED_R4G4B4A4, UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R32, UNCOMPRESSED_R32G32B32, UNCOMPRESSED_R32G32B32A32};
+
+    for (int src_index = 0; src_index < BENCH_COUNT(formats); src_index++)
+    for (int dst_index = 0; dst_index < BENCH_COUNT(formats); dst_index++)
+    {
+        if (src_index == dst_index) continue;
+        bool const common = (formats[src_index] == UNCOMPRESSED_R8G8B8A8 || formats[dst_index] == UNCOMPRESSED_R8G8B8A8);
+        if (options->quick && !common) continue;
+
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageFormat";
+        bench_case.src            = BenchGenImage(size, size, formats[src_index]);
+        bench_case.format         = formats[dst_index];
+        bench_case.setup          = BenchSetup_CopySource;
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * (BenchBytesPerPixel(formats[src_index]) + BenchBytesPerPixel(formats[dst_index]));
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageFormat;
+        BenchReport(options, &bench_case, formats[dst_index], &baseline);
+#endif
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageFormat;
+        BenchReport(options, &bench_case, formats[dst_index], &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.scratch);
+    }
+
+    BenchCase bench_case      = {0};
+    bench_case.routine        = "ImageAlphaPremultiply";
+    bench_case.src            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+    bench_case.setup          = BenchSetup_CopySource;
+    bench_case.pixels_per_run = size * size;
+    bench_case.bytes_per_run  = (double)size * size * 4 * 2;
+
+    double baseline = 0;
+#if BENCH_RAYLIB
+    bench_case.variant = "raylib";
+    bench_case.run     = BenchRun_ImageAlphaPremultiply;
+    BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+#endif
+    bench_case.variant = "SIMD";
+    bench_case.run     = BenchRun_RaylibSIMD_ImageAlphaPremultiply;
+    BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+    BenchUnloadImage(bench_case.src);
+    BenchUnloadImage(bench_case.scratch);
+}
+
+static void BenchColorAdjustments(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+    int const formats[]  = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5};
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    for (int format_index = 0; format_index < BENCH_COUNT(formats); format_index++)
+    {
+        int const size            = sizes[size_index];
+        int const format          = formats[format_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageColor chain";
+        bench_case.dst            = BenchGenImage(size, size, format);
+        bench_case.tint           = (Color){250, 240, 230, 255};
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * BenchBytesPerPixel(format) * 2;
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.run     = BenchRun_ImageColorChain;
+        BenchReport(options, &bench_case, format, &baseline);
+#endif
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageColorChain;
+        BenchReport(options, &bench_case, format, &baseline);
+
+        bench_case.variant = "SIMD Batched";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageColorChainBatched;
+        BenchReport(options, &bench_case, format, &baseline);
+
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchBlurs(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+    int const radii[]    = {2, 8, 32};
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    for (int radius_index = 0; radius_index < BENCH_COUNT(radii); radius_index++)
+    {
+        // NOTE: A drop shadow or blurred background, the radius in the tint
+        // column's place is reported in the routine name
+        static char const *const box_names[]      = {"ImageBlurBox r2", "ImageBlurBox r8", "ImageBlurBox r32"};
+        static char const *const gaussian_names[] = {"ImageBlurGaussian s0.7", "ImageBlurGaussian s2.7", "ImageBlurGaussian s10.7"};
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.radius         = (float)radii[radius_index];
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * 4 * 2;
+
+        double baseline = 0;
+        bench_case.routine = box_names[radius_index];
+        bench_case.variant = "Pixel loop";
+        bench_case.run     = BenchRun_ImageBlurBoxPixels;
+        if (size <= 1024) BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageBlurBox;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        // NOTE: Gaussians with the same kernel width, radius = 3 sigma
+        baseline           = 0;
+        bench_case.routine = gaussian_names[radius_index];
+        bench_case.radius  = radii[radius_index] / 3.0f + 0.01f;
+        bench_case.variant = "SIMD";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageBlurGaussian;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        if (radius_index == 0)
+        {
+            baseline           = 0;
+            bench_case.routine = "ImageSharpen s0.7";
+            bench_case.run     = BenchRun_RaylibSIMD_ImageSharpen;
+            BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        }
+
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchMipmaps(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageMipmaps";
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * 4 * (1 + 1 / 3.0);
+        RaylibSIMD_ImageMipmaps(&bench_case.dst);
+
+        double baseline = 0;
+#if BENCH_RAYLIB
+        bench_case.variant = "raylib";
+        bench_case.setup   = BenchSetup_BaseLevelOnly;
+        bench_case.run     = BenchRun_ImageMipmaps;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.setup   = NULL;
+#endif
+        bench_case.variant = "Pixel loop";
+        bench_case.run     = BenchRun_ImageMipmapsPixels;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.variant = "SIMD Box";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageMipmaps;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.variant = "SIMD BoxGamma";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageMipmapsGamma;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        bench_case.routine        = "ImageDraw mipmapped";
+        bench_case.src            = BenchGenImage(64, 64, UNCOMPRESSED_R8G8B8A8);
+        bench_case.src_rec        = (Rectangle){0, 0, 64, 64};
+        bench_case.dst_rec        = (Rectangle){size / 3.0f, size / 3.0f, 64, 64};
+        bench_case.tint           = (Color){255, 255, 255, 255};
+        bench_case.pixels_per_run = 64 * 64;
+        bench_case.bytes_per_run  = 64.0 * 64 * 4 * 3;
+
+        baseline           = 0;
+        bench_case.variant = "ImageMipmaps";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageDrawThenMipmaps;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.variant = "Levels updated";
+        bench_case.run     = BenchRun_RaylibSIMD_ImageDrawMipmapped;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.dst);
+    }
+}
+
+static void BenchScratch(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    {
+        int const size            = sizes[size_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "Temporary image";
+        bench_case.dst            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.tint           = (Color){10, 20, 30, 255};
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * 4;
+
+        double baseline    = 0;
+        bench_case.variant = "GenImageColor";
+        bench_case.run     = BenchRun_RaylibSIMD_GenImageColorTemporary;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+        bench_case.variant = "Scratch image";
+        bench_case.run     = BenchRun_RaylibSIMD_ScratchImageTemporary;
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.dst);
+    }
+    RaylibSIMD_ReleaseScratch();
+}
+
+static void BenchBlocks(BenchOptions const *options)
+{
+    int const *sizes     = options->quick ? BENCH_QUICK_SIZES : BENCH_SIZES;
+    int const size_count = options->quick ? BENCH_COUNT(BENCH_QUICK_SIZES) : BENCH_COUNT(BENCH_SIZES);
+    int const formats[]  = {COMPRESSED_DXT1_RGB, COMPRESSED_DXT5_RGBA};
+
+    for (int size_index = 0; size_index < size_count; size_index++)
+    for (int format_index = 0; format_index < BENCH_COUNT(formats); format_index++)
+    {
+        int const size            = sizes[size_index];
+        int const format          = formats[format_index];
+        BenchCase bench_case      = {0};
+        bench_case.routine        = "ImageFormat DXT";
+        bench_case.src            = BenchGenImage(size, size, UNCOMPRESSED_R8G8B8A8);
+        bench_case.dst            = BenchGenImage(size, size, format);
+        bench_case.format         = format;
+        bench_case.pixels_per_run = size * size;
+        bench_case.bytes_per_run  = (double)size * size * 4 + GetPixelDataSize(size, size, format);
+
+        double baseline    = 0;
+        bench_case.variant = "Block loop";
+        bench_case.run     = BenchRun_CompressBlocksScalar;
+        BenchReport(options, &bench_case, format, &baseline);
+        bench_case.variant = "SIMD";
+        bench_case.setup   = BenchSetup_CopySource;
+        bench_case.run     = BenchRun_RaylibSIMD_ImageFormat;
+        BenchReport(options, &bench_case, format, &baseline);
+        BenchUnloadImage(bench_case.scratch);
+
+        BenchUnloadImage(bench_case.src);
+        bench_case.src     = bench_case.dst;
+        bench_case.dst     = (Image){0};
+        bench_case.scratch = (Image){0};
+        bench_case.format  = UNCOMPRESSED_R8G8B8A8;
+        baseline           = 0;
+        bench_case.variant = "SIMD decode";
+        BenchReport(options, &bench_case, UNCOMPRESSED_R8G8B8A8, &baseline);
+
+        BenchUnloadImage(bench_case.src);
+        BenchUnloadImage(bench_case.scratch);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    BenchOptions options = {0};
+    options.threads      = 1;
+    for (int index = 1; index < argc; index++)
+    {
+        if (strcmp(argv[index], "--quick") == 0)                          options.quick   = true;
+        else if (strcmp(argv[index], "--csv") == 0)                       options.csv     = true;
+        else if (strcmp(argv[index], "--threads") == 0 && index + 1 < argc) options.threads = atoi(argv[++index]);
+        else if (strcmp(argv[index], "--filter") == 0 && index + 1 < argc)  options.filter  = argv[++index];
+        else
+        {
+            fprintf(stderr, "Usage: %s [--quick] [--threads N] [--filter text] [--csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+#if BENCH_RAYLIB
+    SetTraceLogLevel(LOG_WARNING);
+#endif
+    RaylibSIMD_SetWorkerCount(options.threads);
+
+    BenchPrintHeader(&options);
+    BenchImageDraw(&options);
+    BenchImageDrawScaled(&options);
+    BenchImageDrawRotated(&options);
+    BenchImageDrawMasked(&options);
+    BenchShapes(&options);
+    BenchFills(&options);
+    BenchConversions(&options);
+    BenchColorAdjustments(&options);
+    BenchBlurs(&options);
+    BenchMipmaps(&options);
+    BenchBlocks(&options);
+    BenchScratch(&options);
+
+    RaylibSIMD_SetWorkerCount(1);
+    return 0;
+}
@@ -0,0 +1,1907 @@
+// RaylibSIMD tests, checks the SIMD routines against the scalar reference in
+// the header. Built in standalone mode by CMakeLists.txt and run with ctest,
+// returns non-zero when a check fails.
+//
+// Usage: RaylibSIMDTest
+
+#if !defined(RAYLIB_SIMD_STANDALONE)
+    #define RAYLIB_SIMD_STANDALONE
+#endif
+#define RAYLIB_SIMD_IMPLEMENTATION
+#include "RaylibSIMD.h"
+
+#include <math.h>
+
+static int test_checks;
+static int test_failures;
+
+#define TEST_CHECK(expression, ...)                                       \
+    do                                                                    \
+    {                                                                     \
+        test_checks++;                                                    \
+        if (!(expression))                                                \
+        {                                                                 \
+            test_failures++;                                              \
+            fprintf(stderr, "%s:%d: FAILED %s: ", __FILE__, __LINE__, #expression); \
+            fprintf(stderr, __VA_ARGS__);                                 \
+            fprintf(stderr, "\n");                                        \
+        }                                                                 \
+    } while (0)
+
+// -----------------------------------------------------------------------------
+// Inputs
+// -----------------------------------------------------------------------------
+static unsigned int test_random_state = 0x2545F491;
+static unsigned char TestRandom8(void)
+{
+    test_random_state = test_random_state * 1103515245 + 12345;
+    return (unsigned char)(test_random_state >> 16);
+}
+
+// NOTE: Random bytes, valid for every 8 and 16 bit format. Float formats get
+// values in [0, 1].
+static Image TestGenImage(int width, int height, int format)
+{
+    Image result   = {0};
+    result.width   = width;
+    result.height  = height;
+    result.mipmaps = 1;
+    result.format  = format;
+
+    int const size = GetPixelDataSize(width, height, format);
+    result.data    = RL_MALLOC(size);
+    if (format >= UNCOMPRESSED_R32)
+    {
+        float *floats = (float *)result.data;
+        for (int index = 0; index < size / 4; index++) floats[index] = TestRandom8() / 255.f;
+    }
+    else
+    {
+        unsigned char *bytes = (unsigned char *)result.data;
+        for (int index = 0; index < size; index++) bytes[index] = TestRandom8();
+    }
+    return result;
+}
+
+static Image TestCopyImage(Image image)
+{
+    Image result   = image;
+    int const size = GetPixelDataSize(image.width, image.height, image.format);
+    result.data    = RL_MALLOC(size);
+    memcpy(result.data, image.data, size);
+    return result;
+}
+
+static bool TestImagesEqual(Image a, Image b)
+{
+    bool result = (a.width == b.width) && (a.height == b.height) && (a.format == b.format) &&
+                  memcmp(a.data, b.data, GetPixelDataSize(a.width, a.height, a.format)) == 0;
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+static void TestGenImageColor(void)
+{
+    Color const color = {12, 34, 56, 78};
+    int const sizes[] = {1, 3, 17, 64, 301};
+    for (int index = 0; index < 5; index++)
+    {
+        Image image = RaylibSIMD_GenImageColor(sizes[index], 7, color);
+        Color *pixels = (Color *)image.data;
+        int mismatches = 0;
+        for (int pixel = 0; pixel < image.width * image.height; pixel++)
+            mismatches += memcmp(pixels + pixel, &color, sizeof(color)) != 0;
+        TEST_CHECK(mismatches == 0, "width %d", sizes[index]);
+        RL_FREE(image.data);
+    }
+}
+
+// NOTE: Opaque fills replace the rectangle's pixels with SetPixelColor(color),
+// or the RaylibSIMD_ImageFormat encoding for float formats, and leave
+// everything else alone.
+static void TestImageDrawRectangleRec(void)
+{
+    int const formats[]        = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G5B5A1, UNCOMPRESSED_R4G4B4A4, UNCOMPRESSED_R8G8B8A8,
+                                  UNCOMPRESSED_R32, UNCOMPRESSED_R32G32B32, UNCOMPRESSED_R32G32B32A32};
+    Rectangle const rectangles[] = {{0, 0, 61, 19}, {3, 2, 1, 1}, {5, 1, 37, 11}, {-4, -3, 20, 9}, {50, 10, 40, 40}};
+    Color const color          = {200, 150, 100, 255};
+    float const channels[4]    = {200 / 255.f, 150 / 255.f, 100 / 255.f, 1.f};
+
+    for (int format_index = 0; format_index < (int)(sizeof(formats) / sizeof(formats[0])); format_index++)
+    for (int rect_index = 0; rect_index < 5; rect_index++)
+    {
+        int const format = formats[format_index];
+        int const bpp    = GetPixelDataSize(1, 1, format);
+        Image image      = TestGenImage(61, 19, format);
+        Image expected   = TestCopyImage(image);
+
+        Rectangle const rec = rectangles[rect_index];
+        for (int y = 0; y < expected.height; y++)
+        for (int x = 0; x < expected.width; x++)
+        {
+            bool inside = (x >= rec.x) && (x < rec.x + rec.width) && (y >= rec.y) && (y < rec.y + rec.height);
+            unsigned char *pixel = (unsigned char *)expected.data + (y * expected.width + x) * bpp;
+            if (inside && format >= UNCOMPRESSED_R32) RaylibSIMD__EncodePixel(channels, format, pixel);
+            else if (inside)                          SetPixelColor(pixel, color, format);
+        }
+
+        RaylibSIMD_ImageDrawRectangleRec(&image, rec, color);
+        TEST_CHECK(TestImagesEqual(image, expected), "format %d rectangle %d", format, rect_index);
+        RL_FREE(image.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: Fills past RS_STREAM_FILL_BYTES use non-temporal stores with masked
+// heads and tails, which must match the regular fill at every alignment.
+static void TestImageDrawRectangleRecStream(void)
+{
+    int const formats[]          = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R32G32B32};
+    Rectangle const rectangles[] = {{0, 0, 2400, 1800}, {1, 3, 2397, 1790}, {7, 0, 2393, 1800}};
+    Color const color            = {200, 150, 100, 255};
+
+    for (int format_index = 0; format_index < (int)(sizeof(formats) / sizeof(formats[0])); format_index++)
+    for (int rect_index = 0; rect_index < 3; rect_index++)
+    {
+        int const format    = formats[format_index];
+        int const bpp       = GetPixelDataSize(1, 1, format);
+        Rectangle const rec = rectangles[rect_index];
+        Image image         = TestGenImage(2400, 1800, format);
+        Image expected      = TestCopyImage(image);
+
+        // NOTE: Filled a row at a time, which stays under the streaming threshold
+        for (int y = (int)rec.y; y < (int)(rec.y + rec.height); y++)
+            RaylibSIMD_ImageDrawRectangleRec(&expected, (Rectangle){rec.x, (float)y, rec.width, 1}, color);
+
+        TEST_CHECK((size_t)(rec.width * rec.height * bpp) >= RS_STREAM_FILL_BYTES, "format %d rectangle %d streams", format, rect_index);
+        RaylibSIMD_ImageDrawRectangleRec(&image, rec, color);
+        TEST_CHECK(TestImagesEqual(image, expected), "format %d rectangle %d", format, rect_index);
+        RL_FREE(image.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: The SIMD conversion kernels match the scalar RaylibSIMD__ConvertPixels
+static void TestImageFormat(void)
+{
+    for (int src_format = UNCOMPRESSED_GRAYSCALE; src_format <= UNCOMPRESSED_R32G32B32A32; src_format++)
+    for (int dest_format = UNCOMPRESSED_GRAYSCALE; dest_format <= UNCOMPRESSED_R32G32B32A32; dest_format++)
+    {
+        if (src_format == dest_format) continue;
+
+        Image image    = TestGenImage(67, 5, src_format);
+        Image expected = image;
+        expected.format = dest_format;
+        expected.data   = RL_MALLOC(GetPixelDataSize(image.width, image.height, dest_format));
+        RaylibSIMD__ConvertPixels((unsigned char const *)image.data, src_format, (unsigned char *)expected.data, dest_format, image.width * image.height);
+
+        RaylibSIMD_ImageFormat(&image, dest_format);
+        TEST_CHECK(TestImagesEqual(image, expected), "%d to %d", src_format, dest_format);
+        RL_FREE(image.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: Fixed16 blends are bit-exact with RaylibSIMD__BlendPixelFixed16 at
+// every width, i.e. through every kernel and the scalar tail.
+static void TestImageDrawFixed16(void)
+{
+    Color const tints[] = {{255, 255, 255, 255}, {255, 255, 255, 128}, {200, 150, 100, 230}};
+    RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Fixed16);
+    for (int width = 1; width <= 67; width++)
+    for (int tint_index = 0; tint_index < 3; tint_index++)
+    {
+        Image src      = TestGenImage(width, 3, UNCOMPRESSED_R8G8B8A8);
+        Image dst      = TestGenImage(width, 3, UNCOMPRESSED_R8G8B8A8);
+        Image expected = TestCopyImage(dst);
+        for (int pixel = 0; pixel < width * 3; pixel++)
+            RaylibSIMD__BlendPixelFixed16((unsigned char *)src.data + pixel * 4, (unsigned char *)expected.data + pixel * 4, tints[tint_index]);
+
+        Rectangle const rec = {0, 0, (float)width, 3};
+        RaylibSIMD_ImageDraw(&dst, src, rec, rec, tints[tint_index]);
+        TEST_CHECK(TestImagesEqual(dst, expected), "width %d tint %d", width, tint_index);
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+        RL_FREE(expected.data);
+    }
+
+    // NOTE: A faint source over a faint dest, the exact color is 156.5 and
+    // rounding the source alpha weight to 8 bits gave 158
+    for (int width = 1; width <= 35; width += 17)
+    {
+        Image src = RaylibSIMD_GenImageColor(width, 1, (Color){0, 0, 0, 56});
+        Image dst = RaylibSIMD_GenImageColor(width, 1, (Color){255, 255, 255, 105});
+        Rectangle const rec = {0, 0, (float)width, 1};
+        RaylibSIMD_ImageDraw(&dst, src, rec, rec, (Color){255, 255, 255, 239});
+
+        bool matches = true;
+        for (int pixel = 0; pixel < width; pixel++)
+        {
+            unsigned char const *ptr = (unsigned char *)dst.data + pixel * 4;
+            matches = matches && ptr[0] == 156 && ptr[1] == 156 && ptr[2] == 156 && ptr[3] == 136;
+        }
+        TEST_CHECK(matches, "faint over faint width %d", width);
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+    }
+    RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Float);
+}
+
+// NOTE: The color blend modes are bit-exact with RaylibSIMD__BlendPixelMode at
+// every width, with runs of transparent and opaque source pixels for the alpha
+// block fast paths.
+static void TestImageDrawBlendModes(void)
+{
+    Color const tints[] = {{255, 255, 255, 255}, {255, 255, 255, 128}, {200, 150, 100, 230}, {90, 180, 255, 0}};
+    for (int mode = RaylibSIMD_BlendMode_Additive; mode <= RaylibSIMD_BlendMode_Copy; mode++)
+    for (int width = 1; width <= 67; width += 3)
+    for (int tint_index = 0; tint_index < 4; tint_index++)
+    {
+        Image src      = TestGenImage(width, 3, UNCOMPRESSED_R8G8B8A8);
+        Image dst      = TestGenImage(width, 3, UNCOMPRESSED_R8G8B8A8);
+        for (int pixel = 0; pixel < width * 3; pixel++)
+        {
+            unsigned char *ptr = (unsigned char *)src.data + pixel * 4;
+            if ((pixel / 16) % 3 == 0) ptr[3] = 0;
+            if ((pixel / 16) % 3 == 1) ptr[3] = 255;
+        }
+
+        Image expected = TestCopyImage(dst);
+        for (int pixel = 0; pixel < width * 3; pixel++)
+            RaylibSIMD__BlendPixelMode((unsigned char *)src.data + pixel * 4, (unsigned char *)expected.data + pixel * 4, tints[tint_index], (RaylibSIMD_BlendMode)mode);
+
+        Rectangle const rec = {0, 0, (float)width, 3};
+        RaylibSIMD_ImageDrawEx(&dst, src, rec, rec, tints[tint_index], (RaylibSIMD_BlendMode)mode);
+        TEST_CHECK(TestImagesEqual(dst, expected), "mode %d width %d tint %d", mode, width, tint_index);
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: Narrow draws blend mostly in the kernels' tails. Drawn into the middle
+// of a wider destination they must match the same draw onto an image of
+// exactly their size, and leave the pixels either side alone.
+static void TestImageDrawTail(void)
+{
+    int const formats[] = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R5G5B5A1, UNCOMPRESSED_R4G4B4A4, UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R32G32B32A32};
+    int const format_count = (int)(sizeof(formats) / sizeof(formats[0]));
+    Color const tint       = {255, 230, 200, 210};
+
+    for (int src_index = 0; src_index < format_count; src_index++)
+    for (int dest_index = 0; dest_index < format_count; dest_index++)
+    {
+        int const src_format  = formats[src_index];
+        int const dest_format = formats[dest_index];
+        int const bpp         = GetPixelDataSize(1, 1, dest_format);
+        bool matches          = true;
+        for (int width = 1; width <= 20; width++)
+        {
+            Image src      = TestGenImage(width, 2, src_format);
+            Image dst      = TestGenImage(24, 2, dest_format);
+            Image expected = TestCopyImage(dst);
+            Image exact    = TestGenImage(width, 2, dest_format);
+            for (int y = 0; y < 2; y++)
+                memcpy((unsigned char *)exact.data + y * width * bpp, (unsigned char *)dst.data + (y * 24 + 2) * bpp, width * bpp);
+
+            Rectangle const rec = {0, 0, (float)width, 2};
+            RaylibSIMD_ImageDraw(&exact, src, rec, rec, tint);
+            for (int y = 0; y < 2; y++)
+                memcpy((unsigned char *)expected.data + (y * 24 + 2) * bpp, (unsigned char *)exact.data + y * width * bpp, width * bpp);
+
+            RaylibSIMD_ImageDraw(&dst, src, rec, (Rectangle){2, 0, (float)width, 2}, tint);
+            matches = matches && TestImagesEqual(dst, expected);
+            RL_FREE(src.data);
+            RL_FREE(dst.data);
+            RL_FREE(expected.data);
+            RL_FREE(exact.data);
+        }
+        TEST_CHECK(matches, "format %d to %d", src_format, dest_format);
+    }
+}
+
+// NOTE: Unrotated, unscaled ImageDrawPro samples texel centers so it matches
+// ImageDraw with either filter, and quarter turns and flips are exact
+// permutations of the source pixels.
+static void TestImageDrawPro(void)
+{
+    Color const tint = {255, 220, 180, 200};
+    for (int filter = 0; filter < 2; filter++)
+    {
+        RaylibSIMD_SetScaleFilter(filter ? RaylibSIMD_ScaleFilter_Nearest : RaylibSIMD_ScaleFilter_Bilinear);
+        Image src        = TestGenImage(23, 9, UNCOMPRESSED_R8G8B8A8);
+        Image background = TestGenImage(40, 30, UNCOMPRESSED_R8G8B8A8);
+
+        // NOTE: Rotated by 90 degrees clockwise, flipped vertically
+        Image rotated = TestGenImage(9, 23, UNCOMPRESSED_R8G8B8A8);
+        Image flipped = TestGenImage(23, 9, UNCOMPRESSED_R8G8B8A8);
+        for (int y = 0; y < 9; y++)
+        for (int x = 0; x < 23; x++)
+        {
+            memcpy((unsigned char *)rotated.data + (x * 9 + (8 - y)) * 4, (unsigned char *)src.data + (y * 23 + x) * 4, 4);
+            memcpy((unsigned char *)flipped.data + ((8 - y) * 23 + x) * 4, (unsigned char *)src.data + (y * 23 + x) * 4, 4);
+        }
+
+        Rectangle const src_rec = {0, 0, 23, 9};
+        struct { Image image; Rectangle pro_src; Rectangle pro_dst; Vector2 origin; float rotation; Vector2 position; } const cases[] =
+        {
+            {src,     src_rec,        {5, 3, 23, 9},   {0, 0},   0.f, {5, 3}},
+            {src,     src_rec,        {-4, 25, 23, 9}, {0, 0},   0.f, {-4, 25}},
+            {rotated, src_rec,        {30, 2, 23, 9},  {0, 0},  90.f, {21, 2}},
+            {rotated, src_rec,        {20, 15, 23, 9}, {11, 4}, 90.f, {15, 4}},
+            {flipped, {0, 0, 23, -9}, {7, 11, 23, 9},  {0, 0},   0.f, {7, 11}},
+        };
+        for (int index = 0; index < (int)(sizeof(cases) / sizeof(cases[0])); index++)
+        {
+            Image expected = TestCopyImage(background);
+            Image result   = TestCopyImage(background);
+            Image image    = cases[index].image;
+            RaylibSIMD_ImageDraw(&expected, image, (Rectangle){0, 0, (float)image.width, (float)image.height},
+                                 (Rectangle){cases[index].position.x, cases[index].position.y, (float)image.width, (float)image.height}, tint);
+            RaylibSIMD_ImageDrawPro(&result, src, cases[index].pro_src, cases[index].pro_dst, cases[index].origin, cases[index].rotation, tint);
+            TEST_CHECK(TestImagesEqual(result, expected), "filter %d case %d", filter, index);
+            RL_FREE(expected.data);
+            RL_FREE(result.data);
+        }
+
+        // NOTE: Whole spans go through the AVX2 gathers, single pixels don't
+        RaylibSIMD__AffineSampler sampler = {0};
+        sampler.src_data                  = (unsigned char const *)src.data;
+        sampler.src_format                = src.format;
+        sampler.filter                    = filter ? RaylibSIMD_ScaleFilter_Nearest : RaylibSIMD_ScaleFilter_Bilinear;
+        sampler.src_bytes_per_pixel       = 4;
+        sampler.src_stride                = 23 * 4;
+        sampler.src_width                 = 23;
+        sampler.src_height                = 9;
+        sampler.u_16_16                   = -20 * 65536;
+        sampler.u_step_x_16_16            = 54321;
+        sampler.v_step_x_16_16            = 12345;
+        sampler.v_step_y_16_16            = 65536;
+        unsigned char span[64 * 4], pixel[4];
+        bool matches = true;
+        for (int y = 0; y < 9; y++)
+        {
+            int x0 = 0, x1 = 64;
+            RaylibSIMD__AffineSpan(&sampler, y, &x0, &x1);
+            RaylibSIMD__SampleAffineSpan(&sampler, x0, y, x1 - x0, span);
+            for (int x = x0; x < x1; x++)
+            {
+                RaylibSIMD__SampleAffineSpan(&sampler, x, y, 1, pixel);
+                matches = matches && (memcmp(span + (x - x0) * 4, pixel, 4) == 0);
+            }
+        }
+        TEST_CHECK(matches, "filter %d spans", filter);
+
+        RL_FREE(src.data);
+        RL_FREE(background.data);
+        RL_FREE(rotated.data);
+        RL_FREE(flipped.data);
+    }
+    RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Bilinear);
+}
+
+// NOTE: Masked draws match drawing an R8G8B8A8 copy of the source (or of the
+// color) with the coverage multiplied into alpha, through every mask format,
+// kernel tail and span split. Masks have runs of zero and full coverage.
+static void TestImageDrawMasked(void)
+{
+    int const mask_formats[] = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R8G8B8A8};
+    int const src_formats[]  = {-1, UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_GRAY_ALPHA}; // -1 draws a color
+    int const dest_formats[] = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R5G6B5};
+    int const widths[]       = {1, 3, 4, 7, 16, 37, 130};
+    Color const color        = {220, 120, 40, 200};
+    Color const tint         = {255, 200, 255, 180};
+
+    for (int mask_index = 0; mask_index < 3; mask_index++)
+    for (int src_index = 0; src_index < 4; src_index++)
+    for (int dest_index = 0; dest_index < 2; dest_index++)
+    for (int width_index = 0; width_index < 7; width_index++)
+    {
+        int const width      = widths[width_index];
+        int const src_format = src_formats[src_index];
+        Image mask           = TestGenImage(width + 3, 5, mask_formats[mask_index]);
+        Image src            = TestGenImage(width + 1, 4, (src_format < 0) ? UNCOMPRESSED_R8G8B8A8 : src_format);
+        Image dst            = TestGenImage(width + 4, 6, dest_formats[dest_index]);
+        Image expected       = TestCopyImage(dst);
+        int const mask_bpp   = GetPixelDataSize(1, 1, mask.format);
+        for (int pixel = 0; pixel < mask.width * mask.height; pixel++)
+        {
+            unsigned char *coverage = (unsigned char *)mask.data + pixel * mask_bpp + mask_bpp - 1;
+            if ((pixel / 8) % 3 == 0) *coverage = 0;
+            if ((pixel / 8) % 3 == 1) *coverage = 255;
+        }
+
+        // NOTE: Reference, mask rectangle (2, 1) and source rectangle (1, 1)
+        // of size width x 3 drawn at (-1, 2)
+        Image masked   = TestGenImage(width, 3, UNCOMPRESSED_R8G8B8A8);
+        Image src_rgba = TestCopyImage(src);
+        RaylibSIMD_ImageFormat(&src_rgba, UNCOMPRESSED_R8G8B8A8);
+        for (int y = 0; y < 3; y++)
+        for (int x = 0; x < width; x++)
+        {
+            unsigned char *out              = (unsigned char *)masked.data + (y * width + x) * 4;
+            unsigned char const *mask_pixel = (unsigned char const *)mask.data + ((y + 1) * mask.width + x + 2) * mask_bpp;
+            unsigned char const *src_pixel  = (unsigned char const *)src_rgba.data + ((y + 1) * src.width + x + 1) * 4;
+            unsigned char const *pixel      = (src_format < 0) ? &color.r : src_pixel;
+            unsigned int const coverage     = mask_pixel[mask_bpp - 1];
+            memcpy(out, pixel, 3);
+            out[3] = (unsigned char)(((pixel[3] * coverage + 128) * 257) >> 16);
+        }
+        Vector2 const position = {-1, 2};
+        RaylibSIMD_ImageDraw(&expected, masked, (Rectangle){0, 0, (float)width, 3}, (Rectangle){-1, 2, (float)width, 3}, (src_format < 0) ? (Color){255, 255, 255, 255} : tint);
+
+        if (src_format < 0) RaylibSIMD_ImageDrawColorMasked(&dst, mask, (Rectangle){2, 1, (float)width, 3}, position, color);
+        else                RaylibSIMD_ImageDrawMasked(&dst, src, (Rectangle){1, 1, (float)width + 5, 3}, mask, (Rectangle){2, 1, (float)width, 3}, position, tint);
+        TEST_CHECK(TestImagesEqual(dst, expected), "mask %d src %d dest %d width %d", mask_index, src_index, dest_index, width);
+
+        RL_FREE(mask.data);
+        RL_FREE(src.data);
+        RL_FREE(src_rgba.data);
+        RL_FREE(masked.data);
+        RL_FREE(dst.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: Nearest 2x upscale of a glyph, the reference for text drawn at twice
+// the font size
+static Image TestUpscale2x(Image image)
+{
+    int const bpp  = GetPixelDataSize(1, 1, image.format);
+    Image result   = TestGenImage(image.width * 2, image.height * 2, image.format);
+    for (int y = 0; y < result.height; y++)
+    for (int x = 0; x < result.width; x++)
+        memcpy((unsigned char *)result.data + (y * result.width + x) * bpp, (unsigned char *)image.data + ((y / 2) * image.width + x / 2) * bpp, bpp);
+    return result;
+}
+
+// NOTE: A font of the codepoints 32 to 66 with glyphs for 'A', 'B' and '?'.
+// Text is laid out like DrawTextEx and every glyph is drawn as a color mask.
+static void TestImageDrawText(void)
+{
+    CharInfo chars[35] = {0};
+    for (int index = 0; index < 35; index++) chars[index].value = 32 + index;
+    chars[0]          = (CharInfo){' ', 0, 0, 4, {0}};
+    chars['?' - 32]   = (CharInfo){'?', 0, 3, 5, TestGenImage(4, 7, UNCOMPRESSED_GRAY_ALPHA)};
+    chars['A' - 32]   = (CharInfo){'A', 1, 2, 7, TestGenImage(6, 8, UNCOMPRESSED_GRAY_ALPHA)};
+    chars['B' - 32]   = (CharInfo){'B', 0, 1, 0, TestGenImage(5, 9, UNCOMPRESSED_GRAYSCALE)};
+    Font const font   = {10, 35, {0}, NULL, chars};
+    Color const color = {250, 200, 20, 230};
+
+    // NOTE: "AB A" then "B" and a missing glyph drawn as '?' on the next line
+    // 15 pixels lower, at (3, 4) with a spacing of 2
+    Image dst      = TestGenImage(48, 34, UNCOMPRESSED_R8G8B8A8);
+    Image expected = TestCopyImage(dst);
+    int const glyphs[5][3] = {{'A', 4, 6}, {'B', 12, 5}, {'A', 26, 6}, {'B', 3, 20}, {'?', 10, 22}};
+    for (int glyph = 0; glyph < 5; glyph++)
+    {
+        Image const image = chars[glyphs[glyph][0] - 32].image;
+        RaylibSIMD_ImageDrawColorMasked(&expected, image, (Rectangle){0, 0, (float)image.width, (float)image.height}, (Vector2){(float)glyphs[glyph][1], (float)glyphs[glyph][2]}, color);
+    }
+
+    char const *text       = "AB A\nB\xC3\xA9";
+    RaylibSIMD_TextRun run = RaylibSIMD_LoadTextRun(font, text, 10, 2);
+    TEST_CHECK(run.glyphCount == 5, "glyph count %d", run.glyphCount);
+    TEST_CHECK(run.size.x == 29 && run.size.y == 25, "size %g x %g", run.size.x, run.size.y);
+    RaylibSIMD_ImageDrawTextEx(&dst, (Vector2){3, 4}, font, text, 10, 2, color);
+    TEST_CHECK(TestImagesEqual(dst, expected), "text");
+    RaylibSIMD_UnloadTextRun(run);
+
+    // NOTE: Twice the font size, glyph rectangles and offsets scale but the
+    // spacing doesn't
+    RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Nearest);
+    Image large_a = TestUpscale2x(chars['A' - 32].image);
+    Image large_b = TestUpscale2x(chars['B' - 32].image);
+    Image large   = TestCopyImage(dst);
+    RaylibSIMD_ImageDrawColorMasked(&expected, large_a, (Rectangle){0, 0, 12, 16}, (Vector2){2, 4}, color);
+    RaylibSIMD_ImageDrawColorMasked(&expected, large_b, (Rectangle){0, 0, 10, 18}, (Vector2){16, 2}, color);
+    run = RaylibSIMD_LoadTextRun(font, "AB", 20, 2);
+    RaylibSIMD_ImageDrawTextRun(&large, font, run, (Vector2){0, 0}, color);
+    TEST_CHECK(TestImagesEqual(large, expected), "text 2x");
+    RaylibSIMD_UnloadTextRun(run);
+    RaylibSIMD_SetScaleFilter(RaylibSIMD_ScaleFilter_Bilinear);
+
+    RL_FREE(large_a.data);
+    RL_FREE(large_b.data);
+    RL_FREE(large.data);
+    RL_FREE(expected.data);
+    RL_FREE(dst.data);
+    for (int index = 0; index < 35; index++) RL_FREE(chars[index].image.data);
+}
+
+// NOTE: Aliased primitives set the pixels whose center is inside, checked
+// against the pixel sets they are documented to cover
+static void TestImageDrawShapes(void)
+{
+    int const formats[]  = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R8G8B8A8};
+    Color const color    = {30, 200, 90, 160};
+    int const circles[4][3] = {{12, 9, 0}, {12, 9, 1}, {20, 11, 6}, {3, 17, 9}}; // x, y, radius
+
+    for (int format_index = 0; format_index < 4; format_index++)
+    {
+        int const format = formats[format_index];
+        int const bpp    = GetPixelDataSize(1, 1, format);
+        for (int circle = 0; circle < 4; circle++)
+        for (int lines = 0; lines <= 1; lines++)
+        {
+            int const center_x = circles[circle][0], center_y = circles[circle][1], radius = circles[circle][2];
+            if (lines && (radius == 0)) continue;
+
+            Image image    = TestGenImage(37, 23, format);
+            Image expected = TestCopyImage(image);
+            for (int y = 0; y < image.height; y++)
+            for (int x = 0; x < image.width; x++)
+            {
+                int const distance = (x - center_x) * (x - center_x) + (y - center_y) * (y - center_y);
+                bool const inside  = (distance <= radius * radius + radius) && (!lines || (distance > radius * radius - radius));
+                if (inside) SetPixelColor((unsigned char *)expected.data + (y * image.width + x) * bpp, color, format);
+            }
+            if (lines) RaylibSIMD_ImageDrawCircleLines(&image, center_x, center_y, radius, color);
+            else       RaylibSIMD_ImageDrawCircle(&image, center_x, center_y, radius, color);
+            TEST_CHECK(TestImagesEqual(image, expected), "format %d circle %d lines %d", format, circle, lines);
+            RL_FREE(image.data);
+            RL_FREE(expected.data);
+        }
+
+        // NOTE: Rectangle lines are 4 rectangles inside rec, or all of it when
+        // they meet
+        for (int thick = 1; thick <= 6; thick += 5)
+        {
+            Rectangle const rec = {-2, 3, 30, 11};
+            Image image         = TestGenImage(37, 23, format);
+            Image expected      = TestCopyImage(image);
+            RaylibSIMD_ImageDrawRectangle(&expected, -2, 3, 30, thick, color);
+            RaylibSIMD_ImageDrawRectangle(&expected, -2, 14 - thick, 30, thick, color);
+            RaylibSIMD_ImageDrawRectangle(&expected, -2, 3, thick, 11, color);
+            RaylibSIMD_ImageDrawRectangle(&expected, 28 - thick, 3, thick, 11, color);
+            RaylibSIMD_ImageDrawRectangleLines(&image, rec, thick, color);
+            TEST_CHECK(TestImagesEqual(image, expected), "format %d rectangle lines %d", format, thick);
+            RL_FREE(image.data);
+            RL_FREE(expected.data);
+        }
+
+        // NOTE: Horizontal, vertical and diagonal lines in both directions
+        // set the same pixels as Bresenham's, endpoints included
+        int const line_list[6][4] = {{2, 3, 20, 3}, {20, 5, 2, 5}, {7, 1, 7, 21}, {1, 1, 12, 12}, {30, 2, 12, 20}, {33, 19, 33, 19}};
+        for (int line = 0; line < 6; line++)
+        {
+            int const *points = line_list[line];
+            int const steps   = RS_MAX(abs(points[2] - points[0]), abs(points[3] - points[1]));
+            Image image       = TestGenImage(37, 23, format);
+            Image expected    = TestCopyImage(image);
+            for (int step = 0; step <= steps; step++)
+            {
+                int const x = points[0] + (steps ? (points[2] - points[0]) * step / steps : 0);
+                int const y = points[1] + (steps ? (points[3] - points[1]) * step / steps : 0);
+                SetPixelColor((unsigned char *)expected.data + (y * image.width + x) * bpp, color, format);
+            }
+            RaylibSIMD_ImageDrawLine(&image, points[0], points[1], points[2], points[3], color);
+            TEST_CHECK(TestImagesEqual(image, expected), "format %d line %d", format, line);
+            RL_FREE(image.data);
+            RL_FREE(expected.data);
+        }
+
+        // NOTE: Triangles in both winding orders, no pixel center is on an edge
+        Vector2 const vertices[3] = {{3.3f, 2.1f}, {33.7f, 9.4f}, {8.2f, 21.6f}};
+        for (int winding = 0; winding <= 1; winding++)
+        {
+            Image image    = TestGenImage(37, 23, format);
+            Image expected = TestCopyImage(image);
+            for (int y = 0; y < image.height; y++)
+            for (int x = 0; x < image.width; x++)
+            {
+                bool inside = true;
+                for (int edge = 0; edge < 3; edge++)
+                {
+                    Vector2 const a = vertices[edge], b = vertices[(edge + 1) % 3];
+                    inside          = inside && ((b.x - a.x) * (y + 0.5 - a.y) - (b.y - a.y) * (x + 0.5 - a.x) > 0);
+                }
+                if (inside) SetPixelColor((unsigned char *)expected.data + (y * image.width + x) * bpp, color, format);
+            }
+            if (winding) RaylibSIMD_ImageDrawTriangle(&image, vertices[0], vertices[1], vertices[2], color);
+            else         RaylibSIMD_ImageDrawTriangle(&image, vertices[2], vertices[1], vertices[0], color);
+            TEST_CHECK(TestImagesEqual(image, expected), "format %d triangle winding %d", format, winding);
+            RL_FREE(image.data);
+            RL_FREE(expected.data);
+        }
+    }
+}
+
+static double TestRoundedBoxDistance(double x0, double y0, double x1, double y1, double radius, double x, double y)
+{
+    double const qx = fabs(x - (x0 + x1) / 2) - (x1 - x0) / 2 + radius;
+    double const qy = fabs(y - (y0 + y1) / 2) - (y1 - y0) / 2 + radius;
+    return sqrt(fmax(qx, 0) * fmax(qx, 0) + fmax(qy, 0) * fmax(qy, 0)) + fmin(fmax(qx, qy), 0) - radius;
+}
+
+// NOTE: Largest distance to the lines of a convex polygon and of its bounding
+// box, see RaylibSIMD__Shape
+static double TestPolygonDistance(Vector2 const *points, int count, double x, double y)
+{
+    double area  = 0;
+    double min_x = points[0].x, max_x = points[0].x, min_y = points[0].y, max_y = points[0].y;
+    for (int index = 0; index < count; index++)
+    {
+        Vector2 const a = points[index], b = points[(index + 1) % count];
+        area           += (double)a.x * b.y - (double)b.x * a.y;
+        min_x = fmin(min_x, a.x); max_x = fmax(max_x, a.x);
+        min_y = fmin(min_y, a.y); max_y = fmax(max_y, a.y);
+    }
+
+    double result = fmax(fmax(min_x - x, x - max_x), fmax(min_y - y, y - max_y));
+    for (int index = 0; index < count; index++)
+    {
+        Vector2 const a = points[index], b = points[(index + 1) % count];
+        double const dx = (double)b.x - a.x, dy = (double)b.y - a.y;
+        result          = fmax(result, (area > 0 ? 1 : -1) * (dy * (x - a.x) - dx * (y - a.y)) / sqrt(dx * dx + dy * dy));
+    }
+    return result;
+}
+
+// NOTE: White drawn onto transparent black leaves the coverage in the alpha,
+// checked against the distances in double precision. Fully covered pixels are
+// filled and partly covered ones built by the SIMD coverage kernel.
+static void TestImageDrawShapesAntialiased(void)
+{
+    Color const white         = {255, 255, 255, 255};
+    Vector2 const triangle[3] = {{3.3f, 2.1f}, {8.2f, 29.6f}, {47.7f, 9.4f}};
+    double const length       = sqrt(43 * 43 + 24 * 24);
+    double const normal_x     = 24 / length * 1.25, normal_y = 43 / length * 1.25; // Of the line from (2, 28) to (45, 4), 2.5 thick
+    Vector2 const quad[4]     = {{(float)(2 + normal_x), (float)(28 + normal_y)}, {(float)(45 + normal_x), (float)(4 + normal_y)},
+                                 {(float)(45 - normal_x), (float)(4 - normal_y)}, {(float)(2 - normal_x), (float)(28 - normal_y)}};
+
+    RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges_Antialiased);
+    for (int shape = 0; shape < 4; shape++)
+    {
+        Image image = TestGenImage(53, 34, UNCOMPRESSED_R8G8B8A8);
+        memset(image.data, 0, 53 * 34 * 4);
+        switch (shape)
+        {
+            case 0: RaylibSIMD_ImageDrawCircleV(&image, (Vector2){20.3f, 15.7f}, 9.6f, white); break;
+            case 1: RaylibSIMD_ImageDrawRectangleRoundedLines(&image, (Rectangle){4.5f, 3.25f, 40, 25}, 0.6f, 3, white); break;
+            case 2: RaylibSIMD_ImageDrawTriangle(&image, triangle[0], triangle[1], triangle[2], white); break;
+            case 3: RaylibSIMD_ImageDrawLineEx(&image, (Vector2){2, 28}, (Vector2){45, 4}, 2.5f, white); break;
+        }
+
+        int max_error = 0;
+        for (int y = 0; y < image.height; y++)
+        for (int x = 0; x < image.width; x++)
+        {
+            double const center_x = x + 0.5, center_y = y + 0.5;
+            double distance       = 0;
+            switch (shape)
+            {
+                case 0: distance = TestRoundedBoxDistance(20.3 - 9.6, 15.7 - 9.6, 20.3 + 9.6, 15.7 + 9.6, 9.6, center_x, center_y); break;
+                case 1: distance = fmax(TestRoundedBoxDistance(4.5, 3.25, 44.5, 28.25, 7.5, center_x, center_y),
+                                        -TestRoundedBoxDistance(7.5, 6.25, 41.5, 25.25, 4.5, center_x, center_y)); break;
+                case 2: distance = TestPolygonDistance(triangle, 3, center_x, center_y); break;
+                case 3: distance = TestPolygonDistance(quad, 4, center_x, center_y); break;
+            }
+            int const expected = (int)(fmin(fmax(0.5 - distance, 0), 1) * 255 + 0.5);
+            int const alpha    = ((unsigned char *)image.data)[(y * image.width + x) * 4 + 3];
+            max_error          = RS_MAX(max_error, abs(alpha - expected));
+        }
+        TEST_CHECK(max_error <= 1, "shape %d max coverage error %d", shape, max_error);
+        RL_FREE(image.data);
+    }
+
+    // NOTE: Edges on pixel boundaries are the same as aliased ones
+    Image image    = TestGenImage(40, 30, UNCOMPRESSED_R8G8B8);
+    Image expected = TestCopyImage(image);
+    RaylibSIMD_ImageDrawRectangleLines(&image, (Rectangle){3, 4, 30, 20}, 4, white);
+    RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges_Aliased);
+    RaylibSIMD_ImageDrawRectangleLines(&expected, (Rectangle){3, 4, 30, 20}, 4, white);
+    TEST_CHECK(TestImagesEqual(image, expected), "pixel aligned rectangle lines");
+    RL_FREE(image.data);
+    RL_FREE(expected.data);
+}
+
+// NOTE: raylib's ImageColor* loops on R8G8B8A8 pixels, as references for the
+// adjustments which run them on every format through an R8G8B8A8 round trip.
+typedef enum
+{
+    TestColorAdjust_Tint,
+    TestColorAdjust_Brightness,
+    TestColorAdjust_Contrast,
+    TestColorAdjust_Grayscale,
+    TestColorAdjust_Invert,
+    TestColorAdjust_Replace,
+    TestColorAdjust_Count,
+} TestColorAdjust;
+
+typedef struct
+{
+    TestColorAdjust adjust;
+    Color           color;
+    Color           replace;
+    int             amount;
+} TestColorOp;
+
+static void TestColorOpReference(Image *image, TestColorOp const *op)
+{
+    Color *pixels = (Color *)image->data;
+    float contrast = (100.0f + op->amount) / 100.0f;
+    contrast *= contrast;
+    for (int index = 0; index < image->width * image->height; index++)
+    {
+        Color *pixel = pixels + index;
+        switch (op->adjust)
+        {
+            case TestColorAdjust_Tint:
+                pixel->r = (unsigned char)(((float)pixel->r / 255 * ((float)op->color.r / 255)) * 255.0f);
+                pixel->g = (unsigned char)(((float)pixel->g / 255 * ((float)op->color.g / 255)) * 255.0f);
+                pixel->b = (unsigned char)(((float)pixel->b / 255 * ((float)op->color.b / 255)) * 255.0f);
+                pixel->a = (unsigned char)(((float)pixel->a / 255 * ((float)op->color.a / 255)) * 255.0f);
+                break;
+            case TestColorAdjust_Brightness:
+                pixel->r = (unsigned char)RS_MIN(RS_MAX(pixel->r + op->amount, 0), 255);
+                pixel->g = (unsigned char)RS_MIN(RS_MAX(pixel->g + op->amount, 0), 255);
+                pixel->b = (unsigned char)RS_MIN(RS_MAX(pixel->b + op->amount, 0), 255);
+                break;
+            case TestColorAdjust_Contrast:
+                for (int channel = 0; channel < 3; channel++)
+                {
+                    float value = (float)(&pixel->r)[channel] / 255.0f;
+                    value -= 0.5f;
+                    value *= contrast;
+                    value += 0.5f;
+                    value *= 255;
+                    (&pixel->r)[channel] = (unsigned char)RS_MIN(RS_MAX(value, 0.0f), 255.0f);
+                }
+                break;
+            case TestColorAdjust_Grayscale:
+                pixel->r = pixel->g = pixel->b = (unsigned char)(((float)pixel->r / 255.0f * 0.299f + (float)pixel->g / 255.0f * 0.587f + (float)pixel->b / 255.0f * 0.114f) * 255.0f);
+                break;
+            case TestColorAdjust_Invert:
+                pixel->r = 255 - pixel->r;
+                pixel->g = 255 - pixel->g;
+                pixel->b = 255 - pixel->b;
+                break;
+            case TestColorAdjust_Replace:
+                if (memcmp(pixel, &op->color, 4) == 0) *pixel = op->replace;
+                break;
+            default: break;
+        }
+    }
+}
+
+static void TestColorOpRun(Image *image, TestColorOp const *op)
+{
+    switch (op->adjust)
+    {
+        case TestColorAdjust_Tint:       RaylibSIMD_ImageColorTint(image, op->color);                   break;
+        case TestColorAdjust_Brightness: RaylibSIMD_ImageColorBrightness(image, op->amount);            break;
+        case TestColorAdjust_Contrast:   RaylibSIMD_ImageColorContrast(image, (float)op->amount);       break;
+        case TestColorAdjust_Grayscale:  RaylibSIMD_ImageColorGrayscale(image);                         break;
+        case TestColorAdjust_Invert:     RaylibSIMD_ImageColorInvert(image);                            break;
+        case TestColorAdjust_Replace:    RaylibSIMD_ImageColorReplace(image, op->color, op->replace);   break;
+        default: break;
+    }
+}
+
+// NOTE: Each adjustment matches the raylib loop between R8G8B8A8 round trips
+// at widths through the kernels and the scalar tail, and adjustments chained
+// in a batch match the loops run back to back within a single round trip.
+static void TestImageColorAdjustments(void)
+{
+    int const formats[] = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R4G4B4A4, UNCOMPRESSED_R32G32B32A32};
+    int const widths[]  = {1, 7, 130, 261};
+    for (int format_index = 0; format_index < 6; format_index++)
+    for (int width_index = 0; width_index < 4; width_index++)
+    {
+        int const format          = formats[format_index];
+        Image image               = TestGenImage(widths[width_index], 3, format);
+        int const bytes_per_pixel = GetPixelDataSize(1, 1, format);
+        for (int pixel = 3; pixel < image.width * image.height; pixel += 3)
+            memcpy((unsigned char *)image.data + pixel * bytes_per_pixel, image.data, bytes_per_pixel);
+
+        // NOTE: Replace the decoded first pixel, which every third pixel repeats
+        Image first = TestCopyImage(image);
+        RaylibSIMD_ImageFormat(&first, UNCOMPRESSED_R8G8B8A8);
+        Color const target = ((Color *)first.data)[0];
+        RL_FREE(first.data);
+
+        TestColorOp const ops[] =
+        {
+            {TestColorAdjust_Tint,       {200, 150, 255, 90}, {0}, 0},
+            {TestColorAdjust_Brightness, {0},                 {0}, -37},
+            {TestColorAdjust_Contrast,   {0},                 {0}, 45},
+            {TestColorAdjust_Grayscale,  {0},                 {0}, 0},
+            {TestColorAdjust_Invert,     {0},                 {0}, 0},
+            {TestColorAdjust_Replace,    target,              {1, 2, 3, 4}, 0},
+        };
+
+        for (int op = 0; op < TestColorAdjust_Count; op++)
+        {
+            Image result   = TestCopyImage(image);
+            Image expected = TestCopyImage(image);
+            TestColorOpRun(&result, ops + op);
+            RaylibSIMD_ImageFormat(&expected, UNCOMPRESSED_R8G8B8A8);
+            TestColorOpReference(&expected, ops + op);
+            RaylibSIMD_ImageFormat(&expected, format);
+            TEST_CHECK(TestImagesEqual(result, expected), "adjustment %d format %d width %d", op, format, image.width);
+            RL_FREE(result.data);
+            RL_FREE(expected.data);
+        }
+
+        Image result   = TestCopyImage(image);
+        Image expected = TestCopyImage(image);
+        RaylibSIMD_BeginBatch(&result);
+        for (int op = TestColorAdjust_Count - 1; op >= 0; op--) TestColorOpRun(&result, ops + op);
+        RaylibSIMD_EndBatch();
+        RaylibSIMD_ImageFormat(&expected, UNCOMPRESSED_R8G8B8A8);
+        for (int op = TestColorAdjust_Count - 1; op >= 0; op--) TestColorOpReference(&expected, ops + op);
+        RaylibSIMD_ImageFormat(&expected, format);
+        TEST_CHECK(TestImagesEqual(result, expected), "chain format %d width %d", format, image.width);
+        RL_FREE(result.data);
+        RL_FREE(expected.data);
+        RL_FREE(image.data);
+    }
+}
+
+// NOTE: Separable convolution in double precision with the edges repeated, of
+// the channels of R8G8B8A8 or R32G32B32A32 pixels, and optionally the unsharp
+// mask original + (original - filtered) * sharpen.
+static double *TestConvolveReference(Image image, double const *kernel_x, int radius_x, double const *kernel_y, int radius_y, double sharpen)
+{
+    int const width  = image.width, height = image.height;
+    double *in       = (double *)RL_MALLOC(sizeof(double) * width * height * 4);
+    double *mid      = (double *)RL_MALLOC(sizeof(double) * width * height * 4);
+    double *out      = (double *)RL_MALLOC(sizeof(double) * width * height * 4);
+    for (int index = 0; index < width * height * 4; index++)
+        in[index] = (image.format == UNCOMPRESSED_R8G8B8A8) ? ((unsigned char *)image.data)[index] : ((float *)image.data)[index];
+
+    for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+    for (int channel = 0; channel < 4; channel++)
+    {
+        double sum = 0;
+        for (int tap = -radius_x; tap <= radius_x; tap++)
+            sum += kernel_x[tap + radius_x] * in[(y * width + RS_MIN(RS_MAX(x + tap, 0), width - 1)) * 4 + channel];
+        mid[(y * width + x) * 4 + channel] = sum;
+    }
+
+    for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++)
+    for (int channel = 0; channel < 4; channel++)
+    {
+        double sum = 0;
+        for (int tap = -radius_y; tap <= radius_y; tap++)
+            sum += kernel_y[tap + radius_y] * mid[(RS_MIN(RS_MAX(y + tap, 0), height - 1) * width + x) * 4 + channel];
+        int const index = (y * width + x) * 4 + channel;
+        out[index]      = (sharpen != 0) ? in[index] + (in[index] - sum) * sharpen : sum;
+    }
+
+    RL_FREE(in);
+    RL_FREE(mid);
+    return out;
+}
+
+// NOTE: Max error of R8G8B8A8 or R32G32B32A32 pixels against the reference,
+// which 8 bit channels are clamped to and rounded
+static double TestConvolveError(Image image, double const *reference)
+{
+    double result = 0;
+    for (int index = 0; index < image.width * image.height * 4; index++)
+    {
+        double const expected = (image.format == UNCOMPRESSED_R8G8B8A8) ? floor(RS_MIN(RS_MAX(reference[index], 0.0), 255.0) + 0.5) : reference[index];
+        double const actual   = (image.format == UNCOMPRESSED_R8G8B8A8) ? ((unsigned char *)image.data)[index] : ((float *)image.data)[index];
+        result                = RS_MAX(result, fabs(actual - expected));
+    }
+    return result;
+}
+
+static void TestGaussianKernel(double sigma, double *kernel, int *radius)
+{
+    *radius      = (int)ceil(3 * sigma);
+    double total = 0;
+    for (int tap = -*radius; tap <= *radius; tap++) total += kernel[tap + *radius] = exp(-tap * tap / (2 * sigma * sigma));
+    for (int tap = 0; tap <= 2 * *radius; tap++) kernel[tap] /= total;
+}
+
+// NOTE: Box, Gaussian, sharpen and arbitrary kernels against the double
+// precision reference across tile edges and with radii past the image size,
+// other formats against a convolution of their R8G8B8A8 conversion.
+static void TestImageConvolve(void)
+{
+    static double box[2 * 1000 + 1];
+    double gaussian[2 * 64 + 1];
+    for (int tap = 0; tap < 2 * 1000 + 1; tap++) box[tap] = 1.0;
+
+    int const sizes[][2] = {{300, 150}, {37, 23}, {1, 5}};
+    for (int size = 0; size < 3; size++)
+    for (int float_format = 0; float_format <= 1; float_format++)
+    {
+        Image const image = TestGenImage(sizes[size][0], sizes[size][1], float_format ? UNCOMPRESSED_R32G32B32A32 : UNCOMPRESSED_R8G8B8A8);
+        double const tolerance = float_format ? 1e-5 : 1;
+
+        int const radii[] = {1, 7, 30, 1000};
+        for (int radius_index = 0; radius_index < 4; radius_index++)
+        {
+            int const radius = radii[radius_index];
+            static double kernel[2 * 1000 + 1];
+            for (int tap = 0; tap < 2 * radius + 1; tap++) kernel[tap] = box[tap] / (2 * radius + 1);
+            Image result      = TestCopyImage(image);
+            double *reference = TestConvolveReference(image, kernel, radius, kernel, radius, 0);
+            RaylibSIMD_ImageBlurBox(&result, radius);
+            TEST_CHECK(TestConvolveError(result, reference) <= tolerance, "box %d %dx%d float %d", radius, image.width, image.height, float_format);
+            RL_FREE(reference);
+            RL_FREE(result.data);
+        }
+
+        int radius = 0;
+        TestGaussianKernel(2.5, gaussian, &radius);
+        for (int sharpen = 0; sharpen <= 1; sharpen++)
+        {
+            Image result      = TestCopyImage(image);
+            double *reference = TestConvolveReference(image, gaussian, radius, gaussian, radius, sharpen ? 1.5 : 0);
+            if (sharpen) RaylibSIMD_ImageSharpen(&result, 2.5f, 1.5f);
+            else         RaylibSIMD_ImageBlurGaussian(&result, 2.5f);
+            TEST_CHECK(TestConvolveError(result, reference) <= tolerance, "gaussian sharpen %d %dx%d float %d", sharpen, image.width, image.height, float_format);
+            RL_FREE(reference);
+            RL_FREE(result.data);
+        }
+
+        float const kernel_x[]  = {-0.25f, 0.5f, 1.0f, 0.5f, -0.75f};
+        float const kernel_y[]  = {0.125f, 0.75f, 0.125f};
+        double const double_x[] = {-0.25, 0.5, 1.0, 0.5, -0.75};
+        double const double_y[] = {0.125, 0.75, 0.125};
+        Image result            = TestCopyImage(image);
+        double *reference       = TestConvolveReference(image, double_x, 2, double_y, 1, 0);
+        RaylibSIMD_ImageConvolve(&result, kernel_x, 5, kernel_y, 3);
+        TEST_CHECK(TestConvolveError(result, reference) <= tolerance, "kernel %dx%d float %d", image.width, image.height, float_format);
+        RL_FREE(reference);
+        RL_FREE(result.data);
+        RL_FREE(image.data);
+    }
+
+    int const formats[] = {UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R4G4B4A4};
+    for (int format = 0; format < 5; format++)
+    {
+        Image image    = TestGenImage(261, 70, formats[format]);
+        Image expected = TestCopyImage(image);
+        RaylibSIMD_ImageFormat(&expected, UNCOMPRESSED_R8G8B8A8);
+        RaylibSIMD_ImageBlurBox(&expected, 4);
+        RaylibSIMD_ImageFormat(&expected, formats[format]);
+        RaylibSIMD_ImageBlurBox(&image, 4);
+        TEST_CHECK(TestImagesEqual(image, expected), "format %d", formats[format]);
+        RL_FREE(image.data);
+        RL_FREE(expected.data);
+    }
+
+    // NOTE: Box radii far past the image size, whose buffers would not fit,
+    // are the edges repeated out to the radius rather than left unfiltered
+    Image corners = RaylibSIMD_GenImageColor(3, 2, (Color){0, 0, 0, 255});
+    ((Color *)corners.data)[0] = (Color){201, 100, 50, 255};
+    ((Color *)corners.data)[5] = (Color){10, 20, 250, 0};
+    RaylibSIMD_ImageBlurBox(&corners, 1 << 30);
+    for (int index = 0; index < 6; index++)
+    {
+        Color const pixel = ((Color *)corners.data)[index];
+        TEST_CHECK((pixel.r == 53) && (pixel.g == 30) && (pixel.b == 75) && (pixel.a == 191), "huge box pixel %d: %d %d %d %d", index, pixel.r, pixel.g, pixel.b, pixel.a);
+    }
+    RL_FREE(corners.data);
+
+    // NOTE: Flat images stay flat, whatever the weights round to
+    Image flat             = RaylibSIMD_GenImageColor(200, 90, (Color){45, 170, 227, 128});
+    Image blurred          = TestCopyImage(flat);
+    float const identity[] = {0, 1, 0};
+    RaylibSIMD_ImageBlurBox(&blurred, 1 << 30);
+    TEST_CHECK(TestImagesEqual(blurred, flat), "flat huge box");
+    RaylibSIMD_ImageBlurBox(&blurred, 9);
+    RaylibSIMD_ImageBlurGaussian(&blurred, 3.3f);
+    RaylibSIMD_ImageSharpen(&blurred, 1.0f, 2.0f);
+    RaylibSIMD_ImageConvolve(&blurred, identity, 3, identity + 1, 1);
+    TEST_CHECK(TestImagesEqual(blurred, flat), "flat");
+    RL_FREE(flat.data);
+    RL_FREE(blurred.data);
+
+    // NOTE: The scalar kernels, used without SSE4.1, give the same floats
+    RaylibSIMD_InstructionSet const instruction_set = RaylibSIMD__InstructionSet();
+    float weights[2 * 9 + 1], line[(100 + 2 * 9) * 4], expected[100 * 4], actual[100 * 4];
+    float const *taps[2 * 9 + 1];
+    for (int index = 0; index < (100 + 2 * 9) * 4; index++) line[index] = TestRandom8();
+    for (int tap = 0; tap < 2 * 9 + 1; tap++)
+    {
+        weights[tap] = TestRandom8() / 1000.f;
+        taps[tap]    = line + tap * 4;
+    }
+    RaylibSIMD__WeightedSum(taps, weights, 2 * 9 + 1, expected, 100 * 4);
+    if (instruction_set >= RaylibSIMD_InstructionSet_SSE41)
+    {
+        RaylibSIMD__WeightedSum_SSE41(taps, weights, 2 * 9 + 1, actual, 100 * 4);
+        TEST_CHECK(memcmp(expected, actual, sizeof(actual)) == 0, "weighted sum SSE4.1");
+    }
+    if (instruction_set >= RaylibSIMD_InstructionSet_AVX2)
+    {
+        RaylibSIMD__WeightedSum_AVX2(taps, weights, 2 * 9 + 1, actual, 100 * 4);
+        TEST_CHECK(memcmp(expected, actual, sizeof(actual)) == 0, "weighted sum AVX2");
+    }
+    RaylibSIMD__BoxRow(line, 9, expected, 100);
+    if (instruction_set >= RaylibSIMD_InstructionSet_SSE41)
+    {
+        RaylibSIMD__BoxRow_SSE41(line, 9, actual, 100);
+        TEST_CHECK(memcmp(expected, actual, sizeof(actual)) == 0, "box row SSE4.1");
+    }
+
+    // NOTE: Tiles split over workers, and a blur of a batched image running
+    // the recorded commands first, change nothing
+    Image const image = TestGenImage(700, 300, UNCOMPRESSED_R8G8B8A8);
+    Image results[3];
+    for (int run = 0; run < 3; run++)
+    {
+        RaylibSIMD_SetWorkerCount(run == 1 ? 4 : 1);
+        results[run] = TestCopyImage(image);
+        if (run == 2) RaylibSIMD_BeginBatch(&results[run]);
+        RaylibSIMD_ImageDrawRectangleRec(&results[run], (Rectangle){100, 50, 300, 120}, (Color){20, 40, 60, 255});
+        RaylibSIMD_ImageBlurBox(&results[run], 11);
+        RaylibSIMD_ImageDrawRectangleRec(&results[run], (Rectangle){200, 100, 300, 120}, (Color){200, 40, 60, 255});
+        RaylibSIMD_ImageBlurGaussian(&results[run], 1.5f);
+        if (run == 2) RaylibSIMD_EndBatch();
+    }
+    TEST_CHECK(TestImagesEqual(results[0], results[1]), "workers");
+    TEST_CHECK(TestImagesEqual(results[0], results[2]), "batch");
+    RaylibSIMD_SetWorkerCount(1);
+    for (int run = 0; run < 3; run++) RL_FREE(results[run].data);
+    RL_FREE(image.data);
+}
+
+// NOTE: Pixels of level in error, each rebuilt from the level above in the
+// image by averaging in doubles, rounding then converting to the image format.
+// Only R8G8B8A8 channels may be off by tolerance.
+static int TestMipmapLevelErrors(Image image, int level, bool gamma, int tolerance)
+{
+    unsigned char const *levels[2] = {(unsigned char const *)image.data, NULL};
+    int widths[2] = {image.width, 0}, heights[2] = {image.height, 0};
+    for (int index = 1; index <= level; index++)
+    {
+        levels[1]  = levels[0] + GetPixelDataSize(widths[0], heights[0], image.format);
+        widths[1]  = widths[0] / 2 > 1 ? widths[0] / 2 : 1;
+        heights[1] = heights[0] / 2 > 1 ? heights[0] / 2 : 1;
+        if (index < level) { levels[0] = levels[1]; widths[0] = widths[1]; heights[0] = heights[1]; }
+    }
+
+    int const bpp       = GetPixelDataSize(1, 1, image.format);
+    bool const is_float = image.format >= UNCOMPRESSED_R32;
+    int result          = 0;
+    for (int y = 0; y < heights[1]; y++)
+    for (int x = 0; x < widths[1]; x++)
+    {
+        double sums[4] = {0};
+        float float_sums[4] = {0};
+        for (int corner = 0; corner < 4; corner++)
+        {
+            int const src_x = (2 * x + (corner & 1)) < widths[0] ? 2 * x + (corner & 1) : widths[0] - 1;
+            int const src_y = (2 * y + (corner >> 1)) < heights[0] ? 2 * y + (corner >> 1) : heights[0] - 1;
+            unsigned char const *src = levels[0] + (src_y * widths[0] + src_x) * bpp;
+            float channels[4];
+            unsigned char bytes[4];
+            RaylibSIMD__ConvertPixels(src, image.format, (unsigned char *)channels, UNCOMPRESSED_R32G32B32A32, 1);
+            RaylibSIMD__ConvertPixels(src, image.format, bytes, UNCOMPRESSED_R8G8B8A8, 1);
+            for (int channel = 0; channel < 4; channel++)
+            {
+                double const value = bytes[channel] / 255.0;
+                float_sums[channel] += channels[channel];
+                if (gamma && channel < 3) sums[channel] += (value <= 0.04045) ? value / 12.92 : pow((value + 0.055) / 1.055, 2.4);
+                else                      sums[channel] += bytes[channel];
+            }
+        }
+
+        unsigned char expected[16], actual_bytes[4];
+        unsigned char const *actual = levels[1] + (y * widths[1] + x) * bpp;
+        if (is_float)
+        {
+            float const average[4] = {float_sums[0] * 0.25f, float_sums[1] * 0.25f, float_sums[2] * 0.25f, float_sums[3] * 0.25f};
+            RaylibSIMD__ConvertPixels((unsigned char const *)average, UNCOMPRESSED_R32G32B32A32, expected, image.format, 1);
+            if (memcmp(expected, actual, bpp) != 0) result++;
+            continue;
+        }
+
+        unsigned char average[4];
+        for (int channel = 0; channel < 4; channel++)
+        {
+            double const linear = sums[channel] / 4.0;
+            if (gamma && channel < 3) average[channel] = (unsigned char)(((linear <= 0.0031308) ? linear * 12.92 : 1.055 * pow(linear, 1.0 / 2.4) - 0.055) * 255.0 + 0.5);
+            else                      average[channel] = (unsigned char)(((int)sums[channel] + 2) / 4);
+        }
+        RaylibSIMD__ConvertPixels(average, UNCOMPRESSED_R8G8B8A8, expected, image.format, 1);
+        if (image.format == UNCOMPRESSED_R8G8B8A8)
+        {
+            memcpy(actual_bytes, actual, 4);
+            for (int channel = 0; channel < 4; channel++)
+                if (abs(actual_bytes[channel] - expected[channel]) > tolerance) { result++; break; }
+        }
+        else if (memcmp(expected, actual, bpp) != 0) result++;
+    }
+    return result;
+}
+
+static void TestImageMipmaps(void)
+{
+    // NOTE: Levels of every size down to 1x1, across the bands of 64 rows and
+    // the levels built after them
+    int const sizes[][2] = {{256, 256}, {300, 75}, {37, 1}, {1, 130}, {129, 200}, {5, 3}, {70, 1100}};
+    int const formats[]  = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R32, UNCOMPRESSED_R32G32B32A32};
+    for (int size = 0; size < 7; size++)
+    for (int format = 0; format < 6; format++)
+    {
+        if ((format > 0) && (size != 1) && (size != 4)) continue;
+        Image image = TestGenImage(sizes[size][0], sizes[size][1], formats[format]);
+        RaylibSIMD_ImageMipmaps(&image);
+
+        int level_count = 1;
+        for (int width = sizes[size][0], height = sizes[size][1]; (width > 1) || (height > 1); level_count++)
+        {
+            width  = width / 2 > 1 ? width / 2 : 1;
+            height = height / 2 > 1 ? height / 2 : 1;
+        }
+        TEST_CHECK(image.mipmaps == level_count, "%dx%d mipmaps %d", sizes[size][0], sizes[size][1], image.mipmaps);
+        for (int level = 1; level < image.mipmaps; level++)
+        {
+            int const errors = TestMipmapLevelErrors(image, level, false, 0);
+            TEST_CHECK(errors == 0, "%dx%d format %d level %d: %d pixels", sizes[size][0], sizes[size][1], formats[format], level, errors);
+        }
+        RL_FREE(image.data);
+    }
+
+    // NOTE: Averaged in linear light, within 1 of the exact sRGB conversions
+    // and mostly the same, and flat colors stay the same in every level
+    RaylibSIMD_SetMipmapFilter(RaylibSIMD_MipmapFilter_BoxGamma);
+    Image image = TestGenImage(300, 75, UNCOMPRESSED_R8G8B8A8);
+    RaylibSIMD_ImageMipmaps(&image);
+    for (int level = 1; level < image.mipmaps; level++)
+    {
+        int const errors = TestMipmapLevelErrors(image, level, true, 1);
+        TEST_CHECK(errors == 0, "gamma level %d: %d pixels", level, errors);
+    }
+    int const rounded = TestMipmapLevelErrors(image, 1, true, 0);
+    TEST_CHECK(rounded * 20 < 150 * 37, "gamma level 1: %d pixels off by 1", rounded);
+    RL_FREE(image.data);
+    for (int value = 0; value < 256; value++)
+    {
+        Image flat = RaylibSIMD_GenImageColor(4, 2, (Color){(unsigned char)value, (unsigned char)(255 - value), (unsigned char)value, (unsigned char)value});
+        RaylibSIMD_ImageMipmaps(&flat);
+        Color const *pixels = (Color const *)flat.data;
+        bool same           = true;
+        for (int index = 8; index < 11; index++) same = same && (memcmp(pixels + index, pixels, sizeof(Color)) == 0); // 2x1 and 1x1 levels
+        TEST_CHECK(same, "gamma flat %d", value);
+        RL_FREE(flat.data);
+    }
+    RaylibSIMD_SetMipmapFilter(RaylibSIMD_MipmapFilter_Box);
+
+    // NOTE: Converting a mipmapped image rebuilds its levels in the new format
+    Image converted = TestGenImage(129, 200, UNCOMPRESSED_R8G8B8A8);
+    Image expected  = TestCopyImage(converted);
+    RaylibSIMD_ImageMipmaps(&converted);
+    RaylibSIMD_ImageFormat(&converted, UNCOMPRESSED_R5G6B5);
+    RaylibSIMD_ImageFormat(&expected, UNCOMPRESSED_R5G6B5);
+    RaylibSIMD_ImageMipmaps(&expected);
+    TEST_CHECK(converted.mipmaps == expected.mipmaps && converted.mipmaps == 8, "converted mipmaps %d", converted.mipmaps);
+    int converted_bytes = 0;
+    for (int level = 0, width = 129, height = 200; level < expected.mipmaps; level++)
+    {
+        converted_bytes += GetPixelDataSize(width, height, UNCOMPRESSED_R5G6B5);
+        width  = width / 2 > 1 ? width / 2 : 1;
+        height = height / 2 > 1 ? height / 2 : 1;
+    }
+    TEST_CHECK(memcmp(converted.data, expected.data, converted_bytes) == 0, "converted mipmaps pixels");
+    RL_FREE(converted.data);
+    RL_FREE(expected.data);
+
+    // NOTE: Draws update the levels under them, to the same pixels as building
+    // every level again, whether run now, over workers or from a batch
+    Image const base = TestGenImage(300, 200, UNCOMPRESSED_R8G8B8A8);
+    Image const sprite = TestGenImage(40, 30, UNCOMPRESSED_R8G8B8A8);
+    Image results[4];
+    for (int run = 0; run < 4; run++)
+    {
+        results[run] = TestCopyImage(base);
+        if (run > 0) RaylibSIMD_ImageMipmaps(&results[run]);
+        RaylibSIMD_SetWorkerCount(run == 2 ? 4 : 1);
+        if (run == 3) RaylibSIMD_BeginBatch(&results[run]);
+        RaylibSIMD_ImageDrawRectangleRec(&results[run], (Rectangle){33, 17, 101, 45}, (Color){20, 40, 60, 255});
+        RaylibSIMD_ImageDraw(&results[run], sprite, (Rectangle){0, 0, 40, 30}, (Rectangle){151, 99, 40, 30}, (Color){255, 255, 255, 255});
+        RaylibSIMD_ImageDrawCircle(&results[run], 250, 160, 31, (Color){200, 40, 60, 255});
+        if (run == 3) RaylibSIMD_EndBatch();
+        if (run == 0) RaylibSIMD_ImageMipmaps(&results[run]);
+    }
+    RaylibSIMD_SetWorkerCount(1);
+    for (int run = 1; run < 4; run++)
+    {
+        TEST_CHECK(results[run].mipmaps == results[0].mipmaps, "run %d mipmaps", run);
+        int bytes = 0;
+        for (int level = 0, width = 300, height = 200; level < results[0].mipmaps; level++)
+        {
+            bytes += GetPixelDataSize(width, height, UNCOMPRESSED_R8G8B8A8);
+            width  = width / 2 > 1 ? width / 2 : 1;
+            height = height / 2 > 1 ? height / 2 : 1;
+        }
+        TEST_CHECK(memcmp(results[run].data, results[0].data, bytes) == 0, "run %d updated levels", run);
+    }
+    for (int run = 0; run < 4; run++) RL_FREE(results[run].data);
+    RL_FREE(base.data);
+    RL_FREE(sprite.data);
+
+    // NOTE: The scalar kernels, used without SSE4.1, give the same averages
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41)
+    {
+        unsigned char rows8[2][19 * 8], expected8[19 * 4], actual8[19 * 4];
+        uint16_t rows16[2][19 * 8], expected16[19 * 4], actual16[19 * 4];
+        for (int index = 0; index < 19 * 8; index++)
+        {
+            rows8[0][index]  = TestRandom8();
+            rows8[1][index]  = TestRandom8();
+            rows16[0][index] = (uint16_t)((TestRandom8() << 6) | (TestRandom8() & 63));
+            rows16[1][index] = (uint16_t)((TestRandom8() << 6) | (TestRandom8() & 63));
+        }
+        RaylibSIMD__Downsample8(rows8[0], rows8[1], expected8, 19);
+        RaylibSIMD__Downsample8_SSE41(rows8[0], rows8[1], actual8, 19);
+        TEST_CHECK(memcmp(expected8, actual8, sizeof(actual8)) == 0, "downsample 8 SSE4.1");
+        RaylibSIMD__Downsample16(rows16[0], rows16[1], expected16, 19);
+        RaylibSIMD__Downsample16_SSE41(rows16[0], rows16[1], actual16, 19);
+        TEST_CHECK(memcmp(expected16, actual16, sizeof(actual16)) == 0, "downsample 16 SSE4.1");
+    }
+}
+
+// NOTE: Squared error of the decoded R8G8B8A8 image against the original,
+// summed over the channels from first to last
+static double TestMeanSquaredError(Image a, Image b, int first, int last)
+{
+    unsigned char const *pixels_a = (unsigned char const *)a.data;
+    unsigned char const *pixels_b = (unsigned char const *)b.data;
+    double result                 = 0;
+    for (int index = 0; index < a.width * a.height; index++)
+    for (int channel = first; channel <= last; channel++)
+    {
+        double const error = pixels_a[index * 4 + channel] - pixels_b[index * 4 + channel];
+        result += error * error;
+    }
+    return result / (a.width * a.height * (last - first + 1));
+}
+
+static void TestImageFormatBlocks(void)
+{
+    int const formats[] = {COMPRESSED_DXT1_RGB, COMPRESSED_DXT1_RGBA, COMPRESSED_DXT3_RGBA, COMPRESSED_DXT5_RGBA};
+
+    // NOTE: Hand made blocks decode to the colors between their ends, with
+    // the transparent index only in DXT1 RGBA three color blocks
+    unsigned char const blocks[2][8] = {{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4}, {0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4}};
+    unsigned char const colors[2][4][4] = {{{255, 0, 0, 255}, {0, 0, 255, 255}, {170, 0, 85, 255}, {85, 0, 170, 255}},
+                                           {{0, 0, 255, 255}, {255, 0, 0, 255}, {127, 0, 127, 255}, {0, 0, 0, 0}}};
+    for (int block = 0; block < 2; block++)
+    {
+        unsigned char pixels[64];
+        RaylibSIMD__DecodeBlock(blocks[block], COMPRESSED_DXT1_RGBA, pixels);
+        for (int index = 0; index < 16; index++)
+            TEST_CHECK(memcmp(pixels + index * 4, colors[block][index % 4], 4) == 0, "block %d pixel %d: %d %d %d %d", block, index,
+                       pixels[index * 4], pixels[index * 4 + 1], pixels[index * 4 + 2], pixels[index * 4 + 3]);
+    }
+
+    // NOTE: Smooth colors come back within a few steps (DXT1 RGBA drops pixels
+    // under half alpha), flat blocks within the 565 rounding and DXT5 alpha
+    // ramps within a step of 1/7
+    Image smooth = TestGenImage(64, 36, UNCOMPRESSED_R8G8B8A8);
+    Image flat   = TestGenImage(64, 36, UNCOMPRESSED_R8G8B8A8);
+    unsigned char *smooth_pixels = (unsigned char *)smooth.data;
+    unsigned char *flat_pixels   = (unsigned char *)flat.data;
+    for (int y = 0; y < 36; y++)
+    for (int x = 0; x < 64; x++)
+    {
+        unsigned char *pixel = smooth_pixels + (y * 64 + x) * 4;
+        pixel[0]             = (unsigned char)(128 + 100 * sin(x * 0.1));
+        pixel[1]             = (unsigned char)(128 + 100 * cos(y * 0.07 + x * 0.05));
+        pixel[2]             = (unsigned char)(x * y / 9);
+        pixel[3]             = (unsigned char)(x * 4);
+        memcpy(flat_pixels + (y * 64 + x) * 4, flat_pixels + ((y & ~3) * 64 + (x & ~3)) * 4, 4);
+    }
+    for (int format = 0; format < 4; format++)
+    {
+        Image image = TestCopyImage(smooth);
+        RaylibSIMD_ImageFormat(&image, formats[format]);
+        TEST_CHECK((image.format == formats[format]) && (image.mipmaps == 1), "format %d: %d", formats[format], image.format);
+        RaylibSIMD_ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+        double const color_error = TestMeanSquaredError(image, smooth, 0, 2);
+        double const alpha_error = TestMeanSquaredError(image, smooth, 3, 3);
+        if (formats[format] != COMPRESSED_DXT1_RGBA) TEST_CHECK(color_error < 20, "format %d color error %f", formats[format], color_error);
+        if (formats[format] == COMPRESSED_DXT5_RGBA) TEST_CHECK(alpha_error < 2, "DXT5 alpha error %f", alpha_error);
+        if (formats[format] == COMPRESSED_DXT3_RGBA) TEST_CHECK(alpha_error < 30, "DXT3 alpha error %f", alpha_error);
+        RL_FREE(image.data);
+
+        image = TestCopyImage(flat);
+        RaylibSIMD_ImageFormat(&image, formats[format]);
+        RaylibSIMD_ImageFormat(&image, UNCOMPRESSED_R8G8B8A8);
+        unsigned char const *pixels = (unsigned char const *)image.data;
+        int errors                  = 0;
+        for (int index = 0; index < 64 * 36; index++)
+        {
+            unsigned char const *pixel    = pixels + index * 4;
+            unsigned char const *original = flat_pixels + index * 4;
+            if ((formats[format] == COMPRESSED_DXT1_RGBA) && (original[3] < 128))
+            {
+                errors += (pixel[0] | pixel[1] | pixel[2] | pixel[3]) != 0;
+                continue;
+            }
+            errors += (abs(pixel[0] - original[0]) > 4) || (abs(pixel[1] - original[1]) > 2) || (abs(pixel[2] - original[2]) > 4);
+            if (formats[format] == COMPRESSED_DXT5_RGBA) errors += pixel[3] != original[3];
+        }
+        TEST_CHECK(errors == 0, "format %d flat blocks: %d pixels", formats[format], errors);
+        RL_FREE(image.data);
+    }
+
+    // NOTE: The SSE4.1 kernels pick the same blocks as the scalar ones
+    if (RaylibSIMD__InstructionSet() >= RaylibSIMD_InstructionSet_SSE41)
+    {
+        int mismatches = 0;
+        for (int block = 0; block < 4000; block++)
+        {
+            unsigned char pixels[64];
+            for (int index = 0; index < 64; index++) pixels[index] = (block & 1) ? TestRandom8() : (unsigned char)(100 + (TestRandom8() & 15) + index);
+            for (int format = 0; format < 4; format++)
+            {
+                unsigned char scalar[16], simd[16];
+                RaylibSIMD__EncodeBlock(pixels, formats[format], false, scalar);
+                RaylibSIMD__EncodeBlock(pixels, formats[format], true, simd);
+                mismatches += memcmp(scalar, simd, RaylibSIMD__BlockBytes(formats[format])) != 0;
+            }
+        }
+        TEST_CHECK(mismatches == 0, "SSE4.1 blocks: %d mismatches", mismatches);
+    }
+
+    // NOTE: Every level is converted, from and to any uncompressed format and
+    // over workers, stopping at the first level that isn't whole blocks
+    Image const base = TestGenImage(96, 48, UNCOMPRESSED_R5G6B5);
+    Image mipmapped  = TestCopyImage(base);
+    RaylibSIMD_ImageMipmaps(&mipmapped);
+    Image results[2];
+    for (int run = 0; run < 2; run++)
+    {
+        results[run] = TestCopyImage(base);
+        RaylibSIMD_ImageMipmaps(&results[run]);
+        RaylibSIMD_SetWorkerCount(run == 0 ? 1 : 4);
+        RaylibSIMD_ImageFormat(&results[run], COMPRESSED_DXT5_RGBA);
+    }
+    RaylibSIMD_SetWorkerCount(1);
+    TEST_CHECK(results[0].mipmaps == 3, "96x48 compressed mipmaps %d", results[0].mipmaps);
+    TEST_CHECK(memcmp(results[0].data, results[1].data, (24 * 12 + 12 * 6 + 6 * 3) * 16) == 0, "workers blocks");
+    Image level = TestGenImage(24, 12, UNCOMPRESSED_R5G6B5);
+    memcpy(level.data, (unsigned char *)mipmapped.data + GetPixelDataSize(96, 48, UNCOMPRESSED_R5G6B5) + GetPixelDataSize(48, 24, UNCOMPRESSED_R5G6B5),
+           GetPixelDataSize(24, 12, UNCOMPRESSED_R5G6B5));
+    RaylibSIMD_ImageFormat(&level, COMPRESSED_DXT5_RGBA);
+    TEST_CHECK(memcmp(level.data, (unsigned char *)results[0].data + (24 * 12 + 12 * 6) * 16, 6 * 3 * 16) == 0, "level 2 blocks");
+    RL_FREE(level.data);
+
+    RaylibSIMD_ImageFormat(&results[1], UNCOMPRESSED_GRAYSCALE);
+    TEST_CHECK((results[1].format == UNCOMPRESSED_GRAYSCALE) && (results[1].mipmaps == 3), "decompressed format %d mipmaps %d", results[1].format, results[1].mipmaps);
+    RaylibSIMD_ImageFormat(&results[0], COMPRESSED_DXT1_RGB);
+    TEST_CHECK(results[0].format == COMPRESSED_DXT1_RGB, "recompressed format %d", results[0].format);
+    for (int run = 0; run < 2; run++) RL_FREE(results[run].data);
+    RL_FREE(mipmapped.data);
+    RL_FREE(base.data);
+
+    Image partial = TestGenImage(6, 8, UNCOMPRESSED_R8G8B8A8);
+    RaylibSIMD_ImageFormat(&partial, COMPRESSED_DXT1_RGB);
+    TEST_CHECK(partial.format == UNCOMPRESSED_R8G8B8A8, "6x8 compressed to %d", partial.format);
+    RaylibSIMD_ImageFormat(&partial, COMPRESSED_ETC2_RGB);
+    TEST_CHECK(partial.format == UNCOMPRESSED_R8G8B8A8, "ETC2 compressed to %d", partial.format);
+    RL_FREE(partial.data);
+    RL_FREE(smooth.data);
+    RL_FREE(flat.data);
+}
+
+static void TestScratchAndAlignment(void)
+{
+    // NOTE: Returned blocks are reused by the next call that fits, up to the
+    // pool's slots, and start on a cache line
+    RaylibSIMD_ReleaseScratch();
+    void *first  = RaylibSIMD__ScratchAlloc(1000);
+    void *second = RaylibSIMD__ScratchAlloc(100);
+    TEST_CHECK(first && second && (first != second), "scratch blocks %p %p", first, second);
+    TEST_CHECK((((uintptr_t)first % 64) == 0) && (((uintptr_t)second % 64) == 0), "scratch alignment %p %p", first, second);
+    RaylibSIMD__ScratchFree(first);
+    RaylibSIMD__ScratchFree(second);
+    TEST_CHECK(RaylibSIMD__ScratchAlloc(90) == second, "smallest block that fits");
+    TEST_CHECK(RaylibSIMD__ScratchAlloc(900) == first, "reused block");
+    RaylibSIMD__ScratchFree(first);
+    RaylibSIMD__ScratchFree(second);
+
+    void *blocks[RS_SCRATCH_POOL_SLOTS + 8];
+    for (int index = 0; index < RS_SCRATCH_POOL_SLOTS + 8; index++) blocks[index] = RaylibSIMD__ScratchAlloc(64);
+    for (int index = 0; index < RS_SCRATCH_POOL_SLOTS + 8; index++) RaylibSIMD__ScratchFree(blocks[index]);
+    TEST_CHECK(RaylibSIMD__scratch_pool.block_count == RS_SCRATCH_POOL_SLOTS, "pool slots %d", RaylibSIMD__scratch_pool.block_count);
+    RaylibSIMD_ReleaseScratch();
+    TEST_CHECK((RaylibSIMD__scratch_pool.block_count == 0) && (RaylibSIMD__scratch_pool.bytes == 0), "released pool %d", RaylibSIMD__scratch_pool.block_count);
+
+    // NOTE: Scratch images draw like any other and come back for the next one
+    Image scratch = RaylibSIMD_LoadScratchImage(37, 5, UNCOMPRESSED_R8G8B8);
+    Image image   = RaylibSIMD_GenImageColor(37, 5, (Color){1, 2, 3, 255});
+    TEST_CHECK(scratch.data && (((uintptr_t)scratch.data % 64) == 0), "scratch image %p", scratch.data);
+    RaylibSIMD_ImageFormat(&image, UNCOMPRESSED_R8G8B8);
+    RaylibSIMD_ImageClearBackground(&scratch, (Color){1, 2, 3, 255});
+    TEST_CHECK(TestImagesEqual(scratch, image), "scratch image pixels");
+    void *const data = scratch.data;
+    RaylibSIMD_UnloadScratchImage(scratch);
+    scratch = RaylibSIMD_LoadScratchImage(5, 37, UNCOMPRESSED_R8G8B8);
+    TEST_CHECK(scratch.data == data, "scratch image reused");
+    RaylibSIMD_UnloadScratchImage(scratch);
+
+    // NOTE: Draws recorded on a scratch image land before it is unloaded, not
+    // on the next scratch image handed the same block
+    scratch = RaylibSIMD_LoadScratchImage(32, 8, UNCOMPRESSED_R8G8B8A8);
+    RaylibSIMD_BeginBatch(&scratch);
+    RaylibSIMD_ImageDrawRectangleRec(&scratch, (Rectangle){0, 0, 32, 8}, (Color){1, 2, 3, 255});
+    RaylibSIMD_UnloadScratchImage(scratch);
+    Image other = RaylibSIMD_LoadScratchImage(32, 8, UNCOMPRESSED_R8G8B8A8);
+    memset(other.data, 0xAA, 32 * 8 * 4);
+    RaylibSIMD_EndBatch();
+    bool untouched = (other.data == scratch.data);
+    for (int index = 0; index < 32 * 8 * 4; index++) untouched = untouched && (((unsigned char *)other.data)[index] == 0xAA);
+    TEST_CHECK(untouched, "batch flushed before unload, other[0] = %08x", *(unsigned int *)other.data);
+    RaylibSIMD_UnloadScratchImage(other);
+
+    TEST_CHECK(RaylibSIMD_LoadScratchImage(0, 5, UNCOMPRESSED_R8G8B8).data == NULL, "empty scratch image");
+    TEST_CHECK(RaylibSIMD_LoadScratchImage(8, 8, COMPRESSED_DXT1_RGB).data == NULL, "compressed scratch image");
+    RL_FREE(image.data);
+    RaylibSIMD_ReleaseScratch();
+
+#if !defined(_WIN32)
+    // NOTE: Image data allocated by RaylibSIMD is aligned once asked for, with
+    // the same pixels
+    Image unaligned = RaylibSIMD_GenImageColor(33, 7, (Color){10, 20, 30, 40});
+    RaylibSIMD_SetImageAlignment(64);
+    RaylibSIMD_SetImageAlignment(48);
+    Image aligned = RaylibSIMD_GenImageColor(33, 7, (Color){10, 20, 30, 40});
+    TEST_CHECK(((uintptr_t)aligned.data % 64) == 0, "GenImageColor alignment %p", aligned.data);
+    TEST_CHECK(TestImagesEqual(aligned, unaligned), "aligned GenImageColor pixels");
+    RaylibSIMD_ImageFormat(&aligned, UNCOMPRESSED_R5G6B5);
+    TEST_CHECK(((uintptr_t)aligned.data % 64) == 0, "ImageFormat alignment %p", aligned.data);
+    RaylibSIMD_ImageMipmaps(&aligned);
+    TEST_CHECK(((uintptr_t)aligned.data % 64) == 0, "ImageMipmaps alignment %p", aligned.data);
+    RaylibSIMD_SetImageAlignment(0);
+    RaylibSIMD_ImageFormat(&unaligned, UNCOMPRESSED_R5G6B5);
+    RaylibSIMD_ImageMipmaps(&unaligned);
+    TEST_CHECK(memcmp(aligned.data, unaligned.data, 33 * 7 * 2 + 16 * 3 * 2 + 8 * 2 + 4 * 2 + 2 * 2 + 2) == 0, "aligned mipmaps pixels");
+    RL_FREE(aligned.data);
+    RL_FREE(unaligned.data);
+#endif
+}
+
+// NOTE: Opaque sources drawn with a white tint are a format conversion
+static void TestImageDrawOpaqueCopy(void)
+{
+    int const formats[] = {UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5};
+    for (int index = 0; index < 2; index++)
+    {
+        Image src = TestGenImage(45, 6, formats[index]);
+        Image dst = TestGenImage(45, 6, UNCOMPRESSED_R8G8B8A8);
+        Image expected = TestCopyImage(dst);
+        RaylibSIMD__ConvertPixels((unsigned char const *)src.data, src.format, (unsigned char *)expected.data, expected.format, src.width * src.height);
+
+        Rectangle const rec = {0, 0, 45, 6};
+        RaylibSIMD_ImageDraw(&dst, src, rec, rec, (Color){255, 255, 255, 255});
+        TEST_CHECK(TestImagesEqual(dst, expected), "format %d", formats[index]);
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+        RL_FREE(expected.data);
+    }
+}
+
+// NOTE: Float formats blend without quantization, against a blend evaluated in
+// double precision. Float sources hold HDR colors up to 4, float destinations
+// must match to float precision and R8G8B8A8 ones to 1 LSB.
+static void TestDecodeChannels(unsigned char const *ptr, int format, double channels[4])
+{
+    float const *floats = (float const *)ptr;
+    channels[0] = channels[1] = channels[2] = 0.0;
+    channels[3] = 1.0;
+    switch (format)
+    {
+        case UNCOMPRESSED_R8G8B8A8:     for (int channel = 0; channel < 4; channel++) channels[channel] = ptr[channel] / 255.0; break;
+        case UNCOMPRESSED_R32:          channels[0] = floats[0]; break; // NOTE: Red only, like RaylibSIMD_ImageFormat
+        case UNCOMPRESSED_R32G32B32:    for (int channel = 0; channel < 3; channel++) channels[channel] = floats[channel]; break;
+        case UNCOMPRESSED_R32G32B32A32: for (int channel = 0; channel < 4; channel++) channels[channel] = floats[channel]; break;
+    }
+}
+
+static void TestImageDrawFloat(void)
+{
+    int const formats[] = {UNCOMPRESSED_R32, UNCOMPRESSED_R32G32B32, UNCOMPRESSED_R32G32B32A32, UNCOMPRESSED_R8G8B8A8};
+    Color const tint    = {255, 200, 100, 180};
+    for (int src_index = 0; src_index < 4; src_index++)
+    for (int dest_index = 0; dest_index < 4; dest_index++)
+    {
+        int const src_format  = formats[src_index];
+        int const dest_format = formats[dest_index];
+        if (src_format == UNCOMPRESSED_R8G8B8A8 && dest_format == UNCOMPRESSED_R8G8B8A8) continue;
+
+        int const width = 37, height = 3;
+        Image src       = TestGenImage(width, height, src_format);
+        Image dst       = TestGenImage(width, height, dest_format);
+        if (src_format == UNCOMPRESSED_R32G32B32A32)
+            for (int index = 0; index < width * height * 4; index++) if (index % 4 != 3) ((float *)src.data)[index] *= 4.f;
+        if (src_format == UNCOMPRESSED_R32 || src_format == UNCOMPRESSED_R32G32B32)
+            for (int index = 0; index < GetPixelDataSize(width, height, src_format) / 4; index++) ((float *)src.data)[index] *= 4.f;
+        Image before    = TestCopyImage(dst);
+
+        Rectangle const rec = {0, 0, (float)width, (float)height};
+        RaylibSIMD_ImageDraw(&dst, src, rec, rec, tint);
+
+        int const src_bpp  = GetPixelDataSize(1, 1, src_format);
+        int const dest_bpp = GetPixelDataSize(1, 1, dest_format);
+        double max_error   = 0;
+        for (int pixel = 0; pixel < width * height; pixel++)
+        {
+            double src_c[4], dest_c[4], actual[4], blend[4];
+            TestDecodeChannels((unsigned char *)src.data + pixel * src_bpp, src_format, src_c);
+            TestDecodeChannels((unsigned char *)before.data + pixel * dest_bpp, dest_format, dest_c);
+            TestDecodeChannels((unsigned char *)dst.data + pixel * dest_bpp, dest_format, actual);
+
+            double const src_a  = src_c[3] * tint.a / 255.0;
+            double const dest_w = dest_c[3] * (1.0 - src_a);
+            blend[3]            = src_a + dest_w;
+            blend[0]            = (src_c[0] * tint.r / 255.0 * src_a + dest_c[0] * dest_w) / blend[3];
+            blend[1]            = (src_c[1] * tint.g / 255.0 * src_a + dest_c[1] * dest_w) / blend[3];
+            blend[2]            = (src_c[2] * tint.b / 255.0 * src_a + dest_c[2] * dest_w) / blend[3];
+            if (dest_format == UNCOMPRESSED_R32) blend[0] = blend[0] * 0.299 + blend[1] * 0.587 + blend[2] * 0.114;
+
+            int const channels = (dest_format == UNCOMPRESSED_R32) ? 1 : (dest_format == UNCOMPRESSED_R32G32B32) ? 3 : 4;
+            for (int channel = 0; channel < channels; channel++)
+            {
+                double expected = blend[channel];
+                double error    = 0;
+                if (dest_format == UNCOMPRESSED_R8G8B8A8)
+                {
+                    expected = (expected > 1.0) ? 1.0 : expected;
+                    error    = fabs(actual[channel] - expected) * 255.0;
+                }
+                else error = fabs(actual[channel] - expected) / (1.0 + fabs(expected));
+                if (error > max_error) max_error = error;
+            }
+        }
+
+        double const budget = (dest_format == UNCOMPRESSED_R8G8B8A8) ? 1.0 : 1e-5;
+        TEST_CHECK(max_error <= budget, "%d to %d error %g", src_format, dest_format, max_error);
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+        RL_FREE(before.data);
+    }
+}
+
+// NOTE: Splitting over workers and recording into a batch don't change the
+// result, the draws overlap so the command order matters.
+static void TestWorkersAndBatch(void)
+{
+    Image src        = TestGenImage(300, 260, UNCOMPRESSED_R8G8B8A8);
+    Image background = TestGenImage(700, 400, UNCOMPRESSED_R8G8B8A8);
+    RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Fixed16);
+
+    Image results[3];
+    for (int run = 0; run < 3; run++)
+    {
+        RaylibSIMD_SetWorkerCount(run == 0 ? 1 : 4);
+        results[run] = TestCopyImage(background);
+        if (run == 2) RaylibSIMD_BeginBatch(&results[run]);
+        for (int draw = 0; draw < 12; draw++)
+        {
+            Rectangle const src_rec = {0, 0, 300, 260};
+            Rectangle const dst_rec = {(float)(draw * 37 - 40), (float)(draw * 23 - 30), 300, 260};
+            RaylibSIMD_ImageDraw(&results[run], src, src_rec, dst_rec, (Color){255, 255, 255, (unsigned char)(120 + draw * 10)});
+            RaylibSIMD_ImageDrawRectangleRec(&results[run], (Rectangle){(float)(draw * 51), 100, 40, 250}, (Color){(unsigned char)(draw * 20), 80, 160, 255});
+            RaylibSIMD_ImageDrawPro(&results[run], src, src_rec, (Rectangle){(float)(draw * 61), 200, 150, 130}, (Vector2){75, 65}, draw * 31.f, (Color){255, 255, 255, 200});
+            RaylibSIMD_ImageDrawMasked(&results[run], src, src_rec, src, (Rectangle){0, 0, 300, 200}, (Vector2){(float)(draw * 45 - 60), (float)(draw * 17)}, (Color){90, 255, 255, 255});
+            RaylibSIMD_SetShapeEdges((draw % 2) ? RaylibSIMD_ShapeEdges_Antialiased : RaylibSIMD_ShapeEdges_Aliased);
+            RaylibSIMD_ImageDrawCircleV(&results[run], (Vector2){draw * 57.3f, 150.5f + draw * 9}, 90.f - draw * 3, (Color){200, 60, (unsigned char)(draw * 20), 170});
+            RaylibSIMD_ImageDrawRectangleRoundedLines(&results[run], (Rectangle){draw * 40.5f, draw * 19.25f, 260, 120}, 0.5f, 9, (Color){40, 220, 90, 255});
+        }
+        if (run == 2) RaylibSIMD_EndBatch();
+    }
+
+    TEST_CHECK(TestImagesEqual(results[0], results[1]), "workers");
+    TEST_CHECK(TestImagesEqual(results[0], results[2]), "batch");
+
+    RaylibSIMD_SetWorkerCount(1);
+    RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Float);
+    RaylibSIMD_SetShapeEdges(RaylibSIMD_ShapeEdges_Aliased);
+    for (int run = 0; run < 3; run++) RL_FREE(results[run].data);
+    RL_FREE(src.data);
+    RL_FREE(background.data);
+}
+
+// -----------------------------------------------------------------------------
+// Blend accuracy
+// -----------------------------------------------------------------------------
+// NOTE: Differential test of every draw mode against a golden blend evaluated
+// in double precision from the exact channel values of each format, i.e.
+// independent of the kernels and the scalar references in the header. Errors
+// are in units of the destination channel (1 = 1 LSB, so 17 in 8 bit terms for
+// R4G4B4A4) and the color of a pixel whose blended alpha rounds to 0 isn't
+// compared since it's invisible.
+//
+// Alpha weighted errors scale the color error by the blended alpha, i.e. the
+// error once composited, for Fixed16 which quantizes alpha before dividing by
+// it so nearly transparent results have coarse colors.
+
+typedef struct
+{
+    int channel[4];
+    int max[4];     // (1 << bits) - 1, 0 for a missing alpha
+    bool gray;      // R, G and B are one stored luminance channel
+} TestPixel;
+
+static TestPixel TestUnpackPixel(unsigned char const *ptr, int format)
+{
+    TestPixel result    = {0};
+    unsigned short bits = (format == UNCOMPRESSED_GRAYSCALE) ? 0 : (unsigned short)(ptr[0] | (ptr[1] << 8));
+    switch (format)
+    {
+        case UNCOMPRESSED_R8G8B8A8: result = (TestPixel){{ptr[0], ptr[1], ptr[2], ptr[3]}, {255, 255, 255, 255}, false}; break;
+        case UNCOMPRESSED_R8G8B8:   result = (TestPixel){{ptr[0], ptr[1], ptr[2], 0}, {255, 255, 255, 0}, false}; break;
+        case UNCOMPRESSED_R5G6B5:   result = (TestPixel){{bits >> 11, (bits >> 5) & 63, bits & 31, 0}, {31, 63, 31, 0}, false}; break;
+        case UNCOMPRESSED_R5G5B5A1: result = (TestPixel){{bits >> 11, (bits >> 6) & 31, (bits >> 1) & 31, bits & 1}, {31, 31, 31, 1}, false}; break;
+        case UNCOMPRESSED_R4G4B4A4: result = (TestPixel){{bits >> 12, (bits >> 8) & 15, (bits >> 4) & 15, bits & 15}, {15, 15, 15, 15}, false}; break;
+        case UNCOMPRESSED_GRAYSCALE:  result = (TestPixel){{ptr[0], ptr[0], ptr[0], 0}, {255, 255, 255, 0}, true}; break;
+        case UNCOMPRESSED_GRAY_ALPHA: result = (TestPixel){{ptr[0], ptr[0], ptr[0], ptr[1]}, {255, 255, 255, 255}, true}; break;
+    }
+    return result;
+}
+
+static double TestChannel01(TestPixel const *pixel, int channel)
+{
+    if (pixel->max[channel] == 0) return 1.0;
+    return (double)pixel->channel[channel] / pixel->max[channel];
+}
+
+// NOTE: Porter-Duff "over" with the tint applied to the source, straight or
+// premultiplied alpha, or one of the color modes, rounded to the destination's
+// channel sizes. Gray destinations store the luminance of the blend.
+static TestPixel TestGoldenBlend(TestPixel const *src, TestPixel const *dest, Color tint, RaylibSIMD_BlendMode blend_mode)
+{
+    double const tint01[4] = {tint.r / 255.0, tint.g / 255.0, tint.b / 255.0, tint.a / 255.0};
+    double const src_a     = TestChannel01(src, 3) * tint01[3];
+    double const dest_a    = TestChannel01(dest, 3);
+    double const dest_w    = dest_a * (1.0 - src_a);
+    double const blend_a   = src_a + dest_w;
+
+    TestPixel result  = *dest;
+    double blend_c[3] = {0};
+    for (int channel = 0; channel < 3; channel++)
+    {
+        double const src_c  = TestChannel01(src, channel) * tint01[channel];
+        double const dest_c = TestChannel01(dest, channel);
+        double const sa_c   = src_c * src_a;
+        switch (blend_mode)
+        {
+            case RaylibSIMD_BlendMode_Alpha:              if (blend_a > 0.0) blend_c[channel] = (src_c * src_a + dest_c * dest_w) / blend_a; break;
+            case RaylibSIMD_BlendMode_AlphaPremultiplied: blend_c[channel] = src_c * tint01[3] + dest_c * (1.0 - src_a); break;
+            case RaylibSIMD_BlendMode_Additive:           blend_c[channel] = fmin(1.0, dest_c + sa_c); break;
+            case RaylibSIMD_BlendMode_Subtract:           blend_c[channel] = fmax(0.0, dest_c - sa_c); break;
+            case RaylibSIMD_BlendMode_Multiply:           blend_c[channel] = dest_c * (1.0 - src_a + sa_c); break;
+            case RaylibSIMD_BlendMode_Screen:             blend_c[channel] = 1.0 - (1.0 - dest_c) * (1.0 - sa_c); break;
+            case RaylibSIMD_BlendMode_Min:                blend_c[channel] = dest_c + (fmin(src_c, dest_c) - dest_c) * src_a; break;
+            case RaylibSIMD_BlendMode_Max:                blend_c[channel] = dest_c + (fmax(src_c, dest_c) - dest_c) * src_a; break;
+            case RaylibSIMD_BlendMode_Copy:               blend_c[channel] = src_c; break;
+        }
+    }
+    if (dest->gray) blend_c[0] = blend_c[1] = blend_c[2] = blend_c[0] * 0.299 + blend_c[1] * 0.587 + blend_c[2] * 0.114;
+    for (int channel = 0; channel < 3; channel++) result.channel[channel] = (int)(blend_c[channel] * result.max[channel] + 0.5);
+    result.channel[3] = (int)(((blend_mode == RaylibSIMD_BlendMode_Copy) ? src_a : blend_a) * result.max[3] + 0.5);
+    return result;
+}
+
+typedef struct
+{
+    char const              *name;
+    RaylibSIMD_ImageDrawMode mode;
+    RaylibSIMD_BlendPrecision precision;
+    RaylibSIMD_BlendMode     blend_mode;
+    int                      budget;         // Max error in LSBs, see RaylibSIMD_BlendPrecision. -1 only reports, for raylib's own blend
+    bool                     alpha_weighted;
+} TestBlendVariant;
+
+// NOTE: Draws src over dst with the variant and returns the max error of the
+// result against the golden blend, dst is modified.
+static int TestBlendDrawError(TestBlendVariant const *variant, Image src, Image dst, Color draw_tint)
+{
+    int const src_bpp  = GetPixelDataSize(1, 1, src.format);
+    int const dest_bpp = GetPixelDataSize(1, 1, dst.format);
+    Image const before = TestCopyImage(dst);
+
+    RaylibSIMD_SetImageDrawMode(variant->mode);
+    RaylibSIMD_SetBlendPrecision(variant->precision);
+    Rectangle const rec = {0, 0, (float)src.width, (float)src.height};
+    RaylibSIMD_ImageDrawEx(&dst, src, rec, rec, draw_tint, variant->blend_mode);
+    RaylibSIMD_SetImageDrawMode(RaylibSIMD_ImageDrawMode_Auto);
+    RaylibSIMD_SetBlendPrecision(RaylibSIMD_BlendPrecision_Float);
+
+    int result = 0;
+    for (int pixel = 0; pixel < src.width * src.height; pixel++)
+    {
+        TestPixel const src_pixel  = TestUnpackPixel((unsigned char *)src.data + pixel * src_bpp, src.format);
+        TestPixel const dest_pixel = TestUnpackPixel((unsigned char *)before.data + pixel * dest_bpp, dst.format);
+        TestPixel const actual     = TestUnpackPixel((unsigned char *)dst.data + pixel * dest_bpp, dst.format);
+        TestPixel const expected   = TestGoldenBlend(&src_pixel, &dest_pixel, draw_tint, variant->blend_mode);
+
+        bool const visible = (expected.max[3] == 0) || (expected.channel[3] > 0) || (variant->blend_mode != RaylibSIMD_BlendMode_Alpha);
+        for (int channel = 0; channel < 4; channel++)
+        {
+            if (channel < 3 && !visible) continue;
+            int error = abs(actual.channel[channel] - expected.channel[channel]);
+            if (variant->alpha_weighted && channel < 3 && expected.max[3])
+                error = (error * expected.channel[3] + expected.max[3] - 1) / expected.max[3];
+            if (error > result) result = error;
+        }
+    }
+
+    RL_FREE(before.data);
+    return result;
+}
+
+static int TestBlendError(TestBlendVariant const *variant, int src_format, int dest_format, int width, int height)
+{
+    Image src = TestGenImage(width, height, src_format);
+    Image dst = TestGenImage(width, height, dest_format);
+    int const src_bpp = GetPixelDataSize(1, 1, src_format);
+
+    // NOTE: Premultiplied sources have colors no larger than alpha, and runs of
+    // transparent and opaque pixels exercise the alpha block fast paths
+    for (int pixel = 0; pixel < width * height; pixel++)
+    {
+        unsigned char *ptr = (unsigned char *)src.data + pixel * src_bpp;
+        int const run      = (pixel / 24) % 4;
+        if (src_format == UNCOMPRESSED_GRAY_ALPHA)
+        {
+            if (run == 0) ptr[1] = 0;
+            if (run == 1) ptr[1] = 255;
+        }
+        if (src_format == UNCOMPRESSED_R8G8B8A8)
+        {
+            if (run == 0) ptr[3] = 0;
+            if (run == 1) ptr[3] = 255;
+            if (variant->blend_mode == RaylibSIMD_BlendMode_AlphaPremultiplied)
+                for (int channel = 0; channel < 3; channel++) ptr[channel] = (unsigned char)(ptr[channel] % (ptr[3] + 1));
+        }
+    }
+
+    Color const tint   = {TestRandom8(), TestRandom8(), TestRandom8(), TestRandom8()};
+    Color const white  = {255, 255, 255, 255};
+    Color const draw_tint = (TestRandom8() & 1) ? white : tint;
+
+    int result = TestBlendDrawError(variant, src, dst, draw_tint);
+    RL_FREE(src.data);
+    RL_FREE(dst.data);
+    return result;
+}
+
+// NOTE: Inputs found to hit the worst case of a blend, which random images are
+// unlikely to produce. Each is drawn as a row of identical R8G8B8A8 pixels,
+// wide enough for every kernel and its tail.
+typedef struct
+{
+    Color src;
+    Color dest;
+    Color tint;
+} TestBlendCase;
+
+static TestBlendCase const TEST_BLEND_CASES[] =
+{
+    {{0, 0, 0, 56}, {255, 255, 255, 105}, {255, 255, 255, 239}}, // Faint source over faint dest, 2 LSB with 8 bit Fixed16 weights
+};
+
+static int TestBlendCasesError(TestBlendVariant const *variant)
+{
+    int result = 0;
+    for (int case_index = 0; case_index < (int)(sizeof(TEST_BLEND_CASES) / sizeof(TEST_BLEND_CASES[0])); case_index++)
+    {
+        TestBlendCase const *blend_case = TEST_BLEND_CASES + case_index;
+        Image src = RaylibSIMD_GenImageColor(35, 1, blend_case->src);
+        Image dst = RaylibSIMD_GenImageColor(35, 1, blend_case->dest);
+        int const error = TestBlendDrawError(variant, src, dst, blend_case->tint);
+        if (error > result) result = error;
+        RL_FREE(src.data);
+        RL_FREE(dst.data);
+    }
+    return result;
+}
+
+static void TestBlendAccuracy(void)
+{
+    static TestBlendVariant const VARIANTS[] =
+    {
+        {"Original",      RaylibSIMD_ImageDrawMode_Original,  RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Alpha,              -1, false},
+        {"Flattened",     RaylibSIMD_ImageDrawMode_Flattened, RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Alpha,               1, false},
+        {"SIMD",          RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Alpha,               1, false},
+        {"Fixed16",       RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Fixed16, RaylibSIMD_BlendMode_Alpha,               1, true},
+        {"Premultiplied", RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_AlphaPremultiplied,  2, false},
+        {"Additive",      RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Additive,            2, false},
+        {"Subtract",      RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Subtract,            2, false},
+        {"Multiply",      RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Multiply,            2, false},
+        {"Screen",        RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Screen,              2, false},
+        {"Min",           RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Min,                 2, false},
+        {"Max",           RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Max,                 2, false},
+        {"Copy",          RaylibSIMD_ImageDrawMode_SIMD,      RaylibSIMD_BlendPrecision_Float,   RaylibSIMD_BlendMode_Copy,                1, false},
+    };
+    int const formats[] = {UNCOMPRESSED_R8G8B8A8, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R5G6B5, UNCOMPRESSED_R5G5B5A1, UNCOMPRESSED_R4G4B4A4, UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA};
+    char const *names[] = {"R8G8B8A8", "R8G8B8", "R5G6B5", "R5G5B5A1", "R4G4B4A4", "GRAY", "GRAY_A"};
+    int const format_count = (int)(sizeof(formats) / sizeof(formats[0]));
+
+    printf("Max blend error in destination LSBs\n");
+    printf("%-14s %-7s %-9s", "mode", "budget", "src\\dst");
+    for (int dest_index = 0; dest_index < format_count; dest_index++) printf(" %9s", names[dest_index]);
+    printf("\n");
+
+    for (int variant_index = 0; variant_index < (int)(sizeof(VARIANTS) / sizeof(VARIANTS[0])); variant_index++)
+    {
+        // NOTE: Flattened, Fixed16 and every blend mode but Alpha are R8G8B8A8 only
+        TestBlendVariant const *variant = VARIANTS + variant_index;
+        bool const rgba_only            = (variant->mode == RaylibSIMD_ImageDrawMode_Flattened) ||
+                                          (variant->precision == RaylibSIMD_BlendPrecision_Fixed16) ||
+                                          (variant->blend_mode != RaylibSIMD_BlendMode_Alpha);
+        for (int src_index = 0; src_index < format_count; src_index++)
+        {
+            if (rgba_only && formats[src_index] != UNCOMPRESSED_R8G8B8A8) continue;
+            char budget[16] = "-";
+            if (variant->budget >= 0) snprintf(budget, sizeof(budget), "%d%s", variant->budget, variant->alpha_weighted ? " (a)" : "");
+            printf("%-14s %-7s %-9s", variant->name, budget, names[src_index]);
+            for (int dest_index = 0; dest_index < format_count; dest_index++)
+            {
+                int const src_format  = formats[src_index];
+                int const dest_format = formats[dest_index];
+
+                if (rgba_only && (src_format != UNCOMPRESSED_R8G8B8A8 || dest_format != UNCOMPRESSED_R8G8B8A8))
+                {
+                    printf(" %9s", "-");
+                    continue;
+                }
+
+                // NOTE: Widths cover every kernel, its tail and multiple rows
+                int error = 0;
+                for (int trial = 0; trial < 40; trial++)
+                {
+                    int const width  = 1 + (trial * 7) % 83;
+                    int const height = 1 + trial % 5;
+                    int const trial_error = TestBlendError(variant, src_format, dest_format, width, height);
+                    if (trial_error > error) error = trial_error;
+                }
+                if (src_format == UNCOMPRESSED_R8G8B8A8 && dest_format == UNCOMPRESSED_R8G8B8A8)
+                {
+                    int const cases_error = TestBlendCasesError(variant);
+                    if (cases_error > error) error = cases_error;
+                }
+                printf(" %9d", error);
+
+                if (variant->budget >= 0)
+                    TEST_CHECK(error <= variant->budget, "%s %s to %s error %d", variant->name, names[src_index], names[dest_index], error);
+            }
+            printf("\n");
+        }
+    }
+}
+
+int main(void)
+{
+    TestGenImageColor();
+    TestImageDrawRectangleRec();
+    TestImageDrawRectangleRecStream();
+    TestImageFormat();
+    TestImageDrawFixed16();
+    TestImageDrawBlendModes();
+    TestImageDrawTail();
+    TestImageDrawPro();
+    TestImageDrawMasked();
+    TestImageDrawText();
+    TestImageDrawShapes();
+    TestImageDrawShapesAntialiased();
+    TestImageColorAdjustments();
+    TestImageConvolve();
+    TestImageMipmaps();
+    TestImageFormatBlocks();
+    TestScratchAndAlignment();
+    TestImageDrawOpaqueCopy();
+    TestImageDrawFloat();
+    TestWorkersAndBatch();
+    TestBlendAccuracy();
+
+    printf("%d checks, %d failed\n", test_checks, test_failures);
+    return test_failures ? 1 : 0;
+}